@@ -0,0 +1,87 @@
+// Standard C++ includes
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "modelSpecInternal.h"
+
+// GeNN code generator includes
+#include "code_generator/generateModules.h"
+#include "code_generator/modelSpecMerged.h"
+
+// (Single-threaded CPU) backend includes
+#include "backend.h"
+
+using namespace GeNN;
+using namespace GeNN::CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Code generation benchmark
+//--------------------------------------------------------------------------
+//! Repeatedly generates all modules of a model containing a mixture of neuron and
+//! synapse populations and reports the minimum and median time taken to do so
+//! Usage: code_generation [num repeats] [num population pairs]
+int main(int argc, char *argv[])
+{
+    const int numRepeats = (argc > 1) ? std::stoi(argv[1]) : 20;
+    const int numPairs = (argc > 2) ? std::stoi(argv[2]) : 10;
+
+    ModelSpecInternal model;
+    model.setName("code_generation");
+    model.setDT(0.1);
+    model.setPrecision(Type::Float);
+
+    // Add pairs of populations whose synapse groups can't all be merged
+    ParamValues izkParamVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues izkVarVals{{"V", 0.0}, {"U", 0.0}};
+    ParamValues lifParamVals{{"C", 0.25}, {"TauM", 10.0}, {"Vrest", 0.0}, {"Vreset", 0.0},
+                             {"Vthresh", 20.0}, {"Ioffset", 0.0}, {"TauRefrac", 5.0}};
+    VarValues lifVarVals{{"V", 0.0}, {"RefracTime", 0.0}};
+    ParamValues stdpParamVals{{"tauPlus", 20.0}, {"tauMinus", 20.0}, {"Aplus", 0.001},
+                              {"Aminus", -0.001}, {"Wmin", 0.0}, {"Wmax", 1.0}};
+    for(int i = 0; i < numPairs; i++) {
+        auto *izk = model.addNeuronPopulation<NeuronModels::Izhikevich>("Izk" + std::to_string(i), 100,
+                                                                        izkParamVals, izkVarVals);
+        auto *lif = model.addNeuronPopulation<NeuronModels::LIF>("LIF" + std::to_string(i), 100,
+                                                                 lifParamVals, lifVarVals);
+        model.addSynapsePopulation("Dense" + std::to_string(i), SynapseMatrixType::DENSE, izk, lif,
+                                   initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+                                   initPostsynaptic<PostsynapticModels::ExpCurr>({{"tau", 5.0}}));
+        model.addSynapsePopulation("Sparse" + std::to_string(i), SynapseMatrixType::SPARSE, lif, izk,
+                                   initWeightUpdate<WeightUpdateModels::STDP>(stdpParamVals, {{"g", 0.5}}),
+                                   initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+                                   initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    }
+    model.finalise();
+
+    SingleThreadedCPU::Preferences preferences;
+    SingleThreadedCPU::Backend backend(preferences);
+
+    // Repeatedly merge model and generate all modules
+    std::vector<double> durations;
+    durations.reserve(numRepeats);
+    for(int r = 0; r < numRepeats; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        ModelSpecMerged modelMerged(backend, model);
+        auto memorySpaces = backend.getMergedGroupMemorySpaces(modelMerged);
+        std::ostringstream neuronUpdate;
+        std::ostringstream synapseUpdate;
+        std::ostringstream customUpdate;
+        std::ostringstream init;
+        generateSynapseUpdate(synapseUpdate, modelMerged, backend, memorySpaces);
+        generateNeuronUpdate(neuronUpdate, modelMerged, backend, memorySpaces);
+        generateCustomUpdate(customUpdate, modelMerged, backend, memorySpaces);
+        generateInit(init, modelMerged, backend, memorySpaces);
+        durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    // Report minimum and median as these are least affected by noise
+    std::sort(durations.begin(), durations.end());
+    std::cout << "Code generation of " << numPairs << " population pairs: min " << durations.front()
+              << "ms, median " << durations[durations.size() / 2] << "ms" << std::endl;
+    return 0;
+}
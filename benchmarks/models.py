@@ -0,0 +1,273 @@
+"""
+Canonical benchmark models
+==========================
+Each benchmark is described by a function which adds populations to an
+existing :class:`pygenn.GeNNModel` for a given size and synapse matrix type.
+Sizes are model-specific: for most models they are numbers of neurons but,
+for the Potjans microcircuit, they are neuron scaling factors and, for the
+convolutional model, they are input image widths.
+"""
+import numpy as np
+import sys
+
+from os import path
+from pygenn import (create_custom_connectivity_update_model,
+                    create_var_init_snippet, init_postsynaptic,
+                    init_sparse_connectivity, init_toeplitz_connectivity,
+                    init_var, init_weight_update)
+
+# ----------------------------------------------------------------------------
+# Shared parameters
+# ----------------------------------------------------------------------------
+LIF_PARAMS = {"C": 0.2, "TauM": 20.0, "Vrest": -60.0, "Vreset": -60.0,
+              "Vthresh": -50.0, "Ioffset": 0.0, "TauRefrac": 5.0}
+LIF_INIT = {"V": init_var("Uniform", {"min": -60.0, "max": -50.0}),
+            "RefracTime": 0.0}
+
+# Snippet to initialise dense weights with a fixed connection probability
+# **NOTE** this lets DENSE matrices be compared with SPARSE and BITMASK
+# matrices initialised with the FixedProbability connectivity snippet
+dense_fixed_prob_snippet = create_var_init_snippet(
+    "dense_fixed_prob",
+    params=["prob", "weight"],
+    var_init_code=
+    """
+    value = (gennrand_uniform() < prob) ? weight : 0.0;
+    """)
+
+# Custom connectivity update which removes a synapse from each row with
+# 10% probability and replaces it with one to a random postsynaptic target
+# **NOTE** synapses are only added after one is removed so rows never overflow
+rewire_model = create_custom_connectivity_update_model(
+    "rewire",
+    row_update_code=
+    """
+    bool removed = false;
+    for_each_synapse {
+        if(gennrand_uniform() < 0.1) {
+            remove_synapse();
+            removed = true;
+            break;
+        }
+    }
+    if(removed) {
+        const unsigned int target = (unsigned int)(gennrand_uniform() * num_post);
+        add_synapse((target < num_post) ? target : (num_post - 1));
+    }
+    """)
+
+def _add_vogels_abbott_synapses(model, name, pre, post, matrix_type, prob, weight,
+                                psm):
+    if matrix_type == "DENSE":
+        wum = init_weight_update(
+            "StaticPulse", {},
+            {"g": init_var(dense_fixed_prob_snippet, {"prob": prob, "weight": weight})})
+        return model.add_synapse_population(name, matrix_type, pre, post, wum, psm)
+    elif matrix_type == "SPARSE":
+        return model.add_synapse_population(
+            name, matrix_type, pre, post,
+            init_weight_update("StaticPulse", {}, {"g": weight}), psm,
+            init_sparse_connectivity("FixedProbabilityNoAutapse", {"prob": prob}))
+    elif matrix_type == "BITMASK":
+        return model.add_synapse_population(
+            name, matrix_type, pre, post,
+            init_weight_update("StaticPulseConstantWeight", {"g": weight}), psm,
+            init_sparse_connectivity("FixedProbabilityNoAutapse", {"prob": prob}))
+    else:
+        raise ValueError(f"Unsupported matrix type '{matrix_type}'")
+
+# ----------------------------------------------------------------------------
+# Benchmark models
+# ----------------------------------------------------------------------------
+def build_vogels_abbott(model, size, matrix_type):
+    """Balanced network of LIF neurons with 80% excitatory
+    and 20% inhibitory neurons and 2% connection probability"""
+    num_exc = int(round(size * 0.8))
+    num_inh = size - num_exc
+
+    # Scale weights so total input remains constant as size is varied
+    prob = 0.02 * min(1.0, 10000.0 / size)
+    exc_weight = 0.0004 * (200.0 / (prob * size))
+    inh_weight = -0.0051 * (200.0 / (prob * size))
+
+    lif_params = dict(LIF_PARAMS, Ioffset=0.25)
+    exc = model.add_neuron_population("E", num_exc, "LIF", lif_params, LIF_INIT)
+    inh = model.add_neuron_population("I", num_inh, "LIF", lif_params, LIF_INIT)
+
+    exc_psm = init_postsynaptic("ExpCurr", {"tau": 5.0})
+    inh_psm = init_postsynaptic("ExpCurr", {"tau": 10.0})
+    for (pre_name, pre), weight, psm in [(("E", exc), exc_weight, exc_psm),
+                                         (("I", inh), inh_weight, inh_psm)]:
+        for post_name, post in [("E", exc), ("I", inh)]:
+            _add_vogels_abbott_synapses(model, pre_name + post_name, pre, post,
+                                        matrix_type, prob, weight, psm)
+    return {"num_neurons": size}
+
+def build_potjans_microcircuit(model, size, matrix_type):
+    """Potjans microcircuit model from userproject/potjans_microcircuit.py
+    built using the supplied neuron scaling factor"""
+    if matrix_type != "SPARSE":
+        raise ValueError("Potjans microcircuit only supports SPARSE connectivity")
+
+    # Import parameters and helpers from user project
+    sys.path.insert(0, path.join(path.dirname(__file__), "..", "userproject"))
+    import potjans_microcircuit as pm
+
+    neuron_scale = size
+    connectivity_scale = size
+    exp_curr_init = init_postsynaptic("ExpCurr", {"tau": 0.5})
+
+    # Use mean plus three standard deviations for maximum delay
+    max_delay = {pop: pm.MEAN_DELAY[pop] + (3.0 * pm.DELAY_SD[pop])
+                 for pop in pm.POPULATION_NAMES}
+    max_dendritic_delay_slots = int(round(max(max_delay.values()) / pm.DT_MS))
+
+    total_neurons = 0
+    neuron_populations = {}
+    for layer in pm.LAYER_NAMES:
+        for pop in pm.POPULATION_NAMES:
+            pop_name = layer + pop
+
+            ext_input_rate = pm.NUM_EXTERNAL_INPUTS[layer][pop] * connectivity_scale * pm.BACKGROUND_RATE
+            ext_weight = pm.EXTERNAL_W / np.sqrt(connectivity_scale)
+            ext_input_current = 0.001 * 0.5 * (1.0 - np.sqrt(connectivity_scale)) * pm.get_full_mean_input_current(layer, pop)
+
+            lif_params = {"C": 0.25, "TauM": 10.0, "Vrest": -65.0, "Vreset": -65.0, "Vthresh" : -50.0,
+                          "Ioffset": ext_input_current, "TauRefrac": 2.0}
+            poisson_params = {"weight": ext_weight, "tauSyn": 0.5, "rate": ext_input_rate}
+
+            pop_size = pm.get_scaled_num_neurons(layer, pop, neuron_scale)
+            neuron_pop = model.add_neuron_population(
+                pop_name, pop_size, "LIF", lif_params,
+                {"V": init_var("Normal", {"mean": -58.0, "sd": 5.0}), "RefracTime": 0.0})
+            model.add_current_source(pop_name + "_poisson", "PoissonExp", neuron_pop,
+                                     poisson_params, {"current": 0.0})
+            total_neurons += pop_size
+            neuron_populations[pop_name] = neuron_pop
+
+    total_synapses = 0
+    for trg_layer in pm.LAYER_NAMES:
+        for trg_pop in pm.POPULATION_NAMES:
+            trg_name = trg_layer + trg_pop
+            for src_layer in pm.LAYER_NAMES:
+                for src_pop in pm.POPULATION_NAMES:
+                    src_name = src_layer + src_pop
+
+                    mean_weight = pm.get_mean_weight(src_layer, src_pop, trg_layer, trg_pop) / np.sqrt(connectivity_scale)
+                    if src_pop == "E" and src_layer == "4" and trg_layer == "23" and trg_pop == "E":
+                        weight_sd = mean_weight * pm.LAYER_23_4_RELW
+                    else:
+                        weight_sd = abs(mean_weight * pm.REL_W)
+
+                    num_connections = pm.get_scaled_num_connections(src_layer, src_pop,
+                                                                    trg_layer, trg_pop,
+                                                                    neuron_scale, connectivity_scale)
+                    if num_connections == 0:
+                        continue
+
+                    total_synapses += num_connections
+                    if src_pop == "E":
+                        w_dist = {"mean": mean_weight, "sd": weight_sd, "min": 0.0,
+                                  "max": float(np.finfo(np.float32).max)}
+                    else:
+                        w_dist = {"mean": mean_weight, "sd": weight_sd,
+                                  "min": float(-np.finfo(np.float32).max), "max": 0.0}
+                    d_dist = {"mean": pm.MEAN_DELAY[src_pop], "sd": pm.DELAY_SD[src_pop],
+                              "min": 0.0, "max": max_delay[src_pop]}
+                    syn_pop = model.add_synapse_population(
+                        src_name + "_" + trg_name, matrix_type,
+                        neuron_populations[src_name], neuron_populations[trg_name],
+                        init_weight_update("StaticPulseDendriticDelay", {},
+                                           {"g": init_var("NormalClipped", w_dist),
+                                            "d": init_var("NormalClippedDelay", d_dist)}),
+                        exp_curr_init,
+                        init_sparse_connectivity("FixedNumberTotalWithReplacement",
+                                                 {"num": num_connections}))
+                    syn_pop.max_dendritic_delay_timesteps = max_dendritic_delay_slots
+    return {"num_neurons": total_neurons, "num_synapses": total_synapses}
+
+def build_conv2d(model, size, matrix_type):
+    """Poisson input image of size x size pixels and 4 channels convolved
+    with 3x3 kernels into 16 output channels of LIF neurons"""
+    in_chan = 4
+    out_chan = 16
+    out_size = size - 2
+    conv_params = {"conv_kh": 3, "conv_kw": 3,
+                   "conv_ih": size, "conv_iw": size, "conv_ic": in_chan,
+                   "conv_oh": out_size, "conv_ow": out_size, "conv_oc": out_chan}
+    kernel = np.random.default_rng(1234).normal(0.05, 0.01, 3 * 3 * in_chan * out_chan)
+
+    pre = model.add_neuron_population("Input", size * size * in_chan, "PoissonNew",
+                                      {"rate": 20.0}, {"timeStepToSpike": 0.0})
+    post = model.add_neuron_population("Output", out_size * out_size * out_chan,
+                                       "LIF", LIF_PARAMS, LIF_INIT)
+    if matrix_type == "TOEPLITZ":
+        model.add_synapse_population(
+            "Conv", matrix_type, pre, post,
+            init_weight_update("StaticPulse", {}, {"g": kernel}),
+            init_postsynaptic("DeltaCurr"),
+            init_toeplitz_connectivity("Conv2D", conv_params))
+    elif matrix_type == "SPARSE":
+        conv_params.update({"conv_sh": 1, "conv_sw": 1, "conv_padh": 0, "conv_padw": 0})
+        syn_pop = model.add_synapse_population(
+            "Conv", matrix_type, pre, post,
+            init_weight_update("StaticPulse", {}, {"g": init_var("Kernel")}),
+            init_postsynaptic("DeltaCurr"),
+            init_sparse_connectivity("Conv2D", conv_params))
+        syn_pop.vars["g"].extra_global_params["kernel"].set_init_values(kernel)
+    else:
+        raise ValueError(f"Unsupported matrix type '{matrix_type}'")
+    return {"num_neurons": (size * size * in_chan) + (out_size * out_size * out_chan)}
+
+def build_stdp(model, size, matrix_type):
+    """Poisson input population projecting to LIF
+    neurons through synapses with additive STDP"""
+    num_post = max(1, size // 10)
+    pre = model.add_neuron_population("Input", size, "PoissonNew",
+                                      {"rate": 10.0}, {"timeStepToSpike": 0.0})
+    post = model.add_neuron_population("Output", num_post, "LIF",
+                                       LIF_PARAMS, LIF_INIT)
+    stdp_params = {"tauPlus": 20.0, "tauMinus": 20.0, "Aplus": 0.0001,
+                   "Aminus": 0.000105, "Wmin": 0.0, "Wmax": 0.001}
+    stdp_init = init_weight_update("STDP", stdp_params,
+                                   {"g": init_var("Uniform", {"min": 0.0, "max": 0.001})})
+    if matrix_type == "DENSE":
+        model.add_synapse_population("Plastic", matrix_type, pre, post, stdp_init,
+                                     init_postsynaptic("ExpCurr", {"tau": 5.0}))
+    elif matrix_type == "SPARSE":
+        model.add_synapse_population("Plastic", matrix_type, pre, post, stdp_init,
+                                     init_postsynaptic("ExpCurr", {"tau": 5.0}),
+                                     init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+    else:
+        raise ValueError(f"Unsupported matrix type '{matrix_type}'")
+
+    # Spike times are required for STDP
+    pre.spike_time_required = True
+    post.spike_time_required = True
+    return {"num_neurons": size + num_post}
+
+def build_rewiring(model, size, matrix_type):
+    """Vogels-Abbott network whose excitatory recurrent connections
+    are rewired by a custom connectivity update every 10 timesteps"""
+    if matrix_type != "SPARSE":
+        raise ValueError("Rewiring model only supports SPARSE connectivity")
+
+    info = build_vogels_abbott(model, size, matrix_type)
+    model.add_custom_connectivity_update("Rewire", "Rewire",
+                                         model.synapse_populations["EE"],
+                                         rewire_model)
+    return info
+
+# Dictionary of benchmark models, mapping names to builder function,
+# default sizes and supported matrix types
+BENCHMARKS = {
+    "vogels_abbott": (build_vogels_abbott, [1000, 4000, 16000],
+                      ["DENSE", "SPARSE", "BITMASK"]),
+    "potjans_microcircuit": (build_potjans_microcircuit, [0.01, 0.05, 0.1],
+                             ["SPARSE"]),
+    "conv2d": (build_conv2d, [32, 64, 128], ["TOEPLITZ", "SPARSE"]),
+    "stdp": (build_stdp, [1000, 4000, 16000], ["DENSE", "SPARSE"]),
+    "rewiring": (build_rewiring, [1000, 4000, 16000], ["SPARSE"])}
+
+# Custom updates which should be triggered periodically by each model
+CUSTOM_UPDATES = {"rewiring": [("Rewire", 10)]}
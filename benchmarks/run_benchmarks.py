@@ -0,0 +1,137 @@
+"""
+GeNN benchmark harness
+======================
+Builds and simulates each of the canonical models defined in ``models.py``
+across a sweep of sizes and synapse matrix types and writes per-phase
+timings, build time and peak resident set size to a JSON file.
+
+Each configuration is run in a separate worker process so peak RSS
+measurements are not polluted by earlier configurations. For example::
+
+    python run_benchmarks.py --models vogels_abbott stdp --duration 500 --output cpu.json
+"""
+import json
+import resource
+import subprocess
+import sys
+
+from argparse import ArgumentParser
+from os import path
+from platform import node, processor
+from time import perf_counter
+
+from models import BENCHMARKS, CUSTOM_UPDATES
+
+# Runtime timers to report after simulation
+TIMERS = ["init_time", "init_sparse_time", "neuron_update_time",
+          "presynaptic_update_time", "postsynaptic_update_time",
+          "synapse_dynamics_time"]
+
+def get_parser():
+    parser = ArgumentParser()
+    parser.add_argument("--models", nargs="+", choices=list(BENCHMARKS.keys()),
+                        default=list(BENCHMARKS.keys()), help="Models to benchmark")
+    parser.add_argument("--sizes", nargs="+", type=float,
+                        help="Sizes to sweep (defaults to model-specific sizes)")
+    parser.add_argument("--matrix-types", nargs="+",
+                        choices=["DENSE", "SPARSE", "BITMASK", "TOEPLITZ"],
+                        help="Synapse matrix types to sweep (defaults to all supported by each model)")
+    parser.add_argument("--duration", type=float, default=1000.0, help="Duration to simulate (ms)")
+    parser.add_argument("--dt", type=float, default=0.1, help="Simulation timestep (ms)")
+    parser.add_argument("--backend", default="single_threaded_cpu", help="Backend to use")
+    parser.add_argument("--build-path", default="./", help="Path to build models in")
+    parser.add_argument("--output", default="benchmarks.json", help="JSON file to write results to")
+    parser.add_argument("--worker", help=("JSON-encoded configuration to run in this process "
+                                          "(used internally by the harness)"))
+    return parser
+
+def run_worker(config):
+    """Build and simulate a single configuration, returning results dictionary"""
+    from pygenn import GeNNModel
+
+    builder = BENCHMARKS[config["model"]][0]
+    size = config["size"]
+    size = int(size) if float(size).is_integer() else size
+
+    model = GeNNModel("float", f"{config['model']}_{config['matrix_type'].lower()}_{str(size).replace('.', '_')}",
+                      backend=config["backend"])
+    model.dt = config["dt"]
+    model.timing_enabled = True
+    info = builder(model, size, config["matrix_type"])
+
+    # Build model, timing code generation and compilation
+    build_start_time = perf_counter()
+    model.build(config["build_path"], always_rebuild=True)
+    build_time = perf_counter() - build_start_time
+
+    load_start_time = perf_counter()
+    model.load()
+    load_time = perf_counter() - load_start_time
+
+    # Simulate, triggering any custom updates at their specified intervals
+    custom_updates = CUSTOM_UPDATES.get(config["model"], [])
+    num_timesteps = int(round(config["duration"] / config["dt"]))
+    sim_start_time = perf_counter()
+    for _ in range(num_timesteps):
+        model.step_time()
+        for name, interval in custom_updates:
+            if (model.timestep % interval) == 0:
+                model.custom_update(name)
+    sim_time = perf_counter() - sim_start_time
+
+    result = dict(config)
+    result.update(info)
+    result.update({"build_time": build_time, "load_time": load_time,
+                   "sim_time": sim_time, "num_timesteps": num_timesteps,
+                   "timers": {t: getattr(model, t) for t in TIMERS}})
+    result["timers"].update({f"custom_update_{n}_time": model.get_custom_update_time(n)
+                             for n, _ in custom_updates})
+
+    # Record peak RSS of this process and of the compiler
+    # **NOTE** ru_maxrss is in kilobytes on Linux
+    result["peak_rss_kb"] = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    result["build_peak_rss_kb"] = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+    model.unload()
+    return result
+
+if __name__ == "__main__":
+    args = get_parser().parse_args()
+
+    # If we're a worker, run configuration and write results to stdout
+    if args.worker is not None:
+        print(json.dumps(run_worker(json.loads(args.worker))))
+        sys.exit(0)
+
+    results = []
+    for model_name in args.models:
+        _, default_sizes, matrix_types = BENCHMARKS[model_name]
+        sizes = default_sizes if args.sizes is None else args.sizes
+        if args.matrix_types is not None:
+            matrix_types = [m for m in matrix_types if m in args.matrix_types]
+
+        for matrix_type in matrix_types:
+            for size in sizes:
+                config = {"model": model_name, "size": size, "matrix_type": matrix_type,
+                          "duration": args.duration, "dt": args.dt,
+                          "backend": args.backend,
+                          "build_path": path.abspath(args.build_path)}
+                print(f"Running {model_name} with {matrix_type} connectivity, size={size}")
+
+                # Run configuration in worker process
+                worker = subprocess.run([sys.executable, path.abspath(__file__),
+                                         "--worker", json.dumps(config)],
+                                        cwd=path.dirname(path.abspath(__file__)),
+                                        stdout=subprocess.PIPE, text=True)
+                if worker.returncode == 0:
+                    result = json.loads(worker.stdout.splitlines()[-1])
+                    print(f"\tBuild:{result['build_time']:.2f}s, simulation:{result['sim_time']:.2f}s, "
+                          f"peak RSS:{result['peak_rss_kb'] / 1024.0:.1f}MiB")
+                else:
+                    result = dict(config, error=f"Worker failed with return code {worker.returncode}")
+                    print("\tFailed")
+                results.append(result)
+
+    # Write results to JSON
+    with open(args.output, "w") as output_file:
+        json.dump({"host": node(), "processor": processor(), "results": results},
+                  output_file, indent=4)
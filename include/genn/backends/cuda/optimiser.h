@@ -26,4 +26,8 @@ namespace GeNN::CodeGenerator::CUDA::Optimiser
 BACKEND_EXPORT Backend createBackend(const ModelSpecInternal &model, const filesystem::path &outputPath, 
                                      plog::Severity backendLevel, plog::IAppender *backendAppender, 
                                      const Preferences &preferences);
+
+//! Can code be generated for synapse groups with this matrix type?
+/*! Used to resolve synapse groups with SynapseMatrixType::AUTO, before the backend is created */
+BACKEND_EXPORT bool isMatrixTypeSupported(SynapseMatrixType type);
 }   // namespace GeNN::CodeGenerator::CUDA::Optimiser
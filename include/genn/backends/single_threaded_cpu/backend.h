@@ -4,6 +4,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 // GeNN includes
 #include "backendExport.h"
@@ -24,12 +25,61 @@ namespace filesystem
 }
 
 //--------------------------------------------------------------------------
-// GeNN::CodeGenerator::SingleThreadedCPU::Preferences
+// GeNN::CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy
 //--------------------------------------------------------------------------
 namespace GeNN::CodeGenerator::SingleThreadedCPU
 {
+//! Alternative loop structures which can be used to generate presynaptic updates
+enum class PresynapticUpdateStrategy
+{
+    ROW_WISE,                   //!< Loop through row of each presynaptic spike, testing BITMASK connectivity bit-by-bit
+    WORD_PACKED_BITMASK,        //!< Loop through words of BITMASK connectivity rows, using CLZ to skip to each synapse
+    TOEPLITZ_DIAGONAL_MAJOR,    //!< Loop through presynaptic spikes within loop through Toeplitz diagonals
+    TOEPLITZ_SPIKE_MAJOR,       //!< Loop through Toeplitz diagonals within loop through presynaptic spikes
+    TOEPLITZ_CONV2D,            //!< Loop through presynaptic spikes, clipping built-in 2D convolution kernels to the output and vectorising over output channels
+    LAST = TOEPLITZ_CONV2D,     //!< Last strategy, used to validate cached strategies - keep up to date when adding strategies
+};
+
+//--------------------------------------------------------------------------
+// GeNN::CodeGenerator::SingleThreadedCPU::Preferences
+//--------------------------------------------------------------------------
 struct Preferences : public PreferencesBase
 {
+    //! Generate re-entrant code where merged group arrays, host RNG, timers and profiling counters
+    //! are held in a context passed to every entry point rather than in globals. This allows 
+    //! multiple independent Runtimes of the same compiled model to run within one process
+    bool instanceContext = false;
+
+    //! Select presynaptic update strategies for merged groups with BITMASK or TOEPLITZ connectivity
+    //! by timing a short calibration simulation of the model with each alternative. The winners are
+    //! cached in the output directory so subsequent builds of the same model skip calibration
+    bool autoTune = false;
+
+    //! How many timesteps to simulate in each autotuning calibration run
+    unsigned int autoTuneTimesteps = 200;
+
+    //! How many times the timesteps of each autotuning calibration run are repeated. The fastest
+    //! repeat is used to compare strategies as it is least affected by other activity on the machine
+    unsigned int autoTuneRepeats = 5;
+
+    //! Presynaptic update strategies to use for synapse groups, indexed by name, rather than the default 
+    //! or autotuned ones. All synapse groups within a merged group must request the same strategy
+    std::map<std::string, PresynapticUpdateStrategy> manualPresynapticUpdateStrategies;
+
+    //! x86-64 micro-architecture levels ("x86-64-v2", "x86-64-v3" or "x86-64-v4") for which additional 
+    //! versions of the neuron and synapse update code are compiled into the model library. When the 
+    //! library is loaded, the highest level supported by the CPU is selected and logged
+    std::vector<std::string> targetISAs;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Superclass
+        PreferencesBase::updateHash(hash);
+
+        //! Update hash with preferences
+        Utils::updateHash(instanceContext, hash);
+        Utils::updateHash(targetISAs, hash);
+    }
 };
 
 //--------------------------------------------------------------------------
@@ -45,8 +95,11 @@ class State : public Runtime::StateBase
 class BACKEND_EXPORT Backend : public BackendBase
 {
 public:
-    Backend(const Preferences &preferences)
-    :   BackendBase(preferences)
+    //! Map of merged presynaptic update group hash digests to the strategy to use for them
+    typedef std::map<boost::uuids::detail::sha1::digest_type, PresynapticUpdateStrategy> PresynapticUpdateStrategies;
+
+    Backend(const Preferences &preferences, const PresynapticUpdateStrategies &presynapticUpdateStrategies = {})
+    :   BackendBase(preferences), m_PresynapticUpdateStrategies(presynapticUpdateStrategies)
     {
     }
 
@@ -159,6 +212,20 @@ public:
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const final { return false; }
 
+    virtual bool isSharedConnectivityPreSpikeFusionSupported() const final{ return true; }
+
+    virtual bool isProfilingSupported() const final{ return true; }
+
+    virtual bool isDendriticDelayWheelSupported() const final{ return true; }
+
+    virtual bool isRowCapacityGrowthSupported() const final{ return true; }
+
+    virtual bool isPostsynapticRemapIncremental() const final{ return true; }
+
+    virtual bool isPostsynapticRemapLazy() const final{ return true; }
+
+    virtual bool isInstanceContextEnabled() const final{ return getPreferences<Preferences>().instanceContext; }
+
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const final{ return 0; }
 
@@ -170,20 +237,37 @@ public:
     //! Get hash digest of this backends identification and the preferences it has been configured with
     virtual boost::uuids::detail::sha1::digest_type getHashDigest() const final;
 
+    //--------------------------------------------------------------------------
+    // Public API
+    //--------------------------------------------------------------------------
+    //! Get strategy used to generate presynaptic update for merged group
+    /*! If one has been selected by autotuning this is used, otherwise a default based on connectivity and parallelism hint */
+    PresynapticUpdateStrategy getPresynapticUpdateStrategy(const PresynapticUpdateGroupMerged &sg) const;
+
+    //! Can presynaptic update of merged group be generated using PresynapticUpdateStrategy::TOEPLITZ_CONV2D?
+    /*! This requires Toeplitz connectivity initialised with the built-in Conv2D or AvgPoolConv2D 
+        snippets and weight update code which doesn't use addToPre (so output channels can be updated independently) */
+    bool isToeplitzConv2DSupported(const PresynapticUpdateGroupMerged &sg) const;
+
 private:
     //--------------------------------------------------------------------------
     // Private methods
     //--------------------------------------------------------------------------
     void genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpdateGroupMerged &sg, 
-                              double dt, bool trueSpike) const;
+                              double dt, bool trueSpike, bool profilingEnabled) const;
+    void genToeplitzConv2DPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpdateGroupMerged &sg, 
+                                            double dt, bool trueSpike, bool profilingEnabled) const;
     void genPostsynapticUpdate(EnvironmentExternalBase &env, PostsynapticUpdateGroupMerged &sg, 
-                               double dt, bool trueSpike) const;
+                               double dt, bool trueSpike, bool profilingEnabled) const;
 
     void genPrevEventTimeUpdate(EnvironmentExternalBase &env, NeuronPrevSpikeTimeUpdateGroupMerged &ng,
                                 bool trueSpike) const;
 
     void genEmitEvent(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng, bool trueSpike) const;
 
+    //! Helper to generate attribute to compile function for each target ISA
+    void genTargetClonesAttribute(CodeStream &os) const;
+
     //! Helper to generate code to copy reduced custom update group variables back to memory
     /*! Because reduction operations are unnecessary in unbatched single-threaded CPU models so there's no need to actually reduce */
     void genWriteBackReductions(EnvironmentExternalBase &env, CustomUpdateGroupMerged &cg, const std::string &idxName) const;
@@ -216,5 +300,11 @@ private:
             }
         }
     }
+
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    //! Presynaptic update strategies selected by autotuning
+    PresynapticUpdateStrategies m_PresynapticUpdateStrategies;
 };
 }   // namespace GeNN::SingleThreadedCPU::CodeGenerator
@@ -112,9 +112,15 @@ struct PreferencesBase
     //! Logging level to use for backend
     plog::Severity backendLogLevel = plog::info;
 
-    void updateHash(boost::uuids::detail::sha1&) const
+    //! If no more than this many populations would be merged into one type of merged 
+    //! group, give each population its own merged group instead. This generates fully 
+    //! specialised code where sizes and parameters are all compile-time literals
+    size_t maxSpecialisedGroups = 0;
+
+    void updateHash(boost::uuids::detail::sha1 &hash) const
     {
         // **NOTE** optimizeCode, debugCode and various compiler flags only affect makefiles/msbuild 
+        Utils::updateHash(maxSpecialisedGroups, hash);
     }
 };
 
@@ -294,6 +300,11 @@ public:
     //! Different backends may have different or no pointer prefix (e.g. __global for OpenCL)
     virtual std::string getPointerPrefix() const { return ""; }
 
+    //! Is generated code re-entrant, with all state held in a GeNNContext passed to every entry point?
+    /*! In this mode, each module must define allocate<Module>Context and free<Module>Context 
+        functions to allocate and free its merged group arrays within the context */
+    virtual bool isInstanceContextEnabled() const{ return false; }
+
     //! As well as host pointers, are device objects required?
     virtual bool isArrayDeviceObjectRequired() const = 0;
 
@@ -315,6 +326,27 @@ public:
     //! Backends which support batch-parallelism might require an additional host reduction phase after reduction kernels
     virtual bool isHostReductionRequired() const = 0;
 
+    //! Does this backend process presynaptic spikes of synapse groups which share connectivity 
+    //! within the traversal of the synapse group whose connectivity they share?
+    virtual bool isSharedConnectivityPreSpikeFusionSupported() const{ return false; }
+
+    //! Does this backend update per-merged-group profiling counters when profiling is enabled?
+    virtual bool isProfilingSupported() const{ return false; }
+
+    //! Can this backend implement dendritic delays using sparse timing wheels rather than dense ring buffers?
+    virtual bool isDendriticDelayWheelSupported() const{ return false; }
+
+    //! Can this backend reallocate the rows of sparse synapse groups at runtime to grow or shrink their capacity?
+    virtual bool isRowCapacityGrowthSupported() const{ return false; }
+
+    //! Does this backend update the postsynaptic remapping data structure of groups with growable row capacity incrementally
+    //! when custom connectivity updates add or remove synapses rather than rebuilding it?
+    virtual bool isPostsynapticRemapIncremental() const{ return false; }
+
+    //! Does this backend build the postsynaptic remapping data structure lazily, the first time it is
+    //! used after connectivity changes, and hence require a flag to track whether it is up to date?
+    virtual bool isPostsynapticRemapLazy() const{ return false; }
+
     //! How many bytes of memory does 'device' have
     virtual size_t getDeviceMemoryBytes() const = 0;
 
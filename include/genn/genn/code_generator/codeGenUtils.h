@@ -2,9 +2,10 @@
 
 // Standard includes
 #include <algorithm>
-#include <regex>
+#include <cstdint>
 #include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -55,6 +56,12 @@ inline auto padSize(A size, B blockSize)
     return ceilDivide(size, blockSize) * blockSize;
 }
 
+//! Calculate multiplier and two shifts which divide any 32-bit unsigned integer, n, by divisor using
+//! t = (n * multiplier) >> 32 and n / divisor = (t + ((n - t) >> shift1)) >> shift2
+/*! Uses the method from Granlund & Montgomery (1994) "Division by invariant integers using multiplication".
+    A divisor of zero, e.g. the row stride of an empty synapse group, returns zeros rather than dividing by zero */
+GENN_EXPORT std::tuple<uint32_t, uint32_t, uint32_t> getFastDivide(uint32_t divisor);
+
 GENN_EXPORT void genTypeRange(CodeStream &os, const Type::ResolvedType &type, const std::string &prefix);
 
 //! Parse, type check and pretty print previously scanned vector of tokens representing an expression
@@ -707,6 +707,23 @@ public:
         }
     }
 
+    template<typename A>
+    void addDemotedVars(const std::string &fieldSuffix = "")
+    {
+        // Loop through variables demoted to constants
+        // **NOTE** these are always initialised with InitVarSnippet::Constant
+        const A archetypeAdaptor(this->getGroup().getArchetype());
+        for(const auto &v : archetypeAdaptor.getDemotedDefs()) {
+            const auto resolvedType = v.type.resolve(this->getGroup().getTypeContext());
+            assert(!resolvedType.isPointer());
+            addField(resolvedType.addConst(), v.name, resolvedType, v.name + fieldSuffix,
+                     [v](const auto &g, size_t)
+                     {
+                         return A(g).getInitialisers().at(v.name).getParams().at("constant");
+                     });
+        }
+    }
+
     template<typename A>
     void addVars(GetVarIndexFn<A> getIndexFn, const std::string &fieldSuffix = "",
                  bool readOnly = false, bool hidden = false)
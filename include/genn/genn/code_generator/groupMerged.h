@@ -158,6 +158,19 @@ protected:
         }
     }
 
+    template<typename A>
+    void updateDemotedVarHash(boost::uuids::detail::sha1 &hash) const
+    {
+        // Loop through variables demoted to constants
+        for(const auto &v : A(getArchetype()).getDemotedDefs()) {
+            // Loop through groups
+            for(const auto &g : getGroups()) {
+                // Update hash with constant value
+                Type::updateHash(A(g.get()).getInitialisers().at(v.name).getParams().at("constant"), hash);
+            }
+        }
+    }
+
     template<typename A>
     void updateVarInitDerivedParamHash(boost::uuids::detail::sha1 &hash) const
     {
@@ -275,10 +288,17 @@ public:
     void genHostMergedStructArrayPush(CodeStream &os, const BackendBase &backend, const std::string &name) const
     {
         // Implement merged group
-        os << "static Merged" << name << "Group" << this->getIndex() << " merged" << name << "Group" << this->getIndex() << "[" << this->getGroups().size() << "];" << std::endl;
+        // **NOTE** in instance context mode, backend allocates array within context instead
+        if(!backend.isInstanceContextEnabled()) {
+            os << "static Merged" << name << "Group" << this->getIndex() << " merged" << name << "Group" << this->getIndex() << "[" << this->getGroups().size() << "];" << std::endl;
+        }
         if(!getFields().empty()) {
             // Write function to update
-            os << "void pushMerged" << name << "Group" << this->getIndex() << "ToDevice(unsigned int idx, ";
+            os << "void pushMerged" << name << "Group" << this->getIndex() << "ToDevice(";
+            if(backend.isInstanceContextEnabled()) {
+                os << "GeNNContext *context, ";
+            }
+            os << "unsigned int idx, ";
             generateStructFieldArgumentDefinitions(os, backend);
             os << ")";
             {
@@ -367,7 +387,11 @@ protected:
     {
         // Generate definition for function to push group
         if(!getFields().empty()) {
-            definitions << "EXPORT_FUNC void pushMerged" << name << "Group" << this->getIndex() << "ToDevice(unsigned int idx, ";
+            definitions << "EXPORT_FUNC void pushMerged" << name << "Group" << this->getIndex() << "ToDevice(";
+            if(backend.isInstanceContextEnabled()) {
+                definitions << "GeNNContext *context, ";
+            }
+            definitions << "unsigned int idx, ";
             generateStructFieldArgumentDefinitions(definitions, backend);
             definitions << ");" << std::endl;
         }
@@ -375,7 +399,11 @@ protected:
         // Loop through fields again to generate any dynamic field pushing functions that are required
         for(const auto &f : m_Fields) {
             if((f.fieldType & GroupMergedFieldType::DYNAMIC)) {
-                definitions << "EXPORT_FUNC void pushMerged" << name << this->getIndex() << f.name << "ToDevice(unsigned int idx, ";
+                definitions << "EXPORT_FUNC void pushMerged" << name << this->getIndex() << f.name << "ToDevice(";
+                if(backend.isInstanceContextEnabled()) {
+                    definitions << "GeNNContext *context, ";
+                }
+                definitions << "unsigned int idx, ";
                 definitions << backend.getMergedGroupFieldHostTypeName(f.type) << " value);" << std::endl;
             }
 
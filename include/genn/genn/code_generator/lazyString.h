@@ -1,13 +1,15 @@
 #pragma once
 
 // Standard C++ includes
+#include <functional>
 #include <string>
-#include <variant>
-#include <vector>
 
 // GeNN includes
 #include "gennExport.h"
 
+// GeNN code generator includes
+#include "code_generator/substitutionTemplate.h"
+
 // Forward declarations
 namespace GeNN::CodeGenerator
 {
@@ -32,15 +34,13 @@ public:
     std::string str() const;
 
 private:
-    //----------------------------------------------------------------------------
-    // Typedefines
-    //----------------------------------------------------------------------------
-    typedef std::variant<std::string, std::pair<std::reference_wrapper<EnvironmentExternalBase>, std::string>> Element;
-    typedef std::vector<Element> Payload;
-
     //----------------------------------------------------------------------------
     // Members
     //----------------------------------------------------------------------------
-    Payload m_Payload;
+    //! Format string, parsed once on construction
+    SubstitutionTemplate m_Template;
+
+    //! Environment $(XX) references are resolved against when string is evaluated
+    std::reference_wrapper<EnvironmentExternalBase> m_Environment;
 };
 }   // namespace GeNN::CodeGenerator
\ No newline at end of file
@@ -287,7 +287,11 @@ public:
                     // Add reference to this group's variable to data structure
                     // **NOTE** this works fine with EGP references because the function to
                     // get their value will just return the name of the referenced EGP
-                    os << "void pushMerged" << T::name << g << f.name << "ToDevice(unsigned int idx, " << backend.getMergedGroupFieldHostTypeName(f.type) << " value)";
+                    os << "void pushMerged" << T::name << g << f.name << "ToDevice(";
+                    if(backend.isInstanceContextEnabled()) {
+                        os << "GeNNContext *context, ";
+                    }
+                    os << "unsigned int idx, " << backend.getMergedGroupFieldHostTypeName(f.type) << " value)";
                     {
                         CodeStream::Scope b(os);
                         if(host) {
@@ -328,6 +332,18 @@ private:
     void createMergedGroups(const std::vector<std::reference_wrapper<const typename MergedGroup::GroupInternal>> &unmergedGroups,
                             std::vector<MergedGroup> &mergedGroups, D getHashDigest)
     {
+        // If there are few enough groups, give each its own merged group so 
+        // their sizes and parameters are specialised into generated code
+        assert(mergedGroups.empty());
+        if(unmergedGroups.size() <= m_MaxSpecialisedGroups) {
+            mergedGroups.reserve(unmergedGroups.size());
+            for(size_t i = 0; i < unmergedGroups.size(); i++) {
+                mergedGroups.emplace_back(i, m_Model.getTypeContext(), 
+                                          std::vector<std::reference_wrapper<const typename MergedGroup::GroupInternal>>{unmergedGroups[i]});
+            }
+            return;
+        }
+
         // Create a hash map to group together groups with the same SHA1 digest
         std::unordered_map<boost::uuids::detail::sha1::digest_type, 
                            std::vector<std::reference_wrapper<const typename MergedGroup::GroupInternal>>, 
@@ -339,7 +355,6 @@ private:
         }
 
         // Reserve final merged groups vector
-        assert(mergedGroups.empty());
         mergedGroups.reserve(protoMergedGroups.size());
 
         // Construct merged groups
@@ -405,6 +420,9 @@ private:
     //! Underlying, unmerged model
     const ModelSpecInternal &m_Model;
 
+    //! Maximum number of groups of each type which are specialised rather than merged
+    const size_t m_MaxSpecialisedGroups;
+
     //! Merged neuron groups which require updating
     std::vector<NeuronUpdateGroupMerged> m_MergedNeuronUpdateGroups;
 
@@ -26,6 +26,10 @@ public:
         void generate(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng, 
                       unsigned int batchSize);
 
+        //! Generate code to write samples of traced variables to recording buffers
+        void generateVarTraces(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng,
+                               unsigned int batchSize);
+
         //! Update hash with child groups
         void updateHash(boost::uuids::detail::sha1 &hash) const;
     };
@@ -45,6 +49,10 @@ public:
         void generate(const BackendBase &backend, EnvironmentExternalBase &env,
                       NeuronUpdateGroupMerged &ng, unsigned int batchSize);
 
+        //! Generate code to write samples of traced variables to recording buffers
+        void generateVarTraces(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng,
+                               unsigned int batchSize);
+
         //! Update hash with child groups
         void updateHash(boost::uuids::detail::sha1 &hash) const;
     };
@@ -178,6 +186,10 @@ public:
     void generateSpikeEvents(EnvironmentExternalBase &env, BackendBase::GroupHandlerEnv<SynSpikeEvent> genUpdate);
     
     void generateWUVarUpdate(EnvironmentExternalBase &env, unsigned int batchSize);
+
+    //! Generate code to write samples of traced neuron, current source and postsynaptic
+    //! model variables to recording buffers after all neurons have been updated
+    void generateVarTraces(EnvironmentExternalBase &env, unsigned int batchSize);
     
     std::string getVarIndex(unsigned int batchSize, VarAccessDim varDims, const std::string &index) const;
     std::string getReadVarIndex(bool delay, unsigned int batchSize, VarAccessDim varDims, const std::string &index) const;
@@ -14,6 +14,21 @@ namespace GeNN::CodeGenerator::StandardLibrary
 //! Get standard maths functions
 GENN_EXPORT const EnvironmentLibrary::Library &getMathsFunctions();
 
+//! Get standard maths functions with exp, expm1, log and tanh replaced by polynomial approximations and an approximate sigmoid added
+/*! These are branch-free so loops calling them can be vectorised. In single precision, relative errors of exp, expm1, 
+    sigmoid and tanh are below 5e-7 and errors of log are below 2e-7 (absolute for 1/e < x < e and relative elsewhere).
+    In double precision, the corresponding bounds are 5e-14 and 5e-16. exp saturates outside [-87, 88] (single) 
+    or [-708, 709] (double) rather than returning denormals or infinity and log is only defined for positive, normal arguments. */
+GENN_EXPORT const EnvironmentLibrary::Library &getApproximateMathsFunctions();
+
+//! Generate inline definitions of the functions used by getApproximateMathsFunctions
+GENN_EXPORT void genApproximateMathsFunctions(CodeStream &os);
+
 //! Get std::random based host RNG functions
 GENN_EXPORT const EnvironmentLibrary::Library &getHostRNGFunctions(const Type::ResolvedType &precision);
+
+//! Generate inline definitions of the samplers used by getHostRNGFunctions
+/*! Poisson samples are drawn by inversion for means below 10 and 
+    using Hormann's PTRS transformed rejection otherwise */
+GENN_EXPORT void genHostRNGFunctions(CodeStream &os);
 }   // namespace GeNN::CodeGenerator::StandardLibrary
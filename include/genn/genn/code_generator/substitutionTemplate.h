@@ -0,0 +1,63 @@
+#pragma once
+
+// Standard C++ includes
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+
+//----------------------------------------------------------------------------
+// GeNN::CodeGenerator::SubstitutionTemplate
+//----------------------------------------------------------------------------
+//! Format string, pre-parsed once into literal text and $(XX) substitution slots
+/*! **NOTE** like the regular expression this replaces, function argument references 
+    such as $(0) are not valid identifiers so are left in the literal text */
+namespace GeNN::CodeGenerator
+{
+class GENN_EXPORT SubstitutionTemplate
+{
+public:
+    explicit SubstitutionTemplate(const std::string &format);
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Does this template contain any substitution slots?
+    bool hasSubstitutions() const{ return !m_Names.empty(); }
+
+    //! Get names referenced by each substitution slot
+    const std::vector<std::string> &getNames() const{ return m_Names; }
+
+    //! Get literal text segments - there is always one more of these than there are slots
+    const std::vector<std::string> &getLiterals() const{ return m_Literals; }
+
+    //! Build string by interleaving literal segments with values 
+    //! returned by getValue(name) for each slot, in order
+    template<typename F>
+    std::string render(F getValue) const
+    {
+        std::string output = m_Literals.front();
+        for(size_t i = 0; i < m_Names.size(); i++) {
+            output += getValue(m_Names[i]);
+            output += m_Literals[i + 1];
+        }
+        return output;
+    }
+
+    //----------------------------------------------------------------------------
+    // Static API
+    //----------------------------------------------------------------------------
+    //! Find next $(XX) reference in format at or after pos
+    /*! Returns position of '$' or std::string::npos if there are none, 
+        and sets nameBegin and nameEnd to delimit the name */
+    static size_t findNext(const std::string &format, size_t pos, size_t &nameBegin, size_t &nameEnd);
+
+private:
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    std::vector<std::string> m_Literals;
+    std::vector<std::string> m_Names;
+};
+}   // namespace GeNN::CodeGenerator
@@ -22,6 +22,11 @@ public:
 
     std::string getPostDenDelayIndex(unsigned int batchSize, const std::string &index, const std::string &offset) const;
 
+    //! Get expression which adds $(0) to the postsynaptic input of neuron index, $(1) timesteps 
+    //! in the future, using this group's sparse dendritic delay timing wheel
+    /*! \note timing wheels are only supported with a batch size of 1 */
+    std::string getPostDenDelayWheelPush(const std::string &index) const;
+
     std::string getPreVarIndex(bool delay, unsigned int batchSize, VarAccessDim varDims, const std::string &index) const
     {
         return getPrePostVarIndex(delay, batchSize, varDims, index, "pre");
@@ -71,7 +76,33 @@ private:
 class GENN_EXPORT PresynapticUpdateGroupMerged : public SynapseGroupMergedBase
 {
 public:
-    using SynapseGroupMergedBase::SynapseGroupMergedBase;
+    //----------------------------------------------------------------------------
+    // GeNN::CodeGenerator::PresynapticUpdateGroupMerged::SharedConnectivity
+    //----------------------------------------------------------------------------
+    //! Child group merged for synapse groups which share connectivity with this
+    //! one and whose presynaptic spikes are processed within the same traversal
+    class SharedConnectivity : public ChildGroupMerged<SynapseGroupInternal>
+    {
+    public:
+        using ChildGroupMerged::ChildGroupMerged;
+
+        //----------------------------------------------------------------------------
+        // Public API
+        //----------------------------------------------------------------------------
+        void generateSpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
+                                 PresynapticUpdateGroupMerged &sg, unsigned int batchSize, double dt);
+
+        //! Update hash with child groups
+        void updateHash(boost::uuids::detail::sha1 &hash) const;
+    };
+
+    PresynapticUpdateGroupMerged(size_t index, const Type::TypeContext &typeContext, 
+                                 const std::vector<std::reference_wrapper<const SynapseGroupInternal>> &groups);
+
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    boost::uuids::detail::sha1::digest_type getHashDigest() const;
 
     void generateRunner(const BackendBase &backend, CodeStream &definitions) const
     {
@@ -82,15 +113,29 @@ public:
                                   unsigned int batchSize, double dt);
     void generateSpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
                              unsigned int batchSize, double dt);
+
+    //! Generate presynaptic spike processing for synapse groups which share 
+    //! this group's connectivity, within the same traversal of a synaptic row
+    void generateSharedConnectivitySpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
+                                               unsigned int batchSize, double dt);
     void generateProceduralConnectivity(EnvironmentExternalBase &env);
     void generateToeplitzConnectivity(EnvironmentExternalBase &env,
                                       Transpiler::TypeChecker::StatementHandler forEachSynapseTypeCheckHandler,
                                       Transpiler::PrettyPrinter::StatementHandler forEachSynapsePrettyPrintHandler);
 
+    //! Get merged groups of synapse groups whose presynaptic spikes are processed within this group's traversal
+    const std::vector<SharedConnectivity> &getMergedSharedConnectivityGroups() const{ return m_MergedSharedConnectivityGroups; }
+
     //----------------------------------------------------------------------------
     // Static constants
     //----------------------------------------------------------------------------
     static const std::string name;
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::vector<SharedConnectivity> m_MergedSharedConnectivityGroups;
 };
 
 //----------------------------------------------------------------------------
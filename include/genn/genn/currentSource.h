@@ -2,6 +2,7 @@
 
 // Standard includes
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -9,6 +10,7 @@
 #include "currentSourceModels.h"
 #include "gennExport.h"
 #include "varLocation.h"
+#include "varTrace.h"
 
 // Forward declarations
 namespace GeNN
@@ -45,6 +47,11 @@ public:
     /*! This should either be 'Isyn' or the name of one of the target neuron's additional input variables. */
     void setTargetVar(const std::string &varName);
 
+    //! Enable recording of trace of current source state variable
+    /*! Every interval timesteps, the values of the variable in the target neurons specified by neuronIDs are
+        written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace. */
+    void setVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval = 1);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -66,10 +73,17 @@ public:
     //! Is parameter dynamic i.e. it can be changed at runtime
     bool isParamDynamic(const std::string &paramName) const{ return m_DynamicParams.get(paramName); }
 
+    //! Has variable been demoted to a constant, meaning no array is allocated for it?
+    /*! \note this can only be called after model is finalized */
+    bool isVarDemoted(const std::string &varName) const{ return (m_DemotedVars.count(varName) != 0); }
+
     //! Get name of neuron input variable current source model will inject into.
     /*! This will either be 'Isyn' or the name of one of the target neuron's additional input variables. */
     const std::string &getTargetVar() const { return m_TargetVar; }
 
+    //! Get traces of current source state variables recorded
+    const auto &getVarTraces() const{ return m_VarTraces.get(); }
+
 protected:
     CurrentSource(const std::string &name, const CurrentSourceModels::Base *model,
                   const std::map<std::string, Type::NumericValue> &params, const std::map<std::string, InitVarSnippet::Init> &varInitialisers,
@@ -81,6 +95,12 @@ protected:
     //------------------------------------------------------------------------
     void finalise(double dt);
 
+    //! Mark a variable as being referenced from elsewhere in the model so it can't be demoted to a constant
+    void setVarReferenced(const std::string &varName){ m_ReferencedVars.insert(varName); }
+
+    //! Demote read-only variables initialised to a constant to constants
+    void demoteConstantReadOnlyVars();
+
     //------------------------------------------------------------------------
     // Protected const methods
     //------------------------------------------------------------------------
@@ -139,6 +159,15 @@ private:
     /*! This should either be 'Isyn' or the name of one of the target neuron's additional input variables. */
     std::string m_TargetVar;
 
+    //! Traces of current source state variables being recorded
+    VarTraceContainer m_VarTraces;
+
+    //! Set of names of variables referenced from elsewhere in the model
+    std::set<std::string> m_ReferencedVars;
+
+    //! Set of names of variables demoted to constants
+    std::set<std::string> m_DemotedVars;
+
     //! Tokens produced by scanner from injection code
     std::vector<Transpiler::Token> m_InjectionCodeTokens;
 };
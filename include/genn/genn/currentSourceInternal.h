@@ -24,6 +24,8 @@ public:
 
     using CurrentSource::getTrgNeuronGroup;
     using CurrentSource::finalise;
+    using CurrentSource::setVarReferenced;
+    using CurrentSource::demoteConstantReadOnlyVars;
     using CurrentSource::getDerivedParams;
     using CurrentSource::isZeroCopyEnabled;
     using CurrentSource::isVarInitRequired;
@@ -47,7 +49,24 @@ public:
     //----------------------------------------------------------------------------
     VarLocation getLoc(const std::string &varName) const{ return m_CS.getVarLocation(varName); }
 
-    auto getDefs() const{ return m_CS.getModel()->getVars(); }
+    auto getDefs() const
+    { 
+        // **NOTE** variables demoted to constants have no arrays so are excluded
+        auto vars = m_CS.getModel()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return m_CS.isVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
+
+    auto getDemotedDefs() const
+    { 
+        auto vars = m_CS.getModel()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return !m_CS.isVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
 
     const auto &getInitialisers() const{ return m_CS.getVarInitialisers(); }
 
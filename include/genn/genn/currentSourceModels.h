@@ -127,4 +127,42 @@ class PoissonExp : public Base
         {"Init", [](const ParamValues &pars, double dt){ return pars.at("weight").cast<double>() * (1.0 - std::exp(-dt / pars.at("tauSyn").cast<double>())) * (pars.at("tauSyn").cast<double>() / dt); }},
         {"ExpMinusLambda", [](const ParamValues &pars, double dt){ return std::exp(-(pars.at("rate").cast<double>() / 1000.0) * dt); }}});
 };
+
+//----------------------------------------------------------------------------
+// CurrentSourceModels::AggregatedPoissonExp
+//----------------------------------------------------------------------------
+//! Current source for injecting a current equivalent to several classes of
+//! Poisson spike sources, connected with exponential synapses
+/*! Rather than simulating each source, the number of spikes arriving from each class 
+    every timestep is drawn directly from a Poisson distribution with mean K * nu * dt,
+    where K is the number of sources in the class and nu is their mean firing rate.
+    It has 2 parameters:
+
+    - \c tauSyn      - decay time constant [ms]
+    - \c numClasses  - number of classes of Poisson spike sources
+
+    and 2 extra global parameters, each with \c numClasses entries:
+
+    - \c weight  - synaptic weight of the Poisson spikes in each class [nA]
+    - \c rate    - total mean firing rate K * nu of the Poisson spike sources in each class [Hz]
+*/
+class AggregatedPoissonExp : public Base
+{
+    DECLARE_SNIPPET(AggregatedPoissonExp);
+
+    SET_INJECTION_CODE(
+        "for(unsigned int c = 0; c < numClasses; c++) {\n"
+        "    current += Init * weight[c] * (scalar)gennrand_poisson(rate[c] * RateToLambda);\n"
+        "}\n"
+        "injectCurrent(current);\n"
+        "current *= ExpDecay;\n");
+
+    SET_PARAMS({"tauSyn", {"numClasses", "unsigned int"}});
+    SET_VARS({{"current", "scalar"}});
+    SET_EXTRA_GLOBAL_PARAMS({{"weight", "scalar*"}, {"rate", "scalar*"}});
+    SET_DERIVED_PARAMS({
+        {"ExpDecay", [](const ParamValues &pars, double dt){ return std::exp(-dt / pars.at("tauSyn").cast<double>()); }},
+        {"Init", [](const ParamValues &pars, double dt){ return (1.0 - std::exp(-dt / pars.at("tauSyn").cast<double>())) * (pars.at("tauSyn").cast<double>() / dt); }},
+        {"RateToLambda", [](const ParamValues&, double dt){ return dt / 1000.0; }}});
+};
 } // GeNN::CurrentSourceModels
@@ -24,6 +24,7 @@ Part of the code generation and generated code sections.
 #pragma once
 
 // Standard C++ includes
+#include <functional>
 #include <map>
 #include <optional>
 #include <set>
@@ -298,6 +299,18 @@ public:
     //! Set whether timers and timing commands are to be included
     void setTimingEnabled(bool timingEnabled){ m_TimingEnabled = timingEnabled; }
 
+    //! Set whether per-merged-group profiling counters are to be included
+    /*! These record time, neurons processed, spikes emitted and synapses traversed for every 
+        population in every merged update group. **NOTE** currently only implemented by the single-threaded CPU backend;
+        other backends throw when the model is merged */
+    void setProfilingEnabled(bool profilingEnabled){ m_ProfilingEnabled = profilingEnabled; }
+
+    //! Set whether exp, expm1, log and tanh should be replaced by faster, vectorisable approximations, and an approximate sigmoid provided, in all simulation code
+    /*! See CodeGenerator::StandardLibrary::getApproximateMathsFunctions for error bounds. 
+        Can also be enabled for individual neuron groups with NeuronGroup::setApproximateMathsEnabled.
+        **NOTE** currently only implemented by the single-threaded CPU backend */
+    void setApproximateMathsEnabled(bool enabled){ m_ApproximateMathsEnabled = enabled; }
+
     //! Set the random seed (disables automatic seeding if argument not 0).
     void setSeed(unsigned int rngSeed){ m_Seed = rngSeed; }
 
@@ -324,8 +337,17 @@ public:
     /*! This can significantly reduce the cost of updating neuron populations but means that per-synaptic group per and postsynaptic variables cannot be retrieved */
     void setFusePrePostWeightUpdateModels(bool fuse){ m_FusePrePostWeightUpdateModels = fuse; }
 
+    //! Should read-only variables initialised to a constant be demoted to constants?
+    /*! This reduces memory usage and bandwidth but means that demoted variables cannot be retrieved or modified at runtime */
+    void setDemoteConstantReadOnlyVars(bool demote){ m_DemoteConstantReadOnlyVars = demote; }
+
     void setBatchSize(unsigned int batchSize) { m_BatchSize = batchSize;  }
 
+    //! Set memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO
+    /*! Synapse groups are resolved in name order and each uses the fastest compatible matrix type which fits
+        within the remaining budget or, if none do, the one which uses the least memory. By default the budget is unlimited. */
+    void setAutoMatrixMemoryBudget(size_t budget){ m_AutoMatrixMemoryBudget = budget; }
+
     //! Gets the name of the neuronal network model
     const std::string &getName() const{ return m_Name; }
 
@@ -344,8 +366,17 @@ public:
     //! Are timers and timing commands enabled
     bool isTimingEnabled() const{ return m_TimingEnabled; }
 
+    //! Are per-merged-group profiling counters enabled
+    bool isProfilingEnabled() const{ return m_ProfilingEnabled; }
+
+    //! Are approximate maths functions used in all simulation code
+    bool isApproximateMathsEnabled() const{ return m_ApproximateMathsEnabled; }
+
     unsigned int getBatchSize() const { return m_BatchSize;  }
 
+    //! Gets memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO
+    size_t getAutoMatrixMemoryBudget() const{ return m_AutoMatrixMemoryBudget; }
+
     // PUBLIC NEURON FUNCTIONS
     //========================
     //! How many neurons make up the entire model
@@ -581,7 +612,9 @@ protected:
     // Protected methods
     //--------------------------------------------------------------------------
     //! Finalise model
-    void finalise();
+    /*! Synapse groups with SynapseMatrixType::AUTO are resolved to matrix types for which 
+        isMatrixTypeSupported returns true or, if it is not provided, to any matrix type */
+    void finalise(const std::function<bool(SynapseMatrixType)> &isMatrixTypeSupported = {});
 
     //--------------------------------------------------------------------------
     // Protected const methods
@@ -657,6 +690,12 @@ private:
     //! Whether timing code should be inserted into model
     bool m_TimingEnabled;
 
+    //! Whether per-merged-group profiling counters should be inserted into model
+    bool m_ProfilingEnabled;
+
+    //! Whether approximate maths functions should be used in all simulation code
+    bool m_ApproximateMathsEnabled;
+
     //! RNG seed
     unsigned int m_Seed;
 
@@ -682,7 +721,14 @@ private:
     /*! This can significantly reduce the cost of updating neuron populations but means that per-synaptic group per and postsynaptic variables cannot be retrieved */
     bool m_FusePrePostWeightUpdateModels;
 
+    //! Should read-only variables initialised to a constant be demoted to constants?
+    /*! This reduces memory usage and bandwidth but means that demoted variables cannot be retrieved or modified at runtime */
+    bool m_DemoteConstantReadOnlyVars;
+
     //! Batch size of this model - efficiently duplicates model
     unsigned int m_BatchSize;
+
+    //! Memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO
+    size_t m_AutoMatrixMemoryBudget;
 };
 }   // namespace GeNN
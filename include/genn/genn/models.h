@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <functional>
 #include <optional>
+#include <set>
 #include <string>
 #include <variant>
 #include <vector>
@@ -552,4 +553,10 @@ void resolveVarReferences(const std::map<std::string, std::variant<std::string,
 GENN_EXPORT void checkEGPReferenceTypes(const std::map<std::string, EGPReference> &egpRefs,
                                         const Base::EGPRefVec &modelEGPRefs);
 
+//! Helper function to find read-only variables which are initialised to a constant
+//! and can therefore be demoted from arrays to constants, unless they are excluded
+GENN_EXPORT std::set<std::string> getConstantReadOnlyVars(const std::vector<Base::Var> &vars,
+                                                          const std::map<std::string, InitVarSnippet::Init> &varInitialisers,
+                                                          const std::set<std::string> &excludedVars);
+
 } // GeNN::Models
@@ -10,6 +10,7 @@
 #include "gennExport.h"
 #include "neuronModels.h"
 #include "varLocation.h"
+#include "varTrace.h"
 
 // Forward declarations
 namespace GeNN
@@ -78,6 +79,29 @@ public:
     //! Enables and disable spike event recording for this population
     void setSpikeEventRecordingEnabled(bool enabled) { m_SpikeEventRecordingEnabled = enabled; }
 
+    //! Enables and disable recording of the number of spikes emitted by this population each timestep
+    /*! Unlike spike recording, this only requires a single counter per timestep rather than a bit per neuron */
+    void setSpikeCountRecordingEnabled(bool enabled) { m_SpikeCountRecordingEnabled = enabled; }
+
+    //! Set time constant (in ms) of exponentially-decaying per-neuron firing rate estimator
+    /*! A time constant of zero disables rate estimation. Estimated rates (in Hz) are stored in the 'spkRate' array */
+    void setSpikeRateTau(double tau);
+
+    //! Configure per-population inter-spike interval histogram
+    /*! Histogram consists of numBins bins, each binWidth ms wide, stored in the 'isiHist' array. 
+        The final bin counts all intervals that exceed the range of the histogram. Zero bins disables the histogram. */
+    void setISIHistogram(unsigned int numBins, double binWidth);
+
+    //! Set whether exp, expm1, log and tanh should be replaced by faster, vectorisable approximations, and an approximate sigmoid provided, in this population's update code
+    /*! This includes the code of any current sources and postsynaptic models which are updated alongside it.
+        **NOTE** currently only implemented by the single-threaded CPU backend */
+    void setApproximateMathsEnabled(bool enabled){ m_ApproximateMathsEnabled = enabled; }
+
+    //! Enable recording of trace of neuron model state variable
+    /*! Every interval timesteps, the values of the variable in the neurons specified by neuronIDs are
+        written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace. */
+    void setVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval = 1);
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -134,12 +158,40 @@ public:
     //! Is parameter dynamic i.e. it can be changed at runtime
     bool isParamDynamic(const std::string &paramName) const{ return m_DynamicParams.get(paramName); }
 
+    //! Has variable been demoted to a constant, meaning no array is allocated for it?
+    /*! \note this can only be called after model is finalized */
+    bool isVarDemoted(const std::string &varName) const{ return (m_DemotedVars.count(varName) != 0); }
+
     //! Is spike recording enabled for this population?
     bool isSpikeRecordingEnabled() const { return m_SpikeRecordingEnabled; }
 
     //! Is spike event recording enabled for this population?
     bool isSpikeEventRecordingEnabled() const { return m_SpikeEventRecordingEnabled; }
 
+    //! Is spike count recording enabled for this population?
+    bool isSpikeCountRecordingEnabled() const { return m_SpikeCountRecordingEnabled; }
+
+    //! Get time constant (in ms) of per-neuron firing rate estimator
+    double getSpikeRateTau() const { return m_SpikeRateTau; }
+
+    //! Is per-neuron firing rate estimation enabled for this population?
+    bool isSpikeRateEstimationEnabled() const { return (m_SpikeRateTau > 0.0); }
+
+    //! Get number of bins in inter-spike interval histogram
+    unsigned int getISIHistogramNumBins() const { return m_ISIHistogramNumBins; }
+
+    //! Get width (in ms) of inter-spike interval histogram bins
+    double getISIHistogramBinWidth() const { return m_ISIHistogramBinWidth; }
+
+    //! Is inter-spike interval histogram enabled for this population?
+    bool isISIHistogramEnabled() const { return (m_ISIHistogramNumBins > 0); }
+
+    //! Get traces of neuron model state variables recorded for this population
+    const auto &getVarTraces() const{ return m_VarTraces.get(); }
+
+    //! Are approximate maths functions used in this population's update code?
+    bool isApproximateMathsEnabled() const{ return m_ApproximateMathsEnabled; }
+
 protected:
     NeuronGroup(const std::string &name, int numNeurons, const NeuronModels::Base *neuronModel,
                 const std::map<std::string, Type::NumericValue> &params, const std::map<std::string, InitVarSnippet::Init> &varInitialisers,
@@ -154,6 +206,12 @@ protected:
     // Set a variable as requiring queueing
     void setVarQueueRequired(const std::string &varName){ m_VarQueueRequired.insert(varName); }
 
+    //! Mark a variable as being referenced from elsewhere in the model so it can't be demoted to a constant
+    void setVarReferenced(const std::string &varName){ m_ReferencedVars.insert(varName); }
+
+    //! Demote read-only variables initialised to a constant to constants
+    void demoteConstantReadOnlyVars();
+
     void setSpikeQueueRequired(){ m_SpikeQueueRequired = true; }
     void setSpikeEventQueueRequired(){ m_SpikeEventQueueRequired = true; }
 
@@ -283,6 +341,12 @@ private:
     //! Set of names of variable requiring queueing
     std::set<std::string> m_VarQueueRequired;
 
+    //! Set of names of variables referenced from elsewhere in the model
+    std::set<std::string> m_ReferencedVars;
+
+    //! Set of names of variables demoted to constants
+    std::set<std::string> m_DemotedVars;
+
     //! Is queueing required for spikes?
     bool m_SpikeQueueRequired;
 
@@ -342,5 +406,23 @@ private:
 
     //! Is spike event recording enabled?
     bool m_SpikeEventRecordingEnabled;
+
+    //! Is spike count recording enabled?
+    bool m_SpikeCountRecordingEnabled;
+
+    //! Time constant of firing rate estimator (zero if disabled)
+    double m_SpikeRateTau;
+
+    //! Number of bins in inter-spike interval histogram (zero if disabled)
+    unsigned int m_ISIHistogramNumBins;
+
+    //! Width of inter-spike interval histogram bins
+    double m_ISIHistogramBinWidth;
+
+    //! Traces of neuron model state variables being recorded
+    VarTraceContainer m_VarTraces;
+
+    //! Should approximate maths functions be used in update code?
+    bool m_ApproximateMathsEnabled;
 };
 }   // namespace GeNN
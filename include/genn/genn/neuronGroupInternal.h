@@ -23,6 +23,8 @@ public:
     
     using NeuronGroup::checkNumDelaySlots;
     using NeuronGroup::setVarQueueRequired;
+    using NeuronGroup::setVarReferenced;
+    using NeuronGroup::demoteConstantReadOnlyVars;
     using NeuronGroup::setSpikeQueueRequired;
     using NeuronGroup::setSpikeEventQueueRequired;
     using NeuronGroup::addInSyn;
@@ -76,7 +78,24 @@ public:
     //----------------------------------------------------------------------------
     VarLocation getLoc(const std::string &varName) const{ return m_NG.getVarLocation(varName); }
     
-    auto getDefs() const{ return m_NG.getModel()->getVars(); }
+    auto getDefs() const
+    { 
+        // **NOTE** variables demoted to constants have no arrays so are excluded
+        auto vars = m_NG.getModel()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return m_NG.isVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
+
+    auto getDemotedDefs() const
+    { 
+        auto vars = m_NG.getModel()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return !m_NG.isVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
 
     const auto &getInitialisers() const{ return m_NG.getVarInitialisers(); }
 
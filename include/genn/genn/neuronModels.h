@@ -21,6 +21,9 @@
 #define SET_RESET_CODE(RESET_CODE) virtual std::string getResetCode() const override{ return RESET_CODE; }
 #define SET_ADDITIONAL_INPUT_VARS(...) virtual ParamValVec getAdditionalInputVars() const override{ return __VA_ARGS__; }
 #define SET_NEEDS_AUTO_REFRACTORY(AUTO_REFRACTORY_REQUIRED) virtual bool isAutoRefractoryRequired() const override{ return AUTO_REFRACTORY_REQUIRED; }
+#define SET_LINEAR_DYNAMICS(...) virtual LinearDynamics getLinearDynamics() const override{ return __VA_ARGS__; }
+#define SET_NONLINEAR_DYNAMICS(...) virtual std::vector<ODE> getNonlinearDynamics() const override{ return __VA_ARGS__; }
+#define SET_NONLINEAR_DYNAMICS_SUBSTEPS(NUM_SUBSTEPS) virtual unsigned int getNumNonlinearDynamicsSubsteps() const override{ return NUM_SUBSTEPS; }
 
 //----------------------------------------------------------------------------
 // GeNN::NeuronModels::Base
@@ -31,6 +34,44 @@ namespace GeNN::NeuronModels
 class GENN_EXPORT Base : public Models::Base
 {
 public:
+    //----------------------------------------------------------------------------
+    // Structs
+    //----------------------------------------------------------------------------
+    //! A system of linear ODEs, dx/dt = Ax + b, which is integrated exactly. 
+    /*! The coefficient matrix A is calculated (in row-major order) from the parameters and timestep and
+        the propagators required to advance the system by one timestep are calculated once, from this,
+        as derived parameters. Each input b is a code string (which may be empty) evaluated at the start
+        of each timestep and assumed constant across it e.g. "(Isyn + Ioffset) / C" */
+    struct GENN_EXPORT LinearDynamics
+    {
+        typedef std::function<std::vector<double>(const ParamValues&, double)> CoefficientsFunc;
+
+        LinearDynamics() = default;
+        LinearDynamics(const std::vector<std::string> &v, CoefficientsFunc c, const std::vector<std::string> &i)
+        :   vars(v), coefficients(c), inputs(i)
+        {}
+
+        std::vector<std::string> vars;
+        CoefficientsFunc coefficients;
+        std::vector<std::string> inputs;
+    };
+
+    //! A nonlinear ODE, dx/dt = f(x), consisting of the name of the 
+    //! variable x and a code string expression for its derivative f(x)
+    struct GENN_EXPORT ODE
+    {
+        ODE(const std::string &v, const std::string &d) : var(v), derivative(d)
+        {}
+
+        bool operator == (const ODE &other) const
+        {
+            return (std::tie(var, derivative) == std::tie(other.var, other.derivative));
+        }
+
+        std::string var;
+        std::string derivative;
+    };
+
     //----------------------------------------------------------------------------
     // Declared virtuals
     //----------------------------------------------------------------------------
@@ -56,6 +97,16 @@ public:
     //! Does this model require auto-refractory logic?
     virtual bool isAutoRefractoryRequired() const{ return false; }
 
+    //! Gets system of linear ODEs which will be integrated exactly at the start of each timestep
+    virtual LinearDynamics getLinearDynamics() const{ return {}; }
+
+    //! Gets nonlinear ODEs which will be integrated using the classical 4th-order Runge-Kutta 
+    //! method after any linear dynamics but before the sim code at each timestep
+    virtual std::vector<ODE> getNonlinearDynamics() const{ return {}; }
+
+    //! Gets number of Runge-Kutta substeps used to integrate nonlinear dynamics each timestep
+    virtual unsigned int getNumNonlinearDynamicsSubsteps() const{ return 1; }
+
     //----------------------------------------------------------------------------
     // Public API
     //----------------------------------------------------------------------------
@@ -68,6 +119,12 @@ public:
         return getNamed(varName, getVars());
     }
 
+    //! Get derived parameters used to hold the propagators of any linear dynamics
+    Snippet::Base::DerivedParamVec getLinearDynamicsDerivedParams() const;
+
+    //! Get code to integrate any linear and nonlinear dynamics, which is inserted before the sim code
+    std::string getDynamicsCode() const;
+
     //! Validate names of parameters etc
     void validate(const std::map<std::string, Type::NumericValue> &paramValues, 
                   const std::map<std::string, InitVarSnippet::Init> &varValues,
@@ -0,0 +1,112 @@
+#pragma once
+
+// Standard C++ includes
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// GeNN includes
+#include "gennExport.h"
+
+// GeNN runtime includes
+#include "runtime/runtime.h"
+
+namespace GeNN::Runtime
+{
+//--------------------------------------------------------------------------
+// GeNN::Runtime::Ensemble
+//--------------------------------------------------------------------------
+//! Ensemble of independent replicas of a single compiled model,
+//! for running parameter sweeps without rebuilding or reloading
+/*! Each replica is a Runtime with its own instance context so this requires
+    a backend which generates re-entrant code. Replicas can have their own values
+    for dynamic parameters and their own host RNG streams but share connectivity,
+    which is initialised once by the first replica. Connectivity which can change at runtime
+    is copied from the first replica to the others rather than shared. Replicas are simulated
+    by a pool of worker threads, started when the ensemble is allocated */
+class GENN_EXPORT Ensemble
+{
+public:
+    Ensemble(const filesystem::path &modelPath, const CodeGenerator::ModelSpecMerged &modelMerged,
+             const CodeGenerator::BackendBase &backend, size_t numReplicas);
+    Ensemble(const Ensemble&) = delete;
+    Ensemble(Ensemble&&) = delete;
+    ~Ensemble();
+
+    //----------------------------------------------------------------------------
+    // Public API
+    //----------------------------------------------------------------------------
+    //! Allocate memory required for all replicas
+    /*! If seeds are provided, one is required per replica. Otherwise, if the model
+        has a seed, replica i is seeded with the model seed plus i and, if not,
+        each replica is seeded from system randomness. */
+    void allocate(std::optional<size_t> numRecordingTimesteps = std::nullopt,
+                  const std::vector<unsigned int> &seeds = {});
+
+    //! Initialise all replicas, copying any sparse connectivity of the first which isn't shared to the others
+    void initialize();
+
+    //! Initialise parts of all replicas which rely on sparse connectivity
+    void initializeSparse();
+
+    //! Simulate all replicas for a number of timesteps, each on its own thread
+    /*! Any exception thrown while simulating a replica is rethrown on the calling thread */
+    void stepTime(unsigned int numTimesteps = 1);
+
+    //! Perform named custom update in all replicas
+    void customUpdate(const std::string &name);
+
+    //! Pull recording buffers for all replicas from device
+    void pullRecordingBuffersFromDevice() const;
+
+    size_t getNumReplicas() const{ return m_Replicas.size(); }
+
+    //! Get runtime used to access the state of one replica
+    Runtime &getReplica(size_t i){ return *m_Replicas.at(i); }
+    const Runtime &getReplica(size_t i) const{ return *m_Replicas.at(i); }
+
+private:
+    //----------------------------------------------------------------------------
+    // Private methods
+    //----------------------------------------------------------------------------
+    //! Body of worker thread which simulates one replica each time workers are started
+    void workerThread(Runtime &replica);
+
+    //----------------------------------------------------------------------------
+    // Members
+    //----------------------------------------------------------------------------
+    //! Reference to merged model being run
+    std::reference_wrapper<const CodeGenerator::ModelSpecMerged> m_ModelMerged;
+
+    //! Runtimes of each replica
+    std::vector<std::unique_ptr<Runtime>> m_Replicas;
+
+    //! Worker threads used to simulate all but the first replica
+    std::vector<std::thread> m_Workers;
+
+    //! Mutex protecting worker state and condition variables used to start workers and wait for them to finish
+    std::mutex m_WorkerMutex;
+    std::condition_variable m_WorkerStart;
+    std::condition_variable m_WorkerFinish;
+
+    //! Incremented each time workers are started
+    unsigned long long m_WorkerGeneration;
+
+    //! Number of timesteps workers should simulate
+    unsigned int m_WorkerNumTimesteps;
+
+    //! Number of workers yet to finish simulating
+    size_t m_NumWorkersRunning;
+
+    //! Flag set to shut down workers
+    bool m_StopWorkers;
+
+    //! First exception thrown by a worker
+    std::exception_ptr m_WorkerException;
+};
+}
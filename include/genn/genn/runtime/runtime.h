@@ -1,11 +1,13 @@
 #pragma once
 
 // Standard C++ includes
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 // Platform includes
 #ifdef _WIN32
@@ -241,6 +243,12 @@ public:
         return m_DestinationFields; 
     }
 
+    //! Get value most recently set at runtime, if any
+    const std::optional<Type::NumericValue> &getValue() const{ return m_Value; }
+
+    //! Record value set at runtime so it is preserved if merged groups are re-pushed
+    void setValue(const Type::NumericValue &value){ m_Value = value; }
+
     template<typename G>
     void addDestinationField(size_t mergedGroupIndex, size_t groupIndex, 
                              const Type::ResolvedType &fieldDataType, const std::string &fieldName, 
@@ -262,6 +270,9 @@ private:
     //! Multimap of merged group types e.g. "PostsynapticUpdate"
     // to fields within them that point to the dynamic variable/parameter
     std::unordered_multimap<std::string, MergedDynamicField> m_DestinationFields;
+
+    //! Value most recently set at runtime
+    std::optional<Type::NumericValue> m_Value;
 };
 
 //--------------------------------------------------------------------------
@@ -272,7 +283,8 @@ class GENN_EXPORT Runtime
     //--------------------------------------------------------------------------
     // Type defines
     //--------------------------------------------------------------------------
-    using ArrayMap = std::unordered_map<std::string, std::unique_ptr<ArrayBase>>;
+    //! **NOTE** arrays are reference counted so instances of a model can share read-only connectivity
+    using ArrayMap = std::unordered_map<std::string, std::shared_ptr<ArrayBase>>;
     
     template<typename G>
     using GroupArrayMap = std::unordered_map<const G*, ArrayMap>;
@@ -285,6 +297,34 @@ class GENN_EXPORT Runtime
     IMPLEMENT_GROUP_OVERLOADS(CustomUpdateBase)
     IMPLEMENT_GROUP_OVERLOADS(CustomConnectivityUpdate)
 public:
+    //! Profiling counters recorded for one population within a merged update group
+    struct ProfileEntry
+    {
+        //! Name of merged group type e.g. "NeuronUpdate" or "PresynapticUpdate"
+        std::string kernel;
+
+        //! Index of merged group
+        size_t mergedGroupIndex;
+
+        //! Name of population
+        std::string population;
+
+        //! Total time spent updating population [s]
+        double time;
+
+        //! Number of times population has been updated
+        unsigned long long calls;
+
+        //! Total neurons (or custom update elements) processed
+        unsigned long long neurons;
+
+        //! Total spikes emitted (neuron update) or processed (synapse update)
+        unsigned long long spikes;
+
+        //! Total synapses traversed
+        unsigned long long synapses;
+    };
+
     Runtime(const filesystem::path &modelPath, const CodeGenerator::ModelSpecMerged &modelMerged, 
             const CodeGenerator::BackendBase &backend);
     Runtime(const Runtime&) = delete;
@@ -295,7 +335,17 @@ public:
     // Public API
     //----------------------------------------------------------------------------
     //! Allocate memory required for model
-    void allocate(std::optional<size_t> numRecordingTimesteps = std::nullopt);
+    /*! If connectivitySource is provided, this instance does not initialise connectivity built by initialisation
+        snippets. Synapse groups whose connectivity never changes share connectivitySource's arrays and others'
+        must be copied from it before initializeSparse. This is only supported if backend generates code with
+        an instance context and connectivity built alongside kernel variables is always initialised. */
+    void allocate(std::optional<size_t> numRecordingTimesteps = std::nullopt,
+                  const Runtime *connectivitySource = nullptr);
+
+    //! Reseed the host RNG used by this instance of the model
+    /*! Only supported if backend generates code with an instance context
+        as, otherwise, RNG state is shared between all instances */
+    void seedHostRNG(unsigned int seed);
 
     //! Initialise model
     void initialize();
@@ -321,15 +371,28 @@ public:
     //! Get backend-specific state
     StateBase *getState(){ return m_State.get(); }
 
-    double getNeuronUpdateTime() const{ return *(double*)getSymbol("neuronUpdateTime"); }
-    double getInitTime() const{ return *(double*)getSymbol("initTime"); }
-    double getPresynapticUpdateTime() const{ return *(double*)getSymbol("presynapticUpdateTime"); }
-    double getPostsynapticUpdateTime() const{ return *(double*)getSymbol("postsynapticUpdateTime"); }
-    double getSynapseDynamicsTime() const{ return *(double*)getSymbol("synapseDynamicsTime"); }
-    double getInitSparseTime() const{ return *(double*)getSymbol("initSparseTime"); }
-    double getCustomUpdateTime(const std::string &name) const{ return *(double*)getSymbol("customUpdate" + name + "Time"); }
-    double getCustomUpdateTransposeTime(const std::string &name) const{ return *(double*)getSymbol("customUpdate" + name + "TransposeTime"); }
-    double getCustomUpdateRemapTime(const std::string &name) const{ return *(double*)getSymbol("customUpdate" + name + "RemapTime"); }
+    double getNeuronUpdateTime() const{ return *(double*)getContextSymbol("neuronUpdateTime"); }
+    double getInitTime() const{ return *(double*)getContextSymbol("initTime"); }
+    double getPresynapticUpdateTime() const{ return *(double*)getContextSymbol("presynapticUpdateTime"); }
+    double getPostsynapticUpdateTime() const{ return *(double*)getContextSymbol("postsynapticUpdateTime"); }
+    double getSynapseDynamicsTime() const{ return *(double*)getContextSymbol("synapseDynamicsTime"); }
+    double getInitSparseTime() const{ return *(double*)getContextSymbol("initSparseTime"); }
+    double getCustomUpdateTime(const std::string &name) const{ return *(double*)getContextSymbol("customUpdate" + name + "Time"); }
+    double getCustomUpdateTransposeTime(const std::string &name) const{ return *(double*)getContextSymbol("customUpdate" + name + "TransposeTime"); }
+    double getCustomUpdateRemapTime(const std::string &name) const{ return *(double*)getContextSymbol("customUpdate" + name + "RemapTime"); }
+
+    //! Get profiling counters for every population in every merged update group
+    /*! Only available if ModelSpec::setProfilingEnabled has been called */
+    std::vector<ProfileEntry> getProfile() const;
+
+    //! Zero all profiling counters
+    void resetProfile();
+
+    //! Write profiling counters to file in Chrome trace event format
+    /*! The resulting JSON file can be loaded into chrome://tracing or https://ui.perfetto.dev.
+        As counters are accumulated, each population is represented by a single event
+        whose duration is the total time spent updating it, laid end-to-end on a track per kernel */
+    void writeProfileTrace(const std::string &path) const;
     
     void pullRecordingBuffersFromDevice() const;
 
@@ -339,6 +402,16 @@ public:
         return m_DelayQueuePointer.at(&group);
     }
 
+    //! Get current stride between the rows of a synapse group's synaptic matrix
+    /*! If the synapse group's row capacity is growable, this changes when its rows are reallocated 
+        after sparse initialisation or after custom updates which modify its connectivity */
+    size_t getSynapticMatrixRowStride(const SynapseGroup &group) const;
+
+    //! Get number of events dropped because a bucket of synapse group's dendritic delay timing wheel was full
+    /*! This is only non-zero if asserts are disabled in generated code, i.e. it is built with -DNDEBUG.
+        If synapse group's postsynaptic model is fused, the count is shared with the groups it is fused with. */
+    uint32_t getDendriticDelayWheelOverflow(const SynapseGroup &group) const;
+
     //! Get recorded spikes from neuron group
     BatchEventArray getRecordedSpikes(const NeuronGroup &group) const
     {
@@ -362,6 +435,42 @@ public:
                                  getFusedTrgSpikeEventArray(groupInternal, "RecordSpkEvent"));
     }
 
+    //! Set sparse connectivity of synapse group from arrays of pre and postsynaptic indices
+    /*! Connectivity is built directly in the host rowLength and ind arrays using a counting sort
+        so no intermediate copies of the connectivity are made. Within each row, synapses are sorted 
+        by postsynaptic index. If synapseOrder is provided, the index (into preInds and postInds) of 
+        each synapse, in the order they are stored in the ragged structure, is written to it.
+        Must be called before initializeSparse or be followed by pushing connectivity to device. */
+    void setSparseConnections(const SynapseGroup &group, const unsigned int *preInds, const unsigned int *postInds,
+                              size_t numSynapses, size_t *synapseOrder = nullptr);
+
+    //! Get number of spikes emitted by neuron group in each recorded timestep, for each batch
+    std::vector<std::vector<uint32_t>> getRecordedSpikeCounts(const NeuronGroup &group) const;
+
+    //! Get recording buffer containing trace of neuron model state variable
+    /*! Samples are stored contiguously, laid out as [sample][batch][traced neuron] */
+    ArrayBase *getRecordedVarTrace(const NeuronGroup &group, const std::string &varName) const
+    {
+        checkRecordedVarTrace(group.getVarTraces(), varName);
+        return getArray(group, "recordTrace" + varName);
+    }
+
+    //! Get recording buffer containing trace of current source state variable
+    /*! Samples are stored contiguously, laid out as [sample][batch][traced neuron] */
+    ArrayBase *getRecordedVarTrace(const CurrentSource &group, const std::string &varName) const
+    {
+        checkRecordedVarTrace(group.getVarTraces(), varName);
+        return getArray(group, "recordTrace" + varName);
+    }
+
+    //! Get recording buffer containing trace of postsynaptic model state variable
+    /*! Samples are stored contiguously, laid out as [sample][batch][traced neuron] */
+    ArrayBase *getRecordedPSVarTrace(const SynapseGroup &group, const std::string &varName) const
+    {
+        checkRecordedVarTrace(group.getPSVarTraces(), varName);
+        return getArray(group, "recordTrace" + varName);
+    }
+
     //! Write recorded spikes to CSV file
     void writeRecordedSpikes(const NeuronGroup &group, const std::string &path) const
     {
@@ -405,13 +514,30 @@ public:
    
     void *getSymbol(const std::string &symbolName, bool allowMissing = false) const;
 
+    //! Get pointer to state variable generated by model, which is
+    //! held in the instance context if backend enables one
+    void *getContextSymbol(const std::string &symbolName) const;
+
 private:
     //----------------------------------------------------------------------------
     // Type defines
     //----------------------------------------------------------------------------
     typedef void (*VoidFunction)(void);
-    typedef void (*StepTimeFunction)(unsigned long long, unsigned long long);
-    typedef void (*CustomUpdateFunction)(unsigned long long);
+    typedef void *(*AllocateContextFunction)(void);
+    typedef void *(*GetContextSymbolFunction)(void*, const char*);
+    typedef void (*SeedContextFunction)(void*, unsigned int);
+    typedef const char *(*GetStringFunction)(void);
+
+    //! Layout of the profiling counters generated for each population
+    //! **NOTE** this must match the GeNNProfileCounters structure generated in definitions.h
+    struct ProfileCounters
+    {
+        double time;
+        unsigned long long calls;
+        unsigned long long neurons;
+        unsigned long long spikes;
+        unsigned long long synapses;
+    };
 
     //! Map of arrays to destinations in merged structures
     using MergedDynamicArrayMap = std::map<const ArrayBase*, MergedDynamicFieldDestinations>;
@@ -427,12 +553,57 @@ private:
 
     void createArray(ArrayMap &groupArrays, const std::string &varName, const Type::ResolvedType &type, 
                      size_t count, VarLocation location, bool uninitialized = false, unsigned int logIndent = 1);
+    void shareArray(const Runtime &source, const SynapseGroup &group, const std::string &varName);
     void createDynamicParamDestinations(std::unordered_map<std::string, std::pair<Type::ResolvedType, MergedDynamicFieldDestinations>> &destinations, 
                                         const std::string &paramName, const Type::ResolvedType &type, unsigned int logIndent = 1);
     BatchEventArray getRecordedEvents(unsigned int numNeurons, ArrayBase *array) const;
 
+    void checkRecordedVarTrace(const std::map<std::string, VarTrace> &traces, const std::string &varName) const;
+
     void writeRecordedEvents(unsigned int numNeurons, ArrayBase *array, const std::string &path) const;
 
+    //! Call entry point in generated code, passing instance context as first argument if there is one
+    template<typename... Args>
+    void callEntryPoint(void *function, Args... args) const
+    {
+        if(m_Context) {
+            reinterpret_cast<void(*)(void*, Args...)>(function)(m_Context, args...);
+        }
+        else {
+            reinterpret_cast<void(*)(Args...)>(function)(args...);
+        }
+    }
+
+    //! Get pointer to profiling counters generated for merged group
+    template<typename G>
+    ProfileCounters *getProfileCounters(const G &mergedGroup) const
+    {
+        return static_cast<ProfileCounters*>(getContextSymbol("profile" + G::name + "Group" + std::to_string(mergedGroup.getIndex())));
+    }
+
+    template<typename G>
+    void addProfileEntries(const std::vector<G> &mergedGroups, std::vector<ProfileEntry> &entries) const
+    {
+        // Loop through merged groups
+        for(const auto &m : mergedGroups) {
+            // Loop through populations and add entry containing their counters
+            const auto *counters = getProfileCounters(m);
+            for(size_t i = 0; i < m.getGroups().size(); i++) {
+                entries.push_back({G::name, m.getIndex(), m.getGroups()[i].get().getName(),
+                                   counters[i].time, counters[i].calls, counters[i].neurons, 
+                                   counters[i].spikes, counters[i].synapses});
+            }
+        }
+    }
+
+    template<typename G>
+    void resetProfileCounters(const std::vector<G> &mergedGroups)
+    {
+        for(const auto &m : mergedGroups) {
+            std::fill_n(getProfileCounters(m), m.getGroups().size(), ProfileCounters{});
+        }
+    }
+
     template<typename G>
     void addMergedArrays(const G &mergedGroup)
     {
@@ -533,6 +704,46 @@ private:
                   
     }
 
+    //! Helper to create recording buffers and index arrays for traced state variables
+    /*! \tparam A               Adaptor class used to access 
+        \tparam G               Type of group variables are associated with
+        \param group            Group array is to be associatd with
+        \param traces           Traces configured for this group
+        \param batchSize        Batch size of model
+        \param location         Location of recording buffers */
+    template<typename A, typename G>
+    void createVarTraceArrays(const G *group, const std::map<std::string, VarTrace> &traces, 
+                              size_t batchSize, VarLocation location, unsigned int logIndent = 1)
+    {
+        for(const auto &var : A(*group).getDefs()) {
+            const auto t = traces.find(var.name);
+            if(t == traces.cend()) {
+                continue;
+            }
+
+            // Check number of recording timesteps is a multiple of sampling interval
+            // **NOTE** this means samples remain aligned as recording buffer wraps
+            const size_t numRecordingTimesteps = m_NumRecordingTimesteps.value();
+            if((numRecordingTimesteps % t->second.interval) != 0) {
+                throw std::runtime_error("Number of recording timesteps must be a multiple of the interval "
+                                         "at which variable '" + var.name + "' is traced");
+            }
+
+            // Create recording buffer
+            const size_t numTraced = t->second.neuronIDs.size();
+            const size_t numSamples = numRecordingTimesteps / t->second.interval;
+            createArray(group, "recordTrace" + var.name, var.type.resolve(getModel().getTypeContext()), 
+                        numSamples * batchSize * numTraced, location, false, logIndent);
+
+            // Create array of traced neuron indices, copy in indices and push
+            createArray(group, "traceIdx" + var.name, Type::Uint32, numTraced, VarLocation::HOST_DEVICE, false, logIndent);
+            auto *traceIdx = getArray(*group, "traceIdx" + var.name);
+            std::copy(t->second.neuronIDs.cbegin(), t->second.neuronIDs.cend(), 
+                      reinterpret_cast<uint32_t*>(traceIdx->getHostPointer()));
+            traceIdx->pushToDevice();
+        }
+    }
+
     template<typename G>
     void createDynamicParamDestinations(const G &group, const Snippet::Base::ParamVec &params, 
                                       bool (G::*isDynamic)(const std::string&) const, unsigned int logIndent = 1)
@@ -546,9 +757,16 @@ private:
     }
 
     //! Set dynamic parameter value in all merged field destinations
-    void setDynamicParamValue(const std::pair<Type::ResolvedType, MergedDynamicFieldDestinations> &mergedDestinations, 
+    void setDynamicParamValue(std::pair<Type::ResolvedType, MergedDynamicFieldDestinations> &mergedDestinations, 
                               const Type::NumericValue &value);
 
+    //! Push all merged groups used by the simulation, optionally first adding their dynamic arrays
+    void pushMergedGroups(bool addArrays);
+
+    //! Reallocate rows of synapse group with growable row capacity if 
+    //! its longest row no longer leaves enough slack or it leaves far too much
+    void updateRowCapacity(const SynapseGroupInternal &group);
+
     void allocateExtraGlobalParam(ArrayMap &groupArrays, const std::string &varName, size_t count);
 
     
@@ -581,10 +799,15 @@ private:
         // Loop through groups
         const auto sortedFields = g.getSortedFields(m_Backend.get());
 
-        // Start vector of argument types with unsigned int group index and them append FFI types of each argument
+        // Start vector of argument types with (optional) context pointer and unsigned int 
+        // group index and them append FFI types of each argument
         // **TODO** allow backend to override type
-        std::vector<ffi_type*> argumentTypes{&ffi_type_uint};
-        argumentTypes.reserve(sortedFields.size() + 1);
+        std::vector<ffi_type*> argumentTypes;
+        argumentTypes.reserve(sortedFields.size() + 2);
+        if(m_Context) {
+            argumentTypes.push_back(&ffi_type_pointer);
+        }
+        argumentTypes.push_back(&ffi_type_uint);
         std::transform(sortedFields.cbegin(), sortedFields.cend(), std::back_inserter(argumentTypes),
                        [](const auto &f){ return f.type.getFFIType(); });
         
@@ -650,15 +873,21 @@ private:
                         },
                         [&argumentStorage, &f](std::pair<Type::NumericValue, MergedDynamicFieldDestinations&> value)
                         {
-                            LOGD_RUNTIME << "\t\t" << f.name << " = dynamic numeric (" << Type::writeNumeric(value.first, f.type) << ")";
-                            Type::serialiseNumeric(value.first, f.type, argumentStorage);
+                            // **NOTE** if value has since been set at runtime, use this rather than initial value
+                            const auto &currentValue = value.second.getValue().value_or(value.first);
+                            LOGD_RUNTIME << "\t\t" << f.name << " = dynamic numeric (" << Type::writeNumeric(currentValue, f.type) << ")";
+                            Type::serialiseNumeric(currentValue, f.type, argumentStorage);
                         }},
                     f.getValue(*this, g.getGroups()[groupIndex], groupIndex));
             }
 
             // Build vector of argument pointers
-            std::vector<void*> argumentPointers{&groupIndex};
-            argumentPointers.reserve(1 + sortedFields.size());
+            std::vector<void*> argumentPointers;
+            argumentPointers.reserve(2 + sortedFields.size());
+            if(m_Context) {
+                argumentPointers.push_back(&m_Context);
+            }
+            argumentPointers.push_back(&groupIndex);
             std::transform(argumentOffsets.cbegin(), argumentOffsets.cend(), std::back_inserter(argumentPointers),
                            [&argumentStorage](size_t offset){ return &argumentStorage[offset]; });
 
@@ -695,11 +924,14 @@ private:
     std::unordered_map<const NeuronGroup*, unsigned int> m_DelayQueuePointer;
 
     //! Functions to perform custom updates
-    std::unordered_map<std::string, CustomUpdateFunction> m_CustomUpdateFunctions;
+    std::unordered_map<std::string, void*> m_CustomUpdateFunctions;
 
     //! Arrays containing column length arrays which should be zeroed before updating connectivity
     std::unordered_map<std::string, std::vector<ArrayBase*>> m_CustomUpdateColLengthArrays;
 
+    //! Current row strides of synapse groups with growable row capacity
+    std::unordered_map<const SynapseGroup*, size_t> m_GrowableRowStrides;
+
     //! Map containing mapping of dynamic arrays to their locations within merged groups
     MergedDynamicArrayMap m_MergedDynamicArrays;
 
@@ -717,11 +949,17 @@ private:
     MergedDynamicParameterMap<CustomUpdateBase> m_CustomUpdateBaseDynamicParameters;
     MergedDynamicParameterMap<CustomConnectivityUpdate> m_CustomConnectivityUpdateDynamicParameters;
 
-    VoidFunction m_AllocateMem;
-    VoidFunction m_FreeMem;
-    VoidFunction m_Initialize;
-    VoidFunction m_InitializeSparse;
-    VoidFunction m_InitializeHost;
-    StepTimeFunction m_StepTime;
+    //! Instance context allocated by generated code if backend enables one
+    void *m_Context;
+
+    //! Entry points into generated code, called via callEntryPoint
+    void *m_AllocateMem;
+    void *m_FreeMem;
+    void *m_Initialize;
+    void *m_InitializeSparse;
+    void *m_InitializeHost;
+    void *m_StepTime;
+    GetContextSymbolFunction m_GetContextSymbol;
+    SeedContextFunction m_SeedContext;
 };
 }
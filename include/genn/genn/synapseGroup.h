@@ -1,6 +1,7 @@
 #pragma once
 
 // Standard includes
+#include <functional>
 #include <optional>
 #include <map>
 #include <string>
@@ -14,6 +15,7 @@
 #include "weightUpdateModels.h"
 #include "synapseMatrixType.h"
 #include "varLocation.h"
+#include "varTrace.h"
 
 // Forward declarations
 namespace GeNN
@@ -90,6 +92,11 @@ public:
     /*! This is ignored for simulations on hardware with a single memory space. */
     void setPSExtraGlobalParamLocation(const std::string &paramName, VarLocation loc);
 
+    //! Enable recording of trace of postsynaptic model state variable
+    /*! Every interval timesteps, the values of the variable in the postsynaptic neurons specified by neuronIDs are
+        written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace. */
+    void setPSVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval = 1);
+
     //! Set whether weight update model parameter is dynamic or not i.e. it can be changed at runtime
     void setWUParamDynamic(const std::string &paramName, bool dynamic = true);
 
@@ -124,6 +131,13 @@ public:
     //! Sets the maximum dendritic delay for synapses in this synapse group
     void setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelay);
 
+    //! Sets the maximum number of dendritically delayed events which can be scheduled for delivery in any single timestep
+    /*! If this is small compared to the number of target neurons, dendritic delays are implemented using a 
+        sparse timing wheel of (target, weight) entries rather than a dense ring buffer. 
+        **NOTE** events scheduled for delivery in timesteps whose bucket is already full are dropped 
+        and counted so they can be reported by Runtime::getDendriticDelayWheelOverflow. */
+    void setMaxDendriticDelayEvents(unsigned int maxDendriticDelayEvents);
+
     //! Sets the number of delay steps used to delay events and variables between presynaptic neuron and synapse
     void setAxonalDelaySteps(unsigned int timesteps);
 
@@ -140,6 +154,23 @@ public:
     //! Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices
     void setNarrowSparseIndEnabled(bool enabled);
 
+    //! Share the sparse connectivity of another synapse group rather than storing and initialising a copy of it
+    /*! Both synapse groups must have SPARSE connectivity between the same source and target neuron groups,
+        initialised using the same snippet and parameters. Where possible, presynaptic spikes are then 
+        processed for all synapse groups sharing connectivity in a single traversal of each row. */
+    void setSharedConnectivityTarget(const SynapseGroup *target);
+
+    //! Sets the number of free slots to keep at the end of every row of a SPARSE synapse group whose connectivity is modified at runtime
+    /*! If this is non-zero, the maximum connections set for the synapse group only determines the initial row capacity. 
+        After sparse initialisation and after each custom update which modifies its connectivity, the rows of
+        the synapse group are reallocated so the longest row is followed by at least this many free slots.
+        This is therefore the maximum number of synapses a single custom update can add to any row; if a custom update 
+        tries to add more, the extra synapses are dropped and Runtime::customUpdate throws an exception.
+        Columns of the postsynaptic remap used for postsynaptic learning are not reallocated so, if the weight update 
+        model has postsynaptic spike or spike-like event code, the maximum source connections must be set to the number of presynaptic neurons.
+        **NOTE** reallocation invalidates any host pointers previously obtained to the synapse group's per-synapse arrays */
+    void setRowCapacitySlack(unsigned int rowCapacitySlack){ m_RowCapacitySlack = rowCapacitySlack; }
+
     //------------------------------------------------------------------------
     // Public const methods
     //------------------------------------------------------------------------
@@ -152,9 +183,21 @@ public:
     unsigned int getMaxConnections() const{ return m_MaxConnections; }
     unsigned int getMaxSourceConnections() const{ return m_MaxSourceConnections; }
     unsigned int getMaxDendriticDelayTimesteps() const{ return m_MaxDendriticDelayTimesteps.value_or(1); }
+    unsigned int getMaxDendriticDelayEvents() const{ return m_MaxDendriticDelayEvents; }
+
+    //! Are dendritic delays implemented using a sparse timing wheel rather than a dense ring buffer?
+    bool isDendriticDelayWheelEnabled() const{ return m_DendriticDelayWheelEnabled; }
+    unsigned int getRowCapacitySlack() const{ return m_RowCapacitySlack; }
+
+    //! Is the row capacity of this synapse group reallocated at runtime?
+    bool isRowCapacityGrowable() const{ return (m_RowCapacitySlack > 0); }
     SynapseMatrixType getMatrixType() const{ return m_MatrixType; }
     const auto &getKernelSize() const { return m_KernelSize; }
     size_t getKernelSizeFlattened() const;
+
+    //! Get synapse group whose sparse connectivity this synapse group shares
+    /*! If this is nullptr, this synapse group has its own connectivity */
+    const SynapseGroup *getSharedConnectivityTarget() const{ return m_SharedConnectivityTarget; }
     
     //! Get variable mode used for outputs from this synapse group e.g. outPre and outPost
     VarLocation getOutputLocation() const { return m_OutputLocation; }
@@ -186,6 +229,13 @@ public:
     //! Is postsynaptic model parameter dynamic i.e. it can be changed at runtime
     bool isPSParamDynamic(const std::string &paramName) const{ return m_PSDynamicParams.get(paramName); }
 
+    //! Has postsynaptic model variable been demoted to a constant, meaning no array is allocated for it?
+    /*! \note this can only be called after model is finalized */
+    bool isPSVarDemoted(const std::string &varName) const{ return (m_DemotedPSVars.count(varName) != 0); }
+
+    //! Get traces of postsynaptic model state variables recorded
+    const auto &getPSVarTraces() const{ return m_PSVarTraces.get(); }
+
     //! Is weight update model parameter dynamic i.e. it can be changed at runtime
     bool isWUParamDynamic(const std::string &paramName) const{ return m_WUDynamicParams.get(paramName); }
 
@@ -278,7 +328,18 @@ protected:
     // Set a variable as requiring queueing
     void setPSMVarQueueRequired(const std::string &varName){ m_PSMVarQueueRequired.insert(varName); }
 
-    void finalise(double dt);
+    //! Mark a postsynaptic model variable as being referenced from elsewhere in the model so it can't be demoted to a constant
+    void setPSVarReferenced(const std::string &varName){ m_ReferencedPSVars.insert(varName); }
+
+    //! Demote read-only postsynaptic model variables initialised to a constant to constants
+    void demoteConstantReadOnlyPSVars();
+
+    void finalise(double dt, unsigned int batchSize);
+
+    //! Replace AUTO matrix type with the fastest compatible type, supported by the backend, whose estimated 
+    //! memory requirements fit within memoryBudget, which is reduced by the memory this requires
+    void resolveAutoMatrixType(const Type::TypeContext &typeContext, const std::function<bool(SynapseMatrixType)> &isMatrixTypeSupported,
+                               size_t &memoryBudget);
 
     //! Add reference to custom connectivity update, referencing this synapse group
     void addCustomUpdateReference(CustomConnectivityUpdateInternal *cu){ m_CustomConnectivityUpdateReferences.push_back(cu); }
@@ -286,6 +347,9 @@ protected:
     //! Add reference to custom update, referencing this synapse group
     void addCustomUpdateReference(CustomUpdateWUInternal *cu){ m_CustomUpdateReferences.push_back(cu); }
 
+    //! Add synapse group which shares this synapse group's connectivity and whose presynaptic spike processing has been fused with this one's
+    void addFusedSharedConnectivitySyn(SynapseGroupInternal *sg){ m_FusedSharedConnectivitySyn.push_back(sg); }
+
     //------------------------------------------------------------------------
     // Protected const methods
     //------------------------------------------------------------------------
@@ -298,6 +362,10 @@ protected:
     const SynapseGroup &getFusedPreOutputTarget() const { return m_FusedPreOutputTarget ? *m_FusedPreOutputTarget : *this; }
     const SynapseGroup &getFusedSpikeTarget(const NeuronGroup *ng) const;
     const SynapseGroup &getFusedSpikeEventTarget(const NeuronGroup *ng) const;
+    const SynapseGroup &getFusedConnectivityTarget() const{ return m_SharedConnectivityTarget ? *m_SharedConnectivityTarget : *this; }
+
+    //! Gets synapse groups which share this synapse group's connectivity and whose presynaptic spike processing has been fused with this one's
+    const auto &getFusedSharedConnectivitySyn() const{ return m_FusedSharedConnectivitySyn; }
 
     //! Gets custom connectivity updates which reference this synapse group
     /*! Because, if connectivity is sparse, all groups share connectivity this is required if connectivity changes. */
@@ -337,6 +405,10 @@ protected:
     //! Has this synapse group's postsynaptic spike event generation been fused with those from other synapse groups?
     bool isPostSpikeEventFused() const{ return m_FusedPostSpikeEventTarget != nullptr; }
 
+    //! Has this synapse group's presynaptic spike processing been fused into 
+    //! the traversal of the synapse group whose connectivity it shares?
+    bool isSharedConnectivityPreSpikeFused() const;
+
     //! Has the presynaptic component of this synapse group's weight update
     //! model been fused with those from other synapse groups?
     bool isWUPreModelFused() const { return m_FusedWUPreTarget != nullptr; }
@@ -468,6 +540,17 @@ protected:
     boost::uuids::detail::sha1::digest_type getVarLocationHashDigest() const;
 
 private:
+    //------------------------------------------------------------------------
+    // Private methods
+    //------------------------------------------------------------------------
+    //! Validate matrix type against initialisers and weight update 
+    //! model and calculate the dimensions of connectivity it implies
+    void initMatrixType();
+
+    //! Decide whether a sparse timing wheel requires less memory than a 
+    //! dense ring buffer to implement this synapse group's dendritic delays
+    void updateDendriticDelayWheel();
+
     //------------------------------------------------------------------------
     // Members
     //------------------------------------------------------------------------
@@ -494,15 +577,31 @@ private:
 
     //! Maximum dendritic delay timesteps supported for synapses in this population
     std::optional<unsigned int> m_MaxDendriticDelayTimesteps;
+
+    //! Maximum number of dendritically delayed events which can be delivered in any single timestep
+    unsigned int m_MaxDendriticDelayEvents;
+
+    //! Are dendritic delays implemented using a sparse timing wheel?
+    bool m_DendriticDelayWheelEnabled;
+
+    //! Number of free slots to maintain at the end of each row when row capacity is reallocated at runtime
+    unsigned int m_RowCapacitySlack;
     
     //! Set of names of PSM variable requiring queueing
     std::set<std::string> m_PSMVarQueueRequired;
 
+    //! Set of names of postsynaptic model variables referenced from elsewhere in the model
+    std::set<std::string> m_ReferencedPSVars;
+
+    //! Set of names of postsynaptic model variables demoted to constants
+    std::set<std::string> m_DemotedPSVars;
+
     //! Kernel size 
     std::vector<unsigned int> m_KernelSize;
     
     //! Connectivity type of synapses
-    const SynapseMatrixType m_MatrixType;
+    /*! **NOTE** this is only non-const so AUTO matrix types can be resolved */
+    SynapseMatrixType m_MatrixType;
 
     //! Pointer to presynaptic neuron group
     NeuronGroupInternal * const m_SrcNeuronGroup;
@@ -572,6 +671,9 @@ private:
     //! Data structure tracking whether postsynaptic model parameters are dynamic or not
     Snippet::DynamicParameterContainer m_PSDynamicParams;
 
+    //! Traces of postsynaptic model state variables being recorded
+    VarTraceContainer m_PSVarTraces;
+
     //! Data structure tracking whether weight update model parameters are dynamic or not
     Snippet::DynamicParameterContainer m_WUDynamicParams;
 
@@ -615,6 +717,14 @@ private:
     /*! This will either be 'Isyn' or the name of one of the presynaptic neuron's additional input variables. */
     std::string m_PreTargetVar;
 
+    //! Synapse group whose sparse connectivity this synapse group shares.
+    /*! If this is nullptr, this synapse group has its own connectivity */
+    const SynapseGroup *m_SharedConnectivityTarget;
+
+    //! Synapse groups which share this synapse group's connectivity 
+    //! and whose presynaptic spike processing has been fused with this one's
+    std::vector<SynapseGroupInternal*> m_FusedSharedConnectivitySyn;
+
     //! Custom connectivity updates which reference this synapse group.
     /*! Because, if connectivity is sparse, all groups share connectivity this is required if connectivity changes. */
     std::vector<CustomConnectivityUpdateInternal*> m_CustomConnectivityUpdateReferences;
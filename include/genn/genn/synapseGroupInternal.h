@@ -39,13 +39,19 @@ public:
     using SynapseGroup::setFusedPreOutputTarget;
     using SynapseGroup::setFusedWUPrePostTarget;
     using SynapseGroup::finalise;
+    using SynapseGroup::setPSVarReferenced;
+    using SynapseGroup::demoteConstantReadOnlyPSVars;
+    using SynapseGroup::resolveAutoMatrixType;
     using SynapseGroup::addCustomUpdateReference;
+    using SynapseGroup::addFusedSharedConnectivitySyn;
     using SynapseGroup::getFusedPSTarget;
     using SynapseGroup::getFusedSpikeTarget;
     using SynapseGroup::getFusedSpikeEventTarget;
     using SynapseGroup::getFusedPreOutputTarget;
     using SynapseGroup::getFusedWUPreTarget;
     using SynapseGroup::getFusedWUPostTarget;
+    using SynapseGroup::getFusedConnectivityTarget;
+    using SynapseGroup::getFusedSharedConnectivitySyn;
     using SynapseGroup::getSparseIndType;
     using SynapseGroup::getCustomConnectivityUpdateReferences;
     using SynapseGroup::getCustomUpdateReferences;
@@ -56,6 +62,7 @@ public:
     using SynapseGroup::canPreOutputBeFused;
     using SynapseGroup::isPSModelFused;
     using SynapseGroup::isPreSpikeFused;
+    using SynapseGroup::isSharedConnectivityPreSpikeFused;
     using SynapseGroup::isWUPreModelFused;
     using SynapseGroup::isWUPostModelFused;
     using SynapseGroup::isDendriticOutputDelayRequired;
@@ -106,7 +113,24 @@ public:
     //----------------------------------------------------------------------------
     VarLocation getLoc(const std::string &varName) const{ return m_SG.getPSVarLocation(varName); }
 
-    auto getDefs() const{ return m_SG.getPSInitialiser().getSnippet()->getVars(); }
+    auto getDefs() const
+    { 
+        // **NOTE** variables demoted to constants have no arrays so are excluded
+        auto vars = m_SG.getPSInitialiser().getSnippet()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return m_SG.isPSVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
+
+    auto getDemotedDefs() const
+    { 
+        auto vars = m_SG.getPSInitialiser().getSnippet()->getVars();
+        vars.erase(std::remove_if(vars.begin(), vars.end(), 
+                                  [this](const auto &v){ return !m_SG.isPSVarDemoted(v.name); }),
+                   vars.end());
+        return vars;
+    }
 
     const auto &getInitialisers() const{ return m_SG.getPSInitialiser().getVarInitialisers(); }
 
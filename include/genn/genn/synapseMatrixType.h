@@ -67,6 +67,11 @@ enum class SynapseMatrixType : unsigned int
     /*! Sparse structured connectivity is generated on the fly a Toeplitz connectivity initialisation snippet and state variables are stored in a shared kernel.
      This is the most efficient choice for convolution-like connectivity*/
     TOEPLITZ            = static_cast<unsigned int>(SynapseMatrixConnectivity::TOEPLITZ) | static_cast<unsigned int>(SynapseMatrixWeight::KERNEL),
+
+    /*! One of the above types is chosen when the model is finalised, based on the estimated memory 
+     and per-spike cost of the types which are compatible with the synapse group's connectivity and weight update model. 
+     Synapse groups without a connectivity initialisation snippet are treated as being densely connected. */
+    AUTO                = 0,
 };
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,82 @@
+#pragma once
+
+// Standard C++ includes
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// GeNN includes
+#include "gennUtils.h"
+
+//----------------------------------------------------------------------------
+// GeNN::VarTrace
+//----------------------------------------------------------------------------
+namespace GeNN
+{
+//! Configuration of trace recording for a single per-neuron state variable
+struct VarTrace
+{
+    //! Indices of neurons whose values are sampled
+    std::vector<unsigned int> neuronIDs;
+
+    //! Number of timesteps between samples
+    unsigned int interval;
+};
+
+//----------------------------------------------------------------------------
+// GeNN::VarTraceContainer
+//----------------------------------------------------------------------------
+class VarTraceContainer
+{
+public:
+    //------------------------------------------------------------------------
+    // Public API
+    //------------------------------------------------------------------------
+    void set(const std::string &name, const std::vector<unsigned int> &neuronIDs,
+             unsigned int interval, unsigned int numNeurons)
+    {
+        // Empty list of neurons disables trace
+        if(neuronIDs.empty()) {
+            m_Traces.erase(name);
+            return;
+        }
+
+        if(interval == 0) {
+            throw std::runtime_error("Trace recording interval for variable '" + name + "' must be at least one timestep");
+        }
+        if(std::any_of(neuronIDs.cbegin(), neuronIDs.cend(), [numNeurons](unsigned int i){ return (i >= numNeurons); })) {
+            throw std::runtime_error("Trace recording of variable '" + name + "' includes out of range neuron index");
+        }
+        m_Traces[name] = VarTrace{neuronIDs, interval};
+    }
+
+    const std::map<std::string, VarTrace> &get() const{ return m_Traces; }
+
+    bool empty() const{ return m_Traces.empty(); }
+
+    //! Update hash with parts of trace configuration that affect generated code
+    /*! **NOTE** the indices of the traced neurons are stored in an array so only their number is hashed
+        and, so the hashes of groups without traces are unchanged, nothing is hashed if there are no traces */
+    void updateHash(boost::uuids::detail::sha1 &hash) const
+    {
+        if(m_Traces.empty()) {
+            return;
+        }
+
+        Utils::updateHash(m_Traces.size(), hash);
+        for(const auto &t : m_Traces) {
+            Utils::updateHash(t.first, hash);
+            Utils::updateHash(t.second.neuronIDs.size(), hash);
+            Utils::updateHash(t.second.interval, hash);
+        }
+    }
+
+private:
+    //------------------------------------------------------------------------
+    // Members
+    //------------------------------------------------------------------------
+    std::map<std::string, VarTrace> m_Traces;
+};
+}   // namespace GeNN
@@ -29,6 +29,8 @@
 #define SET_POST_NEURON_VAR_REFS(...) virtual VarRefVec getPostNeuronVarRefs() const override{ return __VA_ARGS__; }
 #define SET_PSM_VAR_REFS(...) virtual VarRefVec getPSMVarRefs() const override{ return __VA_ARGS__; }
 
+#define SET_LAZY_DECAY_VARS(...) virtual LazyDecayVarVec getLazyDecayVars() const override{ return __VA_ARGS__; }
+
 //----------------------------------------------------------------------------
 // GeNN::WeightUpdateModels::Base
 //----------------------------------------------------------------------------
@@ -38,6 +40,12 @@ namespace GeNN::WeightUpdateModels
 class GENN_EXPORT Base : public Models::Base
 {
 public:
+    //----------------------------------------------------------------------------
+    // Typedefines
+    //----------------------------------------------------------------------------
+    //! Names of per-synapse variables and of the parameters or derived parameters holding their decay time constants
+    typedef std::vector<std::pair<std::string, std::string>> LazyDecayVarVec;
+
     //----------------------------------------------------------------------------
     // Declared virtuals
     //----------------------------------------------------------------------------
@@ -108,6 +116,13 @@ public:
     //! Gets names and types of variable references to postsynaptic model
     virtual VarRefVec getPSMVarRefs() const{ return {}; }
 
+    //! Gets per-synapse variables which decay exponentially towards zero between updates and 
+    //! the names of the parameters or derived parameters which specify their time constants
+    /*! Rather than being decayed every timestep by synapse dynamics code, these variables 
+        are decayed in closed form whenever a synapse is updated using the time it was last updated. 
+        Therefore, the values of these variables in memory are only correct at the time of the last update */
+    virtual LazyDecayVarVec getLazyDecayVars() const{ return {}; }
+
     //------------------------------------------------------------------------
     // Public methods
     //------------------------------------------------------------------------
@@ -315,7 +330,7 @@ public:
     SET_PRE_NEURON_VAR_REFS({{"V", "scalar", VarAccessMode::READ_ONLY}});
 
     SET_PRE_EVENT_THRESHOLD_CONDITION_CODE("V > Epre");
-    SET_PRE_EVENT_SYN_CODE("addToPost(fmax(0.0, g * tanh((V_pre - Epre) / Vslope) * dt));\n");
+    SET_PRE_EVENT_SYN_CODE("addToPost(fmax(0.0, g * tanh((V - Epre) / Vslope) * dt));\n");
 };
 
 //----------------------------------------------------------------------------
@@ -1,9 +1,10 @@
 import numpy as np
 from . import neuron_models, types
 
+from itertools import chain
 from typing import List, Sequence, Tuple, Union
 from ._genn import (CustomUpdateWU, NumericValue, SynapseMatrixConnectivity,
-                    SynapseMatrixWeight, VarAccessDim, 
+                    SynapseMatrixType, SynapseMatrixWeight, VarAccessDim, 
                     VarLocation, VarLocationAttribute)
 
 from warnings import warn
@@ -45,7 +46,7 @@ def _get_synapse_var_shape(var_dims, sg, batch_size):
             return num_copies + (np.prod(sg.kernel_size),)
         else:
             # **YUCK** this isn't correct - only backend knows correct stride
-            return num_copies + (sg.src.num_neurons * sg.max_connections,)
+            return num_copies + (sg.src.num_neurons * sg._row_stride,)
     else:
         return num_copies + (1,)
 
@@ -135,8 +136,24 @@ class GroupMixin(object):
                         shape)
         return array
 
+    def _get_var_trace(self, array, var_type, trace):
+        """Split recorded variable trace into per-batch numpy arrays
+
+        Args:
+            array:      trace recording array obtained from runtime
+            var_type:   type of traced variable
+            trace:      VarTrace describing trace recording
+        """
+        batch_size = self._model.batch_size
+        trace_array = Array(var_type, self)
+        trace_array.set_array(array,
+                              (-1, batch_size, len(trace.neuron_ids)))
+        return [np.copy(trace_array.view[:, b, :])
+                for b in range(batch_size)]
+
     def _load_vars(self, vars, get_shape_fn, var_dict=None,
-                   get_location_fn=None, get_delay_group_fn=None):
+                   get_location_fn=None, get_delay_group_fn=None,
+                   is_demoted_fn=None, copy_init_values=True):
         # If no variable dictionary is specified, use standard one
         if var_dict is None:
             var_dict = self.vars
@@ -150,6 +167,12 @@ class GroupMixin(object):
             # Get corresponding data from dictionary
             var_data = var_dict[v.name]
 
+            # Skip variables which have been demoted to constants
+            # **NOTE** these have no arrays so mark them to prevent access
+            if is_demoted_fn is not None and is_demoted_fn(v.name):
+                var_data._demoted = True
+                continue
+
             # If variable is located on host
             var_loc = get_location_fn(v.name) 
             if var_loc & VarLocationAttribute.HOST:
@@ -167,7 +190,7 @@ class GroupMixin(object):
                     var_shape, delay_group)
 
                 # If manual initialisation is required, copy in init_values
-                if var_data.init_required:
+                if copy_init_values and var_data.init_required:
                     var_data.values = var_data.init_values
             else:
                 assert not var_data.init_required
@@ -232,6 +255,13 @@ class NeuronGroupMixin(GroupMixin):
         prev_spike_times:    :class:`pygenn.model_preprocessor.Array` that,
                              if previous spike tikes are required, will provide
                              interface for pushing, pulling and accessing them
+        spike_rates:         :class:`pygenn.model_preprocessor.Array` that,
+                             if firing rate estimation is enabled, will provide
+                             interface for pulling and accessing per-neuron
+                             firing rate estimates (in Hz)
+        isi_histogram:       :class:`pygenn.model_preprocessor.Array` that,
+                             if an inter-spike interval histogram is enabled, 
+                             will provide interface for pulling and accessing it
     """
 
     def _init_group(self, model, var_space):
@@ -249,6 +279,8 @@ class NeuronGroupMixin(GroupMixin):
 
         self.spike_times = None
         self.prev_spike_times = None
+        self.spike_rates = None
+        self.isi_histogram = None
 
         # **YUCK** in order to ensure model stays in scope
         # as long as the group, keep Python reference
@@ -264,6 +296,34 @@ class NeuronGroupMixin(GroupMixin):
         """
         return self._model._runtime.get_recorded_spikes(self)
 
+    @property
+    def spike_count_recording_data(self) -> List[np.ndarray]:
+        """Number of spikes emitted by this neuron group in each 
+        recorded timestep, for each batch.
+        
+        Before accessing this property,
+        :meth:`.GeNNModel.pull_recording_buffers_from_device`
+        must be called to copy spike count recording data from device
+        """
+        return self._model._runtime.get_recorded_spike_counts(self)
+
+    def get_var_trace(self, var_name: str) -> List[np.ndarray]:
+        """Get samples of a neuron state variable recorded using
+        :meth:`.NeuronGroup.set_var_trace_recording`. Each array in
+        the returned list contains the samples for one batch, with 
+        shape (number of samples, number of traced neurons).
+
+        Before calling this method,
+        :meth:`.GeNNModel.pull_recording_buffers_from_device`
+        must be called to copy trace recording data from device
+
+        Args:
+            var_name:   name of the traced variable
+        """
+        return self._get_var_trace(
+            self._model._runtime.get_recorded_var_trace(self, var_name),
+            self.vars[var_name].type, self.var_traces[var_name])
+
     def _load(self):
         """Loads neuron group"""
         batch_size = self._model.batch_size
@@ -286,6 +346,22 @@ class NeuronGroupMixin(GroupMixin):
                 _get_neuron_var_shape(
                     VarAccessDim.ELEMENT | VarAccessDim.BATCH,
                     self.num_neurons, self._model.batch_size, delay_group))
+
+        # If firing rate estimation is enabled, get array
+        if self.spike_rate_tau > 0.0:
+            self.spike_rates = self._get_array(
+                "spkRate", self._model.precision,
+                _get_neuron_var_shape(
+                    VarAccessDim.ELEMENT | VarAccessDim.BATCH,
+                    self.num_neurons, self._model.batch_size))
+
+        # If ISI histogram is enabled, get array
+        if self.isi_histogram_num_bins > 0:
+            self.isi_histogram = self._get_array(
+                "isiHist", types.Uint32,
+                _get_neuron_var_shape(
+                    VarAccessDim.ELEMENT | VarAccessDim.BATCH,
+                    self.isi_histogram_num_bins, self._model.batch_size))
                     
         # Load neuron state variables
         self._load_vars(
@@ -295,7 +371,8 @@ class NeuronGroupMixin(GroupMixin):
                 self._model.batch_size, d),
             self.vars, self.get_var_location,
             lambda v: (delay_group if self._is_var_queue_required(v.name)
-                       else None))
+                       else None),
+            self.is_var_demoted)
 
         # Load neuron extra global params
         self._load_egp()
@@ -306,6 +383,8 @@ class NeuronGroupMixin(GroupMixin):
 
         self.spike_times = None
         self.prev_spike_times = None
+        self.spike_rates = None
+        self.isi_histogram = None
 
     def _load_init_egps(self):
         # Load any egps used for variable initialisation
@@ -343,6 +422,10 @@ class SynapseGroupMixin(GroupMixin):
         self.trg = target
         self.out_post = None
         self.connections_set = False
+        self._pre_indices = None
+        self._post_indices = None
+        self._ind = None
+        self._row_lengths = None
 
         # Prepare weight update model variables and EGPS
         wu_snippet = self.wu_initialiser.snippet
@@ -363,7 +446,12 @@ class SynapseGroupMixin(GroupMixin):
             ps_snippet.get_extra_global_params(), self)
 
         # Prepare connectivity init EGPS
-        if self.matrix_type & SynapseMatrixConnectivity.TOEPLITZ:
+        # **NOTE** AUTO matrix types are always resolved 
+        # to TOEPLITZ if a toeplitz initialiser is provided
+        toeplitz_snippet = self.toeplitz_connectivity_initialiser.snippet
+        if (self.matrix_type & SynapseMatrixConnectivity.TOEPLITZ
+            or (self.matrix_type == SynapseMatrixType.AUTO
+                and toeplitz_snippet.get_diagonal_build_code())):
             connect_init = self.toeplitz_connectivity_initialiser
         else:
             connect_init = self.sparse_connectivity_initialiser
@@ -397,13 +485,30 @@ class SynapseGroupMixin(GroupMixin):
         """
         return self._model._runtime.get_recorded_post_spike_events(self)
 
+    def get_psm_var_trace(self, var_name: str) -> List[np.ndarray]:
+        """Get samples of a postsynaptic model state variable recorded using
+        :meth:`.SynapseGroup.set_ps_var_trace_recording`. Each array in
+        the returned list contains the samples for one batch, with 
+        shape (number of samples, number of traced neurons).
+
+        Before calling this method,
+        :meth:`.GeNNModel.pull_recording_buffers_from_device`
+        must be called to copy trace recording data from device
+
+        Args:
+            var_name:   name of the traced variable
+        """
+        return self._get_var_trace(
+            self._model._runtime.get_recorded_ps_var_trace(self, var_name),
+            self.psm_vars[var_name].type, self.ps_var_traces[var_name])
+
     @property
     def weight_update_var_size(self) -> int:
         """Size of each weight update variable"""
         if self.matrix_type & SynapseMatrixConnectivity.DENSE:
             return self.trg.num_neurons * self.src.num_neurons
         elif self.matrix_type & SynapseMatrixConnectivity.SPARSE:
-            return self.max_connections * self.src.num_neurons
+            return self._row_stride * self.src.num_neurons
         elif self.matrix_type & SynapseMatrixWeight.KERNEL:
             return int(np.prod(self.kernel_size))
         else:
@@ -417,6 +522,11 @@ class SynapseGroupMixin(GroupMixin):
                                post_indices: IndexArrayType):
         """Manually provide indices of sparse synapses between two groups of neurons
 
+        The ragged connectivity structure is built natively, directly in GeNN's
+        memory, when the model is loaded. To avoid copying the edge lists, 
+        pass ``np.uint32`` arrays, which may also be memory-mapped 
+        (e.g. ``np.load(path, mmap_mode="r")``).
+
         Args:
             pre_indices:  presynaptic indices
             post_indices:  postsynaptic indices
@@ -425,9 +535,9 @@ class SynapseGroupMixin(GroupMixin):
             # Cast index arrays to numpy arrays if necessary
             pre_indices = np.asarray(pre_indices)
             post_indices = np.asarray(post_indices)
-
-            # Lexically sort indices
-            self.synapse_order = np.lexsort((post_indices, pre_indices))
+            if len(pre_indices) != len(post_indices):
+                raise Exception("set_sparse_connections requires the same "
+                                "number of pre and postsynaptic indices")
 
             # Count the number of synapses in each row
             row_lengths = np.bincount(pre_indices,
@@ -435,16 +545,17 @@ class SynapseGroupMixin(GroupMixin):
             row_lengths = row_lengths.astype(np.uint32)
 
             # Use maximum for max connections
-            max_row_length = int(np.amax(row_lengths))
-            self.max_connections = max_row_length
-
-            # Set ind to sorted postsynaptic indices
-            self.ind = post_indices[self.synapse_order]
+            self.max_connections = int(np.amax(row_lengths))
 
             # Cache the row lengths
             self.row_lengths = row_lengths
 
             assert len(self.row_lengths) == self.src.num_neurons
+
+            # Keep reference to indices until model is loaded
+            self._pre_indices = pre_indices
+            self._post_indices = post_indices
+            self.synapse_order = None
         else:
             raise Exception("set_sparse_connections only supports"
                             "ragged format sparse connectivity")
@@ -458,7 +569,7 @@ class SynapseGroupMixin(GroupMixin):
             presynaptic indices
         """
         if self.matrix_type & SynapseMatrixConnectivity.SPARSE:
-            rl = (self._row_lengths.view if self._connectivity_initialiser_provided
+            rl = (self._row_lengths.view if self._row_lengths is not None
                   else self.row_lengths)
 
             if rl is None:
@@ -466,7 +577,7 @@ class SynapseGroupMixin(GroupMixin):
 
             # Expand row lengths into full array
             # of presynaptic indices and return
-            return np.hstack([np.repeat(i, l) for i, l in enumerate(rl)])
+            return np.repeat(np.arange(len(rl)), rl)
 
         else:
             raise Exception("get_sparse_pre_inds only supports"
@@ -479,21 +590,18 @@ class SynapseGroupMixin(GroupMixin):
             postsynaptic indices
         """
         if (self.matrix_type & SynapseMatrixConnectivity.SPARSE):
-            if not self._connectivity_initialiser_provided:
-                if self.ind is None or self.row_lengths is None:
-                    raise Exception("problem accessing manually initialised connectivity ")
-                # Return cached indices
-                return self.ind
-
-            else:
-                if self._ind is None or self._row_lengths is None:
-                    raise Exception("problem accessing on-device initialised connectivity ")
-
-                # the _ind array view still has some non-valid data so we remove them
-                # with the row_lengths
+            # If connectivity is loaded, extract valid indices from each row
+            if self._ind is not None and self._row_lengths is not None:
                 return np.hstack([
-                    self._ind.view[i * self.max_connections: (i * self.max_connections) + r]
+                    self._ind.view[i * self._row_stride: (i * self._row_stride) + r]
                         for i, r in enumerate(self._row_lengths.view)])
+            # Otherwise, if connectivity has been set manually, sort cached indices
+            elif (not self._connectivity_initialiser_provided 
+                  and self._post_indices is not None):
+                order = np.lexsort((self._post_indices, self._pre_indices))
+                return self._post_indices[order]
+            else:
+                raise Exception("problem accessing connectivity ")
 
         else:
             raise Exception("get_sparse_post_inds only supports"
@@ -511,6 +619,12 @@ class SynapseGroupMixin(GroupMixin):
             self._ind.push_to_device()
             self._row_lengths.push_to_device()
     
+    @property
+    def dendritic_delay_wheel_overflow(self) -> int:
+        """Number of events dropped because a bucket of this synapse 
+        group's dendritic delay timing wheel was full."""
+        return self._model._runtime.get_dendritic_delay_wheel_overflow(self)
+
     @deprecated("Please call pull_from_device directly on out_post")
     def pull_in_syn_from_device(self):
         """Pull synaptic input current from device"""
@@ -544,29 +658,36 @@ class SynapseGroupMixin(GroupMixin):
         # which requires initialising manually
         if not (self.matrix_type & SynapseMatrixConnectivity.DENSE):
             if (self.matrix_type & SynapseMatrixConnectivity.SPARSE):
-                # If connectivity is located on host
+                # If connectivity is shared with another synapse group, use
+                # its ragged data structure (which has already been loaded)
                 conn_loc = self.sparse_connectivity_location
-                if conn_loc & VarLocationAttribute.HOST:
+                shared_target = self.shared_connectivity_target
+                if shared_target is not None:
+                    if self.connections_set:
+                        raise Exception("Synapse groups which share connectivity "
+                                        "cannot have their connections set "
+                                        "with set_sparse_connections")
+                    shared_target = self._model.synapse_populations[
+                        shared_target.name]
+                    self._ind = shared_target._ind
+                    self._row_lengths = shared_target._row_lengths
+                    self.synapse_order = getattr(shared_target, 
+                                                 "synapse_order", None)
+                # Otherwise, if connectivity is located on host
+                elif conn_loc & VarLocationAttribute.HOST:
                     # Get pointers to ragged data structure members
                     self._ind = self._get_array("ind", self._sparse_ind_type)
                     self._row_lengths = self._get_array("rowLength",
                                                         types.Uint32)
 
-                    # If data is available
+                    # If data is available, build ragged structure directly
+                    # in GeNN memory. **NOTE** references to the original
+                    # indices are kept so the model can be reloaded as custom 
+                    # connectivity updates may have changed the GeNN copy
                     if self.connections_set:
-                        # Copy in row length
-                        self._row_lengths.view[:] = self.row_lengths
-
-                        # Create (x)range containing the index where each row starts in ind
-                        row_start_idx = range(0, self.weight_update_var_size,
-                                              self.max_connections)
-
-                        # Loop through ragged matrix rows
-                        syn = 0
-                        for i, r in zip(row_start_idx, self.row_lengths):
-                            # Copy row from non-padded indices into correct location
-                            self._ind.view[i:i + r] = self.ind[syn:syn + r]
-                            syn += r
+                        self.synapse_order =\
+                            self._model._runtime.set_sparse_connections(
+                                self, self._pre_indices, self._post_indices)
                     elif not self._connectivity_initialiser_provided:
                         raise Exception("For sparse projections, the connections"
                                         "must be set before loading a model")
@@ -579,20 +700,13 @@ class SynapseGroupMixin(GroupMixin):
             elif self.connections_set:
                 raise Exception("Matrix format not supported")
 
-        # If population has individual synapse variables, 
-        # load weight update model variables
-        wu_snippet = self.wu_initialiser.snippet
-        if ((self.matrix_type & SynapseMatrixWeight.INDIVIDUAL) or 
-                (self.matrix_type & SynapseMatrixWeight.KERNEL)):
-            self._load_vars(
-                    wu_snippet.get_vars(),
-                    lambda v, d: _get_synapse_var_shape(
-                        get_var_access_dim(v.access), 
-                        self, self._model.batch_size),
-                    self.vars, self.get_wu_var_location)
+        # Load weight update model variables
+        self._load_synapse_vars()
+        self._loaded_row_stride = self._row_stride
 
         # If population's presynaptic weight update hasn't been 
         # fused, load weight update model presynaptic variables
+        wu_snippet = self.wu_initialiser.snippet
         if not self._wu_pre_model_fused:
             pre_delay_group = (None if (self.axonal_delay_steps == 0)
                                else self.src)
@@ -629,7 +743,8 @@ class SynapseGroupMixin(GroupMixin):
                 lambda v: (self.trg if self._is_psm_var_queue_required(v.name)
                            and (self.back_prop_delay_steps > 0 
                                 or self._is_psm_var_heterogeneously_delayed(v.name))
-                           else None))
+                           else None),
+                self.is_ps_var_demoted)
                 
             # If it's inSyn is accessible on the host
             if self.output_location & VarLocationAttribute.HOST:
@@ -656,6 +771,45 @@ class SynapseGroupMixin(GroupMixin):
         self._load_var_init_egps(self.pre_vars)
         self._load_var_init_egps(self.post_vars)
 
+    def _load_synapse_vars(self, copy_init_values=True):
+        # If population has individual synapse variables, 
+        # load weight update model variables
+        if ((self.matrix_type & SynapseMatrixWeight.INDIVIDUAL) or 
+                (self.matrix_type & SynapseMatrixWeight.KERNEL)):
+            self._load_vars(
+                    self.wu_initialiser.snippet.get_vars(),
+                    lambda v, d: _get_synapse_var_shape(
+                        get_var_access_dim(v.access), 
+                        self, self._model.batch_size),
+                    self.vars, self.get_wu_var_location,
+                    copy_init_values=copy_init_values)
+
+    def _reload_rows(self):
+        # Re-obtain views of per-synapse arrays which 
+        # have been reallocated with a new row stride
+        if self._ind is not None:
+            self._ind.set_array(self._model._runtime.get_array(self, "ind"))
+        self._load_synapse_vars(False)
+
+        # Re-obtain views of variables belonging to custom updates 
+        # and custom connectivity updates attached to this group
+        for c in chain(self._model.custom_updates.values(),
+                       self._model.custom_connectivity_updates.values()):
+            if (isinstance(c, (CustomUpdateWUMixin, CustomConnectivityUpdateMixin))
+                    and c.synapse_group.name == self.name):
+                c._load_synapse_vars(False)
+
+        self._loaded_row_stride = self._row_stride
+
+    @property
+    def _row_stride(self):
+        # If row capacity is growable and model is loaded, 
+        # rows may have been reallocated so get current stride
+        if self.row_capacity_slack > 0 and self._model._runtime is not None:
+            return self._model._runtime.get_synaptic_matrix_row_stride(self)
+        else:
+            return self.max_connections
+
     @property
     def _connectivity_initialiser_provided(self):
         assert self.matrix_type & SynapseMatrixConnectivity.SPARSE
@@ -701,13 +855,31 @@ class CurrentSourceMixin(GroupMixin):
         # as long as the group, keep Python reference
         self._current_source_model = self.model
 
+    def get_var_trace(self, var_name: str) -> List[np.ndarray]:
+        """Get samples of a current source state variable recorded using
+        :meth:`.CurrentSource.set_var_trace_recording`. Each array in
+        the returned list contains the samples for one batch, with 
+        shape (number of samples, number of traced neurons).
+
+        Before calling this method,
+        :meth:`.GeNNModel.pull_recording_buffers_from_device`
+        must be called to copy trace recording data from device
+
+        Args:
+            var_name:   name of the traced variable
+        """
+        return self._get_var_trace(
+            self._model._runtime.get_recorded_var_trace(self, var_name),
+            self.vars[var_name].type, self.var_traces[var_name])
+
     def _load(self):
         # Load current source variables
         self._load_vars(self.model.get_vars(),
                         lambda v, d: _get_neuron_var_shape(
                             get_var_access_dim(v.access),
                             self.target_pop.num_neurons,
-                            self._model.batch_size))
+                            self._model.batch_size),
+                        is_demoted_fn=self.is_var_demoted)
 
         # Load current source extra global parameters
         self._load_egp()
@@ -784,6 +956,12 @@ class CustomUpdateWUMixin(GroupMixin):
                     & SynapseMatrixConnectivity.PROCEDURAL)
 
         # Load variables
+        self._load_synapse_vars()
+
+        # Load custom update extra global parameters
+        self._load_egp()
+
+    def _load_synapse_vars(self, copy_init_values=True):
         batch_size = (self._model.batch_size
                       if self._dims & VarAccessDim.BATCH
                       else 1)
@@ -792,10 +970,8 @@ class CustomUpdateWUMixin(GroupMixin):
             lambda v, d: _get_synapse_var_shape(
                 get_var_access_dim(v.access, self._dims),
                 self.synapse_group, batch_size),
-            self.vars, self.get_var_location)
-
-        # Load custom update extra global parameters
-        self._load_egp()
+            self.vars, self.get_var_location,
+            copy_init_values=copy_init_values)
     
     @deprecated("Please access values directly on variable")
     def get_var_values(self, var_name):
@@ -847,11 +1023,7 @@ class CustomConnectivityUpdateMixin(GroupMixin):
 
     def _load(self):
         # Load variables
-        self._load_vars(
-            self.model.get_vars(),
-            lambda v, d: _get_synapse_var_shape(
-                get_var_access_dim(v.access), self.synapse_group, 1),
-            self.vars, self.get_var_location)
+        self._load_synapse_vars()
   
         # Load pre and postsynaptic variables
         self._load_vars(
@@ -870,6 +1042,14 @@ class CustomConnectivityUpdateMixin(GroupMixin):
         # Load custom update extra global parameters
         self._load_egp()
 
+    def _load_synapse_vars(self, copy_init_values=True):
+        self._load_vars(
+            self.model.get_vars(),
+            lambda v, d: _get_synapse_var_shape(
+                get_var_access_dim(v.access), self.synapse_group, 1),
+            self.vars, self.get_var_location,
+            copy_init_values=copy_init_values)
+
     def _load_init_egps(self):
         # Load any egps used for variable initialisation
         self._load_var_init_egps()
@@ -8,6 +8,7 @@ from . import (current_source_models, custom_connectivity_update_models,
 
 
 from collections import OrderedDict
+from concurrent.futures import Future, ThreadPoolExecutor
 from typing import Callable, Dict, Optional, List, Sequence, Tuple, Union
 from ._genn import (CurrentSource, CurrentSourceModelBase,
                     CustomConnectivityUpdate, CustomConnectivityUpdateModelBase,
@@ -15,14 +16,14 @@ from ._genn import (CurrentSource, CurrentSourceModelBase,
                     CustomUpdateVarAccess, CustomUpdateWU, DerivedParam,
                     EGP, EGPRef, EGPReference, InitSparseConnectivitySnippetBase,
                     InitToeplitzConnectivitySnippetBase, InitVarSnippetBase,
-                    ModelSpec, NeuronGroup, NeuronModelBase,
+                    LinearDynamics, ModelSpec, NeuronGroup, NeuronModelBase, ODE,
                     NumericValue, Param, ParamVal, PlogSeverity,
                     PostsynapticInit, PostsynapticModelBase, ResolvedType,
                     SparseConnectivityInit, SynapseGroup, SynapseMatrixType,
                     ToeplitzConnectivityInit, UnresolvedType, Var, VarAccess,
                     VarAccessMode, VarInit, VarLocation, VarRef, VarReference,
                     WeightUpdateInit, WeightUpdateModelBase, WUVarReference)
-from ._runtime import Runtime
+from ._runtime import Ensemble, Runtime
 from .genn_groups import (CurrentSourceMixin, CustomConnectivityUpdateMixin,
                           CustomUpdateMixin, CustomUpdateWUMixin,
                           NeuronGroupMixin, SynapseGroupMixin)
@@ -203,6 +204,9 @@ class GeNNModel(ModelSpec):
         self._built = False
         self._loaded = False
         self._runtime = None
+        self._ensemble = None
+        self._async_executor = None
+        self._async_futures = []
         self._preferences = None
         self._model_merged = None
         self._backend = None
@@ -269,17 +273,20 @@ class GeNNModel(ModelSpec):
     
     @property
     def t(self) -> float:
-        """Simulation time in ms"""
+        """Simulation time in ms, after any asynchronous steps complete"""
+        self._wait_for_async()
         return self._runtime.time
 
     @property
     def timestep(self) -> int:
-        """Simulation time step"""
+        """Simulation time step, after any asynchronous steps complete"""
+        self._wait_for_async()
         return self._runtime.timestep
 
     @timestep.setter
     def timestep(self, timestep: int):
         """Simulation time in timesteps"""
+        self._wait_for_async()
         self._runtime.timestep = timestep
 
     #@property
@@ -349,6 +356,35 @@ class GeNNModel(ModelSpec):
         """
         return self._runtime.get_custom_update_remap_time(name)
 
+    def get_profile(self) -> List[dict]:
+        """Get per-population profiling counters for every merged update group.
+        Only available if :attr:`.ModelSpec.profiling_enabled` is set.
+
+        Returns:
+            List of dictionaries containing the ``kernel`` and ``merged_group``
+            the population was updated in, its ``population`` name, the total
+            ``time`` in seconds spent updating it, the number of ``calls`` and
+            the total number of ``neurons`` processed, ``spikes`` emitted
+            or processed and ``synapses`` traversed
+        """
+        return self._runtime.get_profile()
+
+    def reset_profile(self):
+        """Zero all profiling counters.
+        Only available if :attr:`.ModelSpec.profiling_enabled` is set.
+        """
+        self._runtime.reset_profile()
+
+    def write_profile_trace(self, path: str):
+        """Write profiling counters to a JSON file in Chrome trace event format
+        which can be viewed in chrome://tracing or https://ui.perfetto.dev.
+        Only available if :attr:`.ModelSpec.profiling_enabled` is set.
+
+        Args:
+            path:   Path of JSON file to write
+        """
+        self._runtime.write_profile_trace(path)
+
     def add_neuron_population(self, pop_name: str, num_neurons: int, 
                               neuron: Union[NeuronModelBase, str],
                               params: PopParamVals = {}, 
@@ -656,8 +692,8 @@ class GeNNModel(ModelSpec):
         output_path = path.join(path_to_model, self.name + "_CODE")
         share_path = path.join(path.split(__file__)[0], "share")
 
-        # Finalize model
-        self._finalise()
+        # Finalize model, resolving AUTO matrix types to ones the backend supports
+        self._finalise(self._backend_module._is_matrix_type_supported)
 
         # Create suitable preferences object for backend
         self._preferences = self._backend_module.Preferences()
@@ -687,78 +723,75 @@ class GeNNModel(ModelSpec):
 
         self._built = True
 
-    def load(self, num_recording_timesteps: Optional[int] = None):
+    def load(self, num_recording_timesteps: Optional[int] = None,
+             num_replicas: Optional[int] = None,
+             seeds: Optional[Sequence[int]] = None):
         """Load the previously built model into memory;
         
         Args:
             num_recording_timesteps:    Number of timesteps to record spikes
                                         for. :meth:`.pull_recording_buffers_from_device` 
                                         must be called after this number of timesteps
+            num_replicas:               If set, load an ensemble of this many
+                                        independent replicas of the model which
+                                        share connectivity and are simulated
+                                        in parallel. Requires backend with
+                                        ``instance_context`` preference set.
+                                        Populations, variables and extra global
+                                        parameters access the first replica and
+                                        :meth:`.get_ensemble_var_values` and
+                                        :meth:`.set_ensemble_dynamic_param_values`
+                                        access all replicas.
+            seeds:                      Optional host RNG seed for each replica
         """
         if self._loaded:
             raise Exception("GeNN model already loaded")
         if not self._built:
             raise Exception("GeNN model has not been built")
         
-        # Create runtime
-        self._runtime = Runtime(self._path_to_model, self._model_merged,
-                                self._backend)
-        
         # If model uses recording system and recording timesteps is not set
         if self._recording_in_use and num_recording_timesteps is None:
             raise Exception("Cannot use recording system without passing "
                             "number of recording timesteps to GeNNModel.load")
 
-        # Allocate memory
-        self._runtime.allocate(num_recording_timesteps)
-
-        # Loop through neuron populations and load any
-        # extra global parameters required for initialization
-        for pop_data in self.neuron_populations.values():
-            pop_data._load_init_egps()
-
-        # Loop through synapse populations and load any 
-        # extra global parameters required for initialization
-        for pop_data in self.synapse_populations.values():
-            pop_data._load_init_egps()
-
-        # Loop through current sources
-        for src_data in self.current_sources.values():
-            src_data._load_init_egps()
-
-        # Loop through custom connectivity updates
-        for cu_data in self.custom_connectivity_updates.values():
-            cu_data._load_init_egps()
-
-        # Loop through custom updates
-        for cu_data in self.custom_updates.values():
-            cu_data._load_init_egps()
+        # Create runtime or ensemble of runtimes and allocate memory
+        if num_replicas is None:
+            self._runtime = Runtime(self._path_to_model, self._model_merged,
+                                    self._backend)
+            self._runtime.allocate(num_recording_timesteps)
+            runtimes = [self._runtime]
+        else:
+            self._ensemble = Ensemble(self._path_to_model, self._model_merged,
+                                      self._backend, num_replicas)
+            self._ensemble.allocate(num_recording_timesteps,
+                                    [] if seeds is None else list(seeds))
+            runtimes = [self._ensemble.get_replica(i)
+                        for i in range(num_replicas)]
+
+        # Load any extra global parameters required for 
+        # initialization into each runtime
+        for r in runtimes:
+            self._runtime = r
+            self._load_groups("_load_init_egps")
 
         # Initialize model
-        self._runtime.initialize()
-
-        # Loop through neuron populations
-        for pop_data in self.neuron_populations.values():
-            pop_data._load()
-
-        # Loop through synapse populations
-        for pop_data in self.synapse_populations.values():
-            pop_data._load()
-
-        # Loop through current sources
-        for src_data in self.current_sources.values():
-            src_data._load()
-
-        # Loop through custom connectivity updates
-        for cu_data in self.custom_connectivity_updates.values():
-            cu_data._load()
+        if self._ensemble is None:
+            self._runtime.initialize()
+        else:
+            self._ensemble.initialize()
 
-        # Loop through custom updates
-        for cu_data in self.custom_updates.values():
-            cu_data._load()
+        # Load groups into each runtime
+        # **NOTE** in reverse order so groups are left accessing first replica
+        for r in reversed(runtimes):
+            self._runtime = r
+            self._load_groups("_load")
 
         # Now everything is set up call the sparse initialisation function
-        self._runtime.initialize_sparse()
+        if self._ensemble is None:
+            self._runtime.initialize_sparse()
+        else:
+            self._ensemble.initialize_sparse()
+        self._reload_reallocated_rows()
 
         # Set loaded flag and built flag
         self._loaded = True
@@ -769,39 +802,92 @@ class GeNNModel(ModelSpec):
         """Unload a previously loaded model, freeing all memory"""
         if not self._loaded:
             raise Exception("GeNN model has not been built")
-            
-        # Loop through custom updates and unload
-        for cu_data in self.custom_updates.values():
-            cu_data._unload()
+
+        # Wait for any asynchronous steps and shut down worker thread
+        # **NOTE** model is unloaded even if a step failed and 
+        # the failure is then re-raised once unloading completes
+        try:
+            self._wait_for_async()
+        finally:
+            if self._async_executor is not None:
+                self._async_executor.shutdown()
+                self._async_executor = None
+
+            # Loop through custom updates and unload
+            for cu_data in self.custom_updates.values():
+                cu_data._unload()
         
-        # Loop through custom connectivity updates and unload
-        for cu_data in self.custom_connectivity_updates.values():
-            cu_data._unload()
+            # Loop through custom connectivity updates and unload
+            for cu_data in self.custom_connectivity_updates.values():
+                cu_data._unload()
     
-        # Loop through current sources and unload
-        for src_data in self.current_sources.values():
-            src_data._unload()
+            # Loop through current sources and unload
+            for src_data in self.current_sources.values():
+                src_data._unload()
 
-        # Loop through synapse populations and unload
-        for pop_data in self.synapse_populations.values():
-            pop_data._unload()
+            # Loop through synapse populations and unload
+            for pop_data in self.synapse_populations.values():
+                pop_data._unload()
 
-        # Loop through neuron populations and unload
-        for pop_data in self.neuron_populations.values():
-            pop_data._unload()
+            # Loop through neuron populations and unload
+            for pop_data in self.neuron_populations.values():
+                pop_data._unload()
 
-        # Close runtime
-        self._runtime = None
+            # Close runtime
+            self._runtime = None
+            self._ensemble = None
 
-        # Clear loaded flag
-        self._loaded = False
+            # Clear loaded flag
+            self._loaded = False
 
     def step_time(self):
         """Make one simulation step"""
         if not self._loaded:
             raise Exception("GeNN model has to be loaded before stepping")
 
-        self._runtime.step_time()
+        self._wait_for_async()
+        if self._ensemble is None:
+            self._runtime.step_time()
+        else:
+            self._ensemble.step_time()
+
+    def step_time_async(self, num_timesteps: int = 1,
+                        snapshot_vars: Sequence[Tuple] = ()) -> Future:
+        """Make a number of simulation steps on a background thread.
+        The GIL is released while simulating so other Python threads can run.
+
+        Calls are queued and run in order. While any are in progress,
+        variable views should not be accessed; instead, variables required
+        for analysis should be snapshotted after the steps complete.
+        Each call snapshots into its own newly-allocated arrays which are 
+        never overwritten by later calls, allowing the results of step k 
+        to be processed while steps k+1..k+n run.
+        Any exceptions raised by queued calls are re-raised by the next
+        synchronous operation, even if their futures were never checked.
+
+        Args:
+            num_timesteps:  Number of timesteps to simulate
+            snapshot_vars:  Sequence of ``(group, var_name)`` tuples
+                            specifying variables to copy after simulating
+        Returns:
+            Future whose result is a dictionary mapping 
+            ``(group.name, var_name)`` tuples to snapshotted arrays
+        """
+        if not self._loaded:
+            raise Exception("GeNN model has to be loaded before stepping")
+
+        # Forget futures which have already completed successfully
+        # **NOTE** futures which raised are kept so _wait_for_async re-raises
+        self._async_futures = [f for f in self._async_futures
+                               if not f.done() or f.exception() is not None]
+
+        # Create worker thread if required and submit
+        if self._async_executor is None:
+            self._async_executor = ThreadPoolExecutor(max_workers=1)
+        future = self._async_executor.submit(
+            self._step_time_snapshot, num_timesteps, list(snapshot_vars))
+        self._async_futures.append(future)
+        return future
     
     def custom_update(self, name: str):
         """Perform custom update
@@ -814,7 +900,16 @@ class GeNNModel(ModelSpec):
         if not self._loaded:
             raise Exception("GeNN model has to be loaded before performing custom update")
             
-        self._runtime.custom_update(name)
+        # **NOTE** rows are reallocated before the runtime reports
+        # synapses which couldn't be added to full rows so reload them regardless
+        self._wait_for_async()
+        try:
+            if self._ensemble is None:
+                self._runtime.custom_update(name)
+            else:
+                self._ensemble.custom_update(name)
+        finally:
+            self._reload_reallocated_rows()
    
 
     def pull_recording_buffers_from_device(self):
@@ -826,7 +921,108 @@ class GeNNModel(ModelSpec):
             raise Exception("Cannot pull recording buffer if recording system is not in use")
 
         # Pull recording buffers from device
-        self._runtime.pull_recording_buffers_from_device()
+        self._wait_for_async()
+        if self._ensemble is None:
+            self._runtime.pull_recording_buffers_from_device()
+        else:
+            self._ensemble.pull_recording_buffers_from_device()
+
+    def get_ensemble_var_values(self, group, var_name: str) -> np.ndarray:
+        """Pull a variable from every replica of a loaded ensemble
+
+        Args:
+            group:      Population, current source or custom update
+            var_name:   Name of variable
+        Returns:
+            Array with first axis indexing replica and 
+            remaining axes matching ``group.vars[var_name].view``
+        """
+        if self._ensemble is None:
+            raise Exception("GeNN model has to be loaded as an ensemble")
+
+        view = group.vars[var_name].view
+        values = []
+        for i in range(self._ensemble.num_replicas):
+            array = self._ensemble.get_replica(i).get_array(group, var_name)
+            array.pull_from_device()
+            values.append(np.reshape(np.asarray(array.host_view).view(view.dtype),
+                                     view.shape))
+        return np.stack(values)
+
+    def set_ensemble_dynamic_param_values(self, group, name: str,
+                                          values: Sequence[Union[float, int]]):
+        """Set the value of a dynamic parameter in every
+        replica of a loaded ensemble
+
+        Args:
+            group:  Population, current source or custom update
+            name:   Name of the parameter
+            values: Numeric value to assign to parameter in each replica
+        """
+        if self._ensemble is None:
+            raise Exception("GeNN model has to be loaded as an ensemble")
+        if len(values) != self._ensemble.num_replicas:
+            raise Exception("One value is required for each replica")
+
+        for i, v in enumerate(values):
+            self._ensemble.get_replica(i).set_dynamic_param_value(
+                group, name, NumericValue(v))
+
+    def _step_time_snapshot(self, num_timesteps, snapshot_vars):
+        # Simulate
+        # **NOTE** GIL is released within runtime
+        if self._ensemble is None:
+            self._runtime.step_time(num_timesteps)
+        else:
+            self._ensemble.step_time(num_timesteps)
+
+        # Loop through variables to snapshot
+        # **NOTE** arrays are copied rather than reusing buffers from earlier
+        # calls as the caller may still be reading their results
+        snapshot = {}
+        for group, var_name in snapshot_vars:
+            # Pull variable from device and copy
+            var = group.vars[var_name]
+            var.pull_from_device()
+            snapshot[(group.name, var_name)] = np.copy(var.view)
+        return snapshot
+
+    def _wait_for_async(self):
+        # Wait for all asynchronous steps in progress
+        futures = self._async_futures
+        self._async_futures = []
+        exception = None
+        for f in futures:
+            # Remember first exception raised by any step
+            e = f.exception()
+            if e is not None and exception is None:
+                exception = e
+
+        # Re-raise exception in calling thread
+        if exception is not None:
+            raise exception
+
+    def _load_groups(self, method: str):
+        # Loop through neuron populations, synapse populations, current
+        # sources, custom connectivity updates and custom updates
+        # **NOTE** synapse populations which share connectivity are processed
+        # after all others so that the connectivity they share is loaded first
+        sorted_synapse_populations = dict(
+            sorted(self.synapse_populations.items(),
+                   key=lambda s: s[1].shared_connectivity_target is not None))
+        for groups in (self.neuron_populations, sorted_synapse_populations,
+                       self.current_sources, self.custom_connectivity_updates,
+                       self.custom_updates):
+            for g in groups.values():
+                getattr(g, method)()
+
+    def _reload_reallocated_rows(self):
+        # Re-obtain views of per-synapse arrays belonging to synapse 
+        # populations whose rows have been reallocated by the runtime
+        for s in self.synapse_populations.values():
+            if (s.row_capacity_slack > 0 
+                    and s._loaded_row_stride != s._row_stride):
+                s._reload_rows()
 
 def init_var(snippet: Union[InitVarSnippetBase, str],
              params: PopParamVals = {}):
@@ -1089,7 +1285,10 @@ def create_neuron_model(class_name: str, params: ModelParamsType = None,
                         reset_code: Optional[str] = None,
                         extra_global_params: ModelEGPType = None,
                         additional_input_vars=None,
-                        auto_refractory_required: bool = False):
+                        auto_refractory_required: bool = False,
+                        linear_dynamics=None,
+                        nonlinear_dynamics=None,
+                        nonlinear_dynamics_substeps: int = 1):
     """Creates a new neuron model.
     Within all of the code strings, the variables, parameters,
     derived parameters, additional input variables and extra global
@@ -1122,6 +1321,18 @@ def create_neuron_model(class_name: str, params: ModelParamsType = None,
                                     local input variables
         auto_refractory_required:   does this model require auto-refractory
                                     logic to be generated?
+        linear_dynamics:            tuple containing names of variables, a 
+                                    callable to calculate the coefficient
+                                    matrix from params and dt and a list of
+                                    (possibly empty) input code strings 
+                                    describing a linear system of ODEs 
+                                    which will be integrated exactly
+        nonlinear_dynamics:         list of tuples with names of variables
+                                    and code strings for their derivatives
+                                    which will be integrated using the 
+                                    4th-order Runge-Kutta method
+        nonlinear_dynamics_substeps: number of Runge-Kutta substeps to use
+                                    to integrate nonlinear dynamics
     
     For example, we can define a leaky integrator :math:`\\tau\\frac{dV}{dt}= -V + I_{{\\rm syn}}` solved using Euler's method:
 
@@ -1160,6 +1371,23 @@ def create_neuron_model(class_name: str, params: ModelParamsType = None,
             \""",
         ...
 
+    Dynamics
+    --------
+    Rather than integrating variables in the sim code, models can declare their dynamics.
+    Linear dynamics of the form :math:`\\frac{dx}{dt} = Ax + b` are integrated exactly,
+    with the propagators required to advance them by one timestep calculated once, when the model is built.
+    For example, our leaky integrator could be integrated exactly as follows:
+
+    ..  code-block:: python
+
+        ...
+        linear_dynamics=(["V"], lambda pars, dt: [[-1.0 / pars["tau"]]],
+                         ["Isyn / tau"]),
+        ...
+
+    Any other dynamics can be integrated using the 4th-order Runge-Kutta method.
+    Both kinds of dynamics are integrated at the start of each timestep, before the sim code runs.
+
     """
     body = {}
     
@@ -1194,6 +1422,27 @@ def create_neuron_model(class_name: str, params: ModelParamsType = None,
         body["is_auto_refractory_required"] = \
             lambda self: auto_refractory_required
 
+    if linear_dynamics is not None:
+        # Helper to extract underlying value from NumericValue
+        # parameters and flatten resulting coefficient matrix
+        def wrap_coefficients(f):
+            return lambda pars, dt: np.ravel(f({n: p.value
+                                                for n, p in pars.items()},
+                                               dt)).astype(float).tolist()
+
+        body["get_linear_dynamics"] = \
+            lambda self: LinearDynamics(linear_dynamics[0],
+                                        wrap_coefficients(linear_dynamics[1]),
+                                        [dedent(_upgrade_code_string(i, class_name))
+                                         for i in linear_dynamics[2]])
+
+    if nonlinear_dynamics is not None:
+        body["get_nonlinear_dynamics"] = \
+            lambda self: [ODE(o[0], dedent(_upgrade_code_string(o[1], class_name)))
+                          for o in nonlinear_dynamics]
+        body["get_num_nonlinear_dynamics_substeps"] = \
+            lambda self: nonlinear_dynamics_substeps
+
     return _create_model(class_name, NeuronModelBase, params, param_names,
                          derived_params, extra_global_params, body)
 
@@ -1284,7 +1533,8 @@ def create_weight_update_model(
         post_spike_code: Optional[str] = None,
         pre_dynamics_code: Optional[str] = None,
         post_dynamics_code: Optional[str] = None,
-        extra_global_params: ModelEGPType  = None):
+        extra_global_params: ModelEGPType  = None,
+        lazy_decay_vars: Optional[Sequence[Tuple[str, str]]] = None):
     """Creates a new weight update model.
     GeNN operates on the assumption that the postsynaptic output of the synapses are added linearly at the postsynaptic neuron.
     Within all of the synaptic code strings (``pre_spike_syn_code``, ``pre_event_syn_code``,
@@ -1377,6 +1627,11 @@ def create_weight_update_model(
                                                 referenced from this code.
         extra_global_params:                    names and types of model
                                                 extra global parameters
+        lazy_decay_vars:                        names of per-synapse variables
+                                                which decay exponentially
+                                                towards zero and names of the
+                                                parameters or derived parameters
+                                                specifying their time constants
     
     For example, we can define a simple additive STDP rule with 
     nearest-neighbour spike pairing and the following time-dependence (equivalent to :func:`.weight_update_models.STDP`):
@@ -1470,6 +1725,24 @@ def create_weight_update_model(
         pre_neuron_var_refs=[("V_pre", "scalar")],
         synapse_dynamics_code="addToPost(g * V_pre);",
 
+    Lazily-decayed synapse variables
+    --------------------------------
+    Synapse dynamics are often only used to exponentially decay per-synapse variables such as eligibility traces.
+    Such variables can instead be listed in ``lazy_decay_vars`` alongside the name of the parameter or derived parameter 
+    specifying their time constant. GeNN then records the time each synapse was last updated and, whenever the synapse 
+    is next updated by a pre or postsynaptic spike or spike-like event, decays the variables in closed form before running the model's code.
+    For example, an eligibility trace which decays with a time constant of ``tauE`` could be defined as follows:
+
+    ..  code-block:: python
+
+        params=["tauE"],
+        vars=[("g", "scalar", VarAccess.READ_ONLY), ("e", "scalar")],
+        lazy_decay_vars=[("e", "tauE")],
+        pre_spike_syn_code="addToPost(g);\ne += 1.0;",
+
+    Because the values of these variables in memory are only correct at the time each synapse was last updated, 
+    they cannot be referenced by custom updates and custom connectivity updates cannot be attached to their synapse groups.
+
     Spike-like events
     -----------------
     As well as time-driven synapse dynamics and spike event-driven updates, GeNN weight update models also support "spike-like events". 
@@ -1597,6 +1870,10 @@ def create_weight_update_model(
     if psm_var_refs is not None:
         body["get_psm_var_refs"] =\
             lambda self: [VarRef(*v) for v in psm_var_refs]
+
+    if lazy_decay_vars is not None:
+        body["get_lazy_decay_vars"] =\
+            lambda self: [tuple(l) for l in lazy_decay_vars]
     
     return _create_model(class_name, WeightUpdateModelBase, params,
                          param_names, derived_params,
@@ -89,6 +89,7 @@ class VariableBase(ArrayBase):
         super(VariableBase, self).__init__(variable_type, group)
         
         self.name = variable_name
+        self._demoted = False
         self.set_init_values(init_values)
     
     def set_array(self, array, view_shape, delay_group):
@@ -104,6 +105,16 @@ class VariableBase(ArrayBase):
         self._delay_group = (None if delay_group is None 
                              else ref(delay_group))
 
+    def push_to_device(self):
+        """Copy array from host to device"""
+        self._check_not_demoted()
+        super(VariableBase, self).push_to_device()
+
+    def pull_from_device(self):
+        """Copy array device to host"""
+        self._check_not_demoted()
+        super(VariableBase, self).pull_from_device()
+
     @deprecated("Please use set_init_values method instead")
     def set_values(self, values):
         self.set_init_values(values)
@@ -142,9 +153,16 @@ class VariableBase(ArrayBase):
 
     def _unload(self):
         super(VariableBase, self)._unload()
+        self._demoted = False
         for e in self.extra_global_params.values():
             e._unload()
 
+    def _check_not_demoted(self):
+        # **NOTE** variables demoted to constants have no arrays
+        if self._demoted:
+            raise Exception(f"Variable '{self.name}' has been demoted to a "
+                            f"constant so cannot be accessed at runtime")
+
 class Variable(VariableBase):
     """Array class used for exposing per-neuron GeNN variables"""
 
@@ -152,11 +170,14 @@ class Variable(VariableBase):
     def view(self) -> np.ndarray:
         """Memory view of entire variable. If variable is 
         delayed this will contain multiple delayed values."""
+        self._check_not_demoted()
         return self._view
     
     @property
     def current_view(self) -> np.ndarray:
         """Memory view of variable's values written in last timestep"""
+        self._check_not_demoted()
+
         # If there's no delay group, return full view
         if self._delay_group is None:
             return self._view
@@ -178,10 +199,12 @@ class Variable(VariableBase):
     def values(self) -> np.ndarray:
         """Copy of entire variable. If variable is 
         delayed this will contain multiple delayed values."""
+        self._check_not_demoted()
         return np.copy(self._view)
     
     @values.setter
     def values(self, vals: np.ndarray):
+        self._check_not_demoted()
         self._view[:] = vals
 
     @property
@@ -225,7 +248,7 @@ class SynapseVariable(VariableBase):
         elif sg.matrix_type & SynapseMatrixWeight.KERNEL:
             return np.copy(self._view)
         elif sg.matrix_type & SynapseMatrixConnectivity.SPARSE:
-            max_rl = sg.max_connections
+            max_rl = sg._row_stride
             row_ls = (sg._row_lengths._view 
                       if sg._connectivity_initialiser_provided
                       else sg.row_lengths)
@@ -265,7 +288,7 @@ class SynapseVariable(VariableBase):
             # Create range containing the index
             # where each row starts in ind
             row_start_idx = range(0, sg.weight_update_var_size,
-                                  sg.max_connections)
+                                  sg._row_stride)
 
             # Loop through ragged matrix rows
             syn = 0
@@ -95,4 +95,5 @@ PYBIND11_MODULE(cuda_backend, m)
     // Free functions
     //------------------------------------------------------------------------
     m.def("_create_backend", &createBackend, pybind11::return_value_policy::move);
+    m.def("_is_matrix_type_supported", &Optimiser::isMatrixTypeSupported);
 }
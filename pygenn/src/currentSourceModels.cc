@@ -39,4 +39,5 @@ PYBIND11_MODULE(current_source_models, m)
     WRAP(DC);
     WRAP(GaussianNoise);
     WRAP(PoissonExp);
+    WRAP(AggregatedPoissonExp);
 }
@@ -499,6 +499,11 @@ static const char *__doc_CodeGenerator_PreferencesBase_debugCode = R"doc(Generat
 
 static const char *__doc_CodeGenerator_PreferencesBase_gennLogLevel = R"doc(Logging level to use for model description)doc";
 
+static const char *__doc_CodeGenerator_PreferencesBase_maxSpecialisedGroups =
+R"doc(If no more than this many populations would be merged into one type of merged
+group, give each population its own merged group instead. This generates fully
+specialised code where sizes and parameters are all compile-time literals)doc";
+
 static const char *__doc_CodeGenerator_PreferencesBase_optimizeCode = R"doc(Generate speed-optimized code, potentially at the expense of floating-point accuracy)doc";
 
 static const char *__doc_CodeGenerator_PreferencesBase_runtimeLogLevel = R"doc(Logging level to use for runtime)doc";
@@ -553,6 +558,34 @@ static const char *__doc_CurrentSourceInternal_CurrentSourceInternal = R"doc()do
 
 static const char *__doc_CurrentSourceModels_Base = R"doc(Base class for all current source models)doc";
 
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp =
+R"doc(Current source for injecting a current equivalent to several classes of
+Poisson spike sources, connected with exponential synapses
+Rather than simulating each source, the number of spikes arriving from each class
+every timestep is drawn directly from a Poisson distribution with mean K * nu * dt,
+where K is the number of sources in the class and nu is their mean firing rate.
+It has 2 parameters:
+
+- ``tauSyn``      - decay time constant [ms]
+- ``numClasses``  - number of classes of Poisson spike sources
+
+and 2 extra global parameters, each with ``numClasses`` entries:
+
+- ``weight``  - synaptic weight of the Poisson spikes in each class [nA]
+- ``rate``    - total mean firing rate K * nu of the Poisson spike sources in each class [Hz])doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getDerivedParams = R"doc()doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getExtraGlobalParams = R"doc()doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getInjectionCode = R"doc()doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getInstance = R"doc()doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getParams = R"doc()doc";
+
+static const char *__doc_CurrentSourceModels_AggregatedPoissonExp_getVars = R"doc()doc";
+
 static const char *__doc_CurrentSourceModels_Base_getHashDigest = R"doc(Update hash from model)doc";
 
 static const char *__doc_CurrentSourceModels_Base_getInjectionCode = R"doc(Gets the code that defines current injected each timestep)doc";
@@ -685,8 +718,14 @@ static const char *__doc_CurrentSource_getVarLocation = R"doc(Get variable locat
 
 static const char *__doc_CurrentSource_getVarLocationHashDigest = R"doc()doc";
 
+static const char *__doc_CurrentSource_getVarTraces = R"doc(Get traces of current source state variables recorded)doc";
+
 static const char *__doc_CurrentSource_isParamDynamic = R"doc(Is parameter dynamic i.e. it can be changed at runtime)doc";
 
+static const char *__doc_CurrentSource_isVarDemoted =
+R"doc(Has variable been demoted to a constant, meaning no array is allocated for it?
+This can only be called after model is finalized)doc";
+
 static const char *__doc_CurrentSource_isVarInitRequired = R"doc(Is var init code required for any variables in this current source?)doc";
 
 static const char *__doc_CurrentSource_isZeroCopyEnabled = R"doc()doc";
@@ -719,6 +758,8 @@ static const char *__doc_CurrentSource_m_VarLocation =
 R"doc(Location of individual state variables.
 This is ignored for simulations on hardware with a single memory space.)doc";
 
+static const char *__doc_CurrentSource_m_VarTraces = R"doc(Traces of current source state variables being recorded)doc";
+
 static const char *__doc_CurrentSource_setExtraGlobalParamLocation =
 R"doc(Set location of extra global parameter.
 This is ignored for simulations on hardware with a single memory space.)doc";
@@ -733,6 +774,12 @@ static const char *__doc_CurrentSource_setVarLocation =
 R"doc(Set location of current source state variable.
 This is ignored for simulations on hardware with a single memory space.)doc";
 
+static const char *__doc_CurrentSource_setVarTraceRecording =
+R"doc(Enable recording of trace of current source state variable
+
+Every interval timesteps, the values of the variable in the target neurons specified by neuronIDs are
+written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace.)doc";
+
 static const char *__doc_CustomConnectivityUpdate = R"doc()doc";
 
 static const char *__doc_CustomConnectivityUpdate_2 = R"doc()doc";
@@ -2353,7 +2400,11 @@ pointer to newly created SynapseGroup)doc";
 
 static const char *__doc_ModelSpec_addSynapsePopulation_3 = R"doc()doc";
 
-static const char *__doc_ModelSpec_finalise = R"doc(Finalise model)doc";
+static const char *__doc_ModelSpec_finalise =
+R"doc(Finalise model
+
+Synapse groups with SynapseMatrixType::AUTO are resolved to matrix types for which
+isMatrixTypeSupported returns true or, if it is not provided, to any matrix type)doc";
 
 static const char *__doc_ModelSpec_findCurrentSource = R"doc(Find a current source by name)doc";
 
@@ -2365,6 +2416,8 @@ static const char *__doc_ModelSpec_findSynapseGroup = R"doc(Find a synapse group
 
 static const char *__doc_ModelSpec_findSynapseGroup_2 = R"doc(Find a synapse group by name)doc";
 
+static const char *__doc_ModelSpec_getAutoMatrixMemoryBudget = R"doc(Gets memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO)doc";
+
 static const char *__doc_ModelSpec_getBatchSize = R"doc()doc";
 
 static const char *__doc_ModelSpec_getCustomConnectivityUpdates = R"doc(Get std::map containing named CustomConnectivity objects in model)doc";
@@ -2397,8 +2450,16 @@ static const char *__doc_ModelSpec_getTypeContext = R"doc()doc";
 
 static const char *__doc_ModelSpec_isRecordingInUse = R"doc(Is recording enabled on any population in this model?)doc";
 
+static const char *__doc_ModelSpec_isApproximateMathsEnabled = R"doc(Are approximate maths functions used in all simulation code)doc";
+
+static const char *__doc_ModelSpec_isProfilingEnabled = R"doc(Are per-merged-group profiling counters enabled)doc";
+
 static const char *__doc_ModelSpec_isTimingEnabled = R"doc(Are timers and timing commands enabled)doc";
 
+static const char *__doc_ModelSpec_m_ApproximateMathsEnabled = R"doc(Whether approximate maths functions should be used in all simulation code)doc";
+
+static const char *__doc_ModelSpec_m_AutoMatrixMemoryBudget = R"doc(Memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO)doc";
+
 static const char *__doc_ModelSpec_m_BatchSize = R"doc(Batch size of this model - efficiently duplicates model)doc";
 
 static const char *__doc_ModelSpec_m_CustomConnectivityUpdates = R"doc(Named custom connectivity updates)doc";
@@ -2420,6 +2481,10 @@ static const char *__doc_ModelSpec_m_DefaultSparseConnectivityLocation = R"doc(T
 
 static const char *__doc_ModelSpec_m_DefaultVarLocation = R"doc(The default location for model state variables?)doc";
 
+static const char *__doc_ModelSpec_m_DemoteConstantReadOnlyVars =
+R"doc(Should read-only variables initialised to a constant be demoted to constants?
+This reduces memory usage and bandwidth but means that demoted variables cannot be retrieved or modified at runtime)doc";
+
 static const char *__doc_ModelSpec_m_FusePostsynapticModels =
 R"doc(Should compatible postsynaptic models and dendritic delay buffers be fused?
 This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved)doc";
@@ -2442,12 +2507,27 @@ static const char *__doc_ModelSpec_m_Seed = R"doc(RNG seed)doc";
 
 static const char *__doc_ModelSpec_m_TimePrecision = R"doc(Type of floating point variables used for 'timepoint' types)doc";
 
+static const char *__doc_ModelSpec_m_ProfilingEnabled = R"doc(Whether per-merged-group profiling counters should be inserted into model)doc";
+
 static const char *__doc_ModelSpec_m_TimingEnabled = R"doc(Whether timing code should be inserted into model)doc";
 
 static const char *__doc_ModelSpec_m_TypeContext = R"doc()doc";
 
 static const char *__doc_ModelSpec_operator_assign = R"doc()doc";
 
+static const char *__doc_ModelSpec_setApproximateMathsEnabled =
+R"doc(Set whether exp, expm1, log and tanh should be replaced by faster, vectorisable approximations, and an approximate sigmoid provided, in all simulation code
+
+See CodeGenerator::StandardLibrary::getApproximateMathsFunctions for error bounds.
+Can also be enabled for individual neuron groups with NeuronGroup::setApproximateMathsEnabled.
+**NOTE** currently only implemented by the single-threaded CPU backend)doc";
+
+static const char *__doc_ModelSpec_setAutoMatrixMemoryBudget =
+R"doc(Set memory budget (in bytes) shared between all synapse groups with SynapseMatrixType::AUTO
+
+Synapse groups are resolved in name order and each uses the fastest compatible matrix type which fits
+within the remaining budget or, if none do, the one which uses the least memory. By default the budget is unlimited.)doc";
+
 static const char *__doc_ModelSpec_setBatchSize = R"doc()doc";
 
 static const char *__doc_ModelSpec_setDT = R"doc(Set the integration step size of the model)doc";
@@ -2466,6 +2546,10 @@ static const char *__doc_ModelSpec_setDefaultVarLocation =
 R"doc(What is the default location for model state variables?
 Historically, everything was allocated on both the host AND device)doc";
 
+static const char *__doc_ModelSpec_setDemoteConstantReadOnlyVars =
+R"doc(Should read-only variables initialised to a constant be demoted to constants?
+This reduces memory usage and bandwidth but means that demoted variables cannot be retrieved or modified at runtime)doc";
+
 static const char *__doc_ModelSpec_setFusePostsynapticModels =
 R"doc(Should compatible postsynaptic models and dendritic delay buffers be fused?
 This can significantly reduce the cost of updating neuron population but means that per-synapse group inSyn arrays can not be retrieved)doc";
@@ -2482,6 +2566,13 @@ static const char *__doc_ModelSpec_setSeed = R"doc(Set the random seed (disables
 
 static const char *__doc_ModelSpec_setTimePrecision = R"doc(Set numerical precision for time type)doc";
 
+static const char *__doc_ModelSpec_setProfilingEnabled =
+R"doc(Set whether per-merged-group profiling counters are to be included
+
+These record time, neurons processed, spikes emitted and synapses traversed for every
+population in every merged update group. **NOTE** currently only implemented by the single-threaded CPU backend;
+other backends throw when the model is merged)doc";
+
 static const char *__doc_ModelSpec_setTimingEnabled = R"doc(Set whether timers and timing commands are to be included)doc";
 
 static const char *__doc_ModelSpec_zeroCopyInUse = R"doc(Are any variables in any populations in this model using zero-copy memory?)doc";
@@ -2841,6 +2932,10 @@ R"doc(Updates hash with neuron group
 
     this can only be called after model is finalized)doc";
 
+static const char *__doc_NeuronGroup_getISIHistogramBinWidth = R"doc(Get width (in ms) of inter-spike interval histogram bins)doc";
+
+static const char *__doc_NeuronGroup_getISIHistogramNumBins = R"doc(Get number of bins in inter-spike interval histogram)doc";
+
 static const char *__doc_NeuronGroup_getInSyn = R"doc(Gets pointers to all synapse groups which provide input to this neuron group)doc";
 
 static const char *__doc_NeuronGroup_getInitHashDigest =
@@ -2880,6 +2975,8 @@ static const char *__doc_NeuronGroup_getSpikeLocation = R"doc(Get location of th
 
 static const char *__doc_NeuronGroup_getSpikeQueueUpdateHashDigest = R"doc()doc";
 
+static const char *__doc_NeuronGroup_getSpikeRateTau = R"doc(Get time constant (in ms) of per-neuron firing rate estimator)doc";
+
 static const char *__doc_NeuronGroup_getSpikeTimeLocation = R"doc(Get location of this neuron group's output spike times)doc";
 
 static const char *__doc_NeuronGroup_getThresholdConditionCodeTokens = R"doc(Tokens produced by scanner from threshold condition code)doc";
@@ -2890,10 +2987,16 @@ static const char *__doc_NeuronGroup_getVarLocation = R"doc(Get location of neur
 
 static const char *__doc_NeuronGroup_getVarLocationHashDigest = R"doc()doc";
 
+static const char *__doc_NeuronGroup_getVarTraces = R"doc(Get traces of neuron model state variables recorded for this population)doc";
+
 static const char *__doc_NeuronGroup_injectCurrent = R"doc(add input current source)doc";
 
+static const char *__doc_NeuronGroup_isApproximateMathsEnabled = R"doc(Are approximate maths functions used in this population's update code?)doc";
+
 static const char *__doc_NeuronGroup_isDelayRequired = R"doc()doc";
 
+static const char *__doc_NeuronGroup_isISIHistogramEnabled = R"doc(Is inter-spike interval histogram enabled for this population?)doc";
+
 static const char *__doc_NeuronGroup_isInitRNGRequired = R"doc(Does this neuron group require an RNG for it's init code?)doc";
 
 static const char *__doc_NeuronGroup_isParamDynamic = R"doc(Is parameter dynamic i.e. it can be changed at runtime)doc";
@@ -2910,6 +3013,8 @@ be used for spike and spike-like event recording)doc";
 
 static const char *__doc_NeuronGroup_isSimRNGRequired = R"doc(Does this neuron group require an RNG to simulate?)doc";
 
+static const char *__doc_NeuronGroup_isSpikeCountRecordingEnabled = R"doc(Is spike count recording enabled for this population?)doc";
+
 static const char *__doc_NeuronGroup_isSpikeDelayRequired = R"doc()doc";
 
 static const char *__doc_NeuronGroup_isSpikeEventDelayRequired = R"doc()doc";
@@ -2924,12 +3029,18 @@ static const char *__doc_NeuronGroup_isSpikeEventTimeRequired = R"doc()doc";
 
 static const char *__doc_NeuronGroup_isSpikeQueueRequired = R"doc()doc";
 
+static const char *__doc_NeuronGroup_isSpikeRateEstimationEnabled = R"doc(Is per-neuron firing rate estimation enabled for this population?)doc";
+
 static const char *__doc_NeuronGroup_isSpikeRecordingEnabled = R"doc(Is spike recording enabled for this population?)doc";
 
 static const char *__doc_NeuronGroup_isSpikeTimeRequired = R"doc()doc";
 
 static const char *__doc_NeuronGroup_isTrueSpikeRequired = R"doc()doc";
 
+static const char *__doc_NeuronGroup_isVarDemoted =
+R"doc(Has variable been demoted to a constant, meaning no array is allocated for it?
+This can only be called after model is finalized)doc";
+
 static const char *__doc_NeuronGroup_isVarInitRequired =
 R"doc(Does this neuron group require any variables initializing?
 Because it occurs in the same kernel, this includes current source variables;
@@ -2940,6 +3051,8 @@ static const char *__doc_NeuronGroup_isVarQueueRequired = R"doc()doc";
 
 static const char *__doc_NeuronGroup_isZeroCopyEnabled = R"doc()doc";
 
+static const char *__doc_NeuronGroup_m_ApproximateMathsEnabled = R"doc(Should approximate maths functions be used in update code?)doc";
+
 static const char *__doc_NeuronGroup_m_CurrentSourceGroups = R"doc()doc";
 
 static const char *__doc_NeuronGroup_m_DerivedParams = R"doc()doc";
@@ -2962,6 +3075,10 @@ static const char *__doc_NeuronGroup_m_FusedWUPostInSyn = R"doc()doc";
 
 static const char *__doc_NeuronGroup_m_FusedWUPreOutSyn = R"doc()doc";
 
+static const char *__doc_NeuronGroup_m_ISIHistogramBinWidth = R"doc(Width of inter-spike interval histogram bins)doc";
+
+static const char *__doc_NeuronGroup_m_ISIHistogramNumBins = R"doc(Number of bins in inter-spike interval histogram (zero if disabled))doc";
+
 static const char *__doc_NeuronGroup_m_InSyn = R"doc()doc";
 
 static const char *__doc_NeuronGroup_m_Model = R"doc(Neuron model used for this group)doc";
@@ -2994,6 +3111,8 @@ static const char *__doc_NeuronGroup_m_ResetCodeTokens = R"doc(Tokens produced b
 
 static const char *__doc_NeuronGroup_m_SimCodeTokens = R"doc(Tokens produced by scanner from simc ode)doc";
 
+static const char *__doc_NeuronGroup_m_SpikeCountRecordingEnabled = R"doc(Is spike count recording enabled?)doc";
+
 static const char *__doc_NeuronGroup_m_SpikeEventLocation =
 R"doc(Location of spike-like events from neuron group.
 This is ignored for simulations on hardware with a single memory space)doc";
@@ -3012,6 +3131,8 @@ This is ignored for simulations on hardware with a single memory space)doc";
 
 static const char *__doc_NeuronGroup_m_SpikeQueueRequired = R"doc(Is queueing required for spikes?)doc";
 
+static const char *__doc_NeuronGroup_m_SpikeRateTau = R"doc(Time constant of firing rate estimator (zero if disabled))doc";
+
 static const char *__doc_NeuronGroup_m_SpikeRecordingEnabled = R"doc(Is spike recording enabled for this population?)doc";
 
 static const char *__doc_NeuronGroup_m_SpikeTimeLocation =
@@ -3028,10 +3149,23 @@ This is ignored for simulations on hardware with a single memory space)doc";
 
 static const char *__doc_NeuronGroup_m_VarQueueRequired = R"doc(Set of names of variable requiring queueing)doc";
 
+static const char *__doc_NeuronGroup_m_VarTraces = R"doc(Traces of neuron model state variables being recorded)doc";
+
+static const char *__doc_NeuronGroup_setApproximateMathsEnabled =
+R"doc(Set whether exp, expm1, log and tanh should be replaced by faster, vectorisable approximations, and an approximate sigmoid provided, in this population's update code
+
+This includes the code of any current sources and postsynaptic models which are updated alongside it.
+**NOTE** currently only implemented by the single-threaded CPU backend)doc";
+
 static const char *__doc_NeuronGroup_setExtraGlobalParamLocation =
 R"doc(Set location of neuron model extra global parameter.
 This is ignored for simulations on hardware with a single memory space.)doc";
 
+static const char *__doc_NeuronGroup_setISIHistogram = R"doc(Configure per-population inter-spike interval histogram
+
+Histogram consists of numBins bins, each binWidth ms wide, stored in the 'isiHist' array.
+The final bin counts all intervals that exceed the range of the histogram. Zero bins disables the histogram.)doc";
+
 static const char *__doc_NeuronGroup_setParamDynamic = R"doc(Set whether parameter is dynamic or not i.e. it can be changed at runtime)doc";
 
 static const char *__doc_NeuronGroup_setPrevSpikeEventTimeLocation =
@@ -3047,6 +3181,10 @@ R"doc(Set whether zero-copy memory (if available) should be
 used for spike and spike-like event recording.
 This is ignored for simulations on hardware with a single memory space)doc";
 
+static const char *__doc_NeuronGroup_setSpikeCountRecordingEnabled = R"doc(Enables and disable recording of the number of spikes emitted by this population each timestep
+
+Unlike spike recording, this only requires a single counter per timestep rather than a bit per neuron)doc";
+
 static const char *__doc_NeuronGroup_setSpikeEventLocation =
 R"doc(Set location of this neuron group's output spike events.
 This is ignored for simulations on hardware with a single memory space)doc";
@@ -3065,6 +3203,10 @@ This is ignored for simulations on hardware with a single memory space)doc";
 
 static const char *__doc_NeuronGroup_setSpikeQueueRequired = R"doc()doc";
 
+static const char *__doc_NeuronGroup_setSpikeRateTau = R"doc(Set time constant (in ms) of exponentially-decaying per-neuron firing rate estimator
+
+A time constant of zero disables rate estimation. Estimated rates (in Hz) are stored in the 'spkRate' array)doc";
+
 static const char *__doc_NeuronGroup_setSpikeRecordingEnabled = R"doc(Enables and disable spike recording for this population)doc";
 
 static const char *__doc_NeuronGroup_setSpikeTimeLocation =
@@ -3077,14 +3219,43 @@ This is ignored for simulations on hardware with a single memory space)doc";
 
 static const char *__doc_NeuronGroup_setVarQueueRequired = R"doc()doc";
 
+static const char *__doc_NeuronGroup_setVarTraceRecording =
+R"doc(Enable recording of trace of neuron model state variable
+
+Every interval timesteps, the values of the variable in the neurons specified by neuronIDs are
+written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace.)doc";
+
 static const char *__doc_NeuronModels_Base = R"doc(Base class for all neuron models)doc";
 
+static const char *__doc_NeuronModels_Base_LinearDynamics =
+R"doc(A system of linear ODEs, dx/dt = Ax + b, which is integrated exactly.
+The coefficient matrix A is calculated (in row-major order) from the parameters and timestep and
+the propagators required to advance the system by one timestep are calculated once, from this,
+as derived parameters. Each input b is a code string (which may be empty) evaluated at the start
+of each timestep and assumed constant across it e.g. "(Isyn + Ioffset) / C")doc";
+
+static const char *__doc_NeuronModels_Base_ODE =
+R"doc(A nonlinear ODE, dx/dt = f(x), consisting of the name of the
+variable x and a code string expression for its derivative f(x))doc";
+
 static const char *__doc_NeuronModels_Base_getAdditionalInputVars =
 R"doc(Gets names, types (as strings) and initial values of local variables into which
 the 'apply input code' of (potentially) multiple postsynaptic input models can apply input)doc";
 
+static const char *__doc_NeuronModels_Base_getDynamicsCode = R"doc(Get code to integrate any linear and nonlinear dynamics, which is inserted before the sim code)doc";
+
 static const char *__doc_NeuronModels_Base_getHashDigest = R"doc(Update hash from model)doc";
 
+static const char *__doc_NeuronModels_Base_getLinearDynamics = R"doc(Gets system of linear ODEs which will be integrated exactly at the start of each timestep)doc";
+
+static const char *__doc_NeuronModels_Base_getLinearDynamicsDerivedParams = R"doc(Get derived parameters used to hold the propagators of any linear dynamics)doc";
+
+static const char *__doc_NeuronModels_Base_getNonlinearDynamics =
+R"doc(Gets nonlinear ODEs which will be integrated using the classical 4th-order Runge-Kutta
+method after any linear dynamics but before the sim code at each timestep)doc";
+
+static const char *__doc_NeuronModels_Base_getNumNonlinearDynamicsSubsteps = R"doc(Gets number of Runge-Kutta substeps used to integrate nonlinear dynamics each timestep)doc";
+
 static const char *__doc_NeuronModels_Base_getResetCode = R"doc(Gets code that defines the reset action taken after a spike occurred. This can be empty)doc";
 
 static const char *__doc_NeuronModels_Base_getSimCode =
@@ -3706,6 +3877,8 @@ static const char *__doc_SynapseGroup_getMaxConnections = R"doc()doc";
 
 static const char *__doc_SynapseGroup_getMaxDendriticDelayTimesteps = R"doc()doc";
 
+static const char *__doc_SynapseGroup_getMaxDendriticDelayEvents = R"doc()doc";
+
 static const char *__doc_SynapseGroup_getMaxSourceConnections = R"doc()doc";
 
 static const char *__doc_SynapseGroup_getName = R"doc()doc";
@@ -3735,6 +3908,8 @@ static const char *__doc_SynapseGroup_getPSNeuronVarReferences = R"doc(Get 'reso
 
 static const char *__doc_SynapseGroup_getPSVarLocation = R"doc(Get location of postsynaptic model state variable)doc";
 
+static const char *__doc_SynapseGroup_getPSVarTraces = R"doc(Get traces of postsynaptic model state variables recorded)doc";
+
 static const char *__doc_SynapseGroup_getParallelismHint = R"doc()doc";
 
 static const char *__doc_SynapseGroup_getPostTargetVar =
@@ -3753,6 +3928,13 @@ static const char *__doc_SynapseGroup_getPreTargetVar =
 R"doc(Get name of neuron input variable which a presynaptic output specified with $(addToPre) will target
 This will either be 'Isyn' or the name of one of the presynaptic neuron's additional input variables.)doc";
 
+static const char *__doc_SynapseGroup_getRowCapacitySlack = R"doc()doc";
+
+static const char *__doc_SynapseGroup_getSharedConnectivityTarget =
+R"doc(Get synapse group whose sparse connectivity this synapse group shares
+
+If this is nullptr, this synapse group has its own connectivity)doc";
+
 static const char *__doc_SynapseGroup_getSparseConnectivityInitialiser = R"doc()doc";
 
 static const char *__doc_SynapseGroup_getSparseConnectivityLocation = R"doc(Get variable mode used for sparse connectivity)doc";
@@ -3825,12 +4007,22 @@ NOTE: this can only be called after model is finalized)doc";
 
 static const char *__doc_SynapseGroup_getWUVarLocation = R"doc(Get location of weight update model synaptic state variable)doc";
 
+static const char *__doc_SynapseGroup_initMatrixType =
+R"doc(Validate matrix type against initialisers and weight update
+model and calculate the dimensions of connectivity it implies)doc";
+
+static const char *__doc_SynapseGroup_isDendriticDelayWheelEnabled = R"doc(Are dendritic delays implemented using a sparse timing wheel rather than a dense ring buffer?)doc";
+
 static const char *__doc_SynapseGroup_isDendriticOutputDelayRequired = R"doc(Is this synapse group's output dendritically delayed?)doc";
 
 static const char *__doc_SynapseGroup_isPSModelFused = R"doc(Has this synapse group's postsynaptic model been fused with those from other synapse groups?)doc";
 
 static const char *__doc_SynapseGroup_isPSParamDynamic = R"doc(Is postsynaptic model parameter dynamic i.e. it can be changed at runtime)doc";
 
+static const char *__doc_SynapseGroup_isPSVarDemoted =
+R"doc(Has postsynaptic model variable been demoted to a constant, meaning no array is allocated for it?
+This can only be called after model is finalized)doc";
+
 static const char *__doc_SynapseGroup_isPSVarInitRequired = R"doc(Is var init code required for any variables in this synapse group's postsynaptic update model?)doc";
 
 static const char *__doc_SynapseGroup_isPostSpikeEventFused = R"doc(Has this synapse group's postsynaptic spike event generation been fused with those from other synapse groups?)doc";
@@ -3875,6 +4067,12 @@ static const char *__doc_SynapseGroup_isPrevPreSpikeTimeRequired = R"doc(Are PRE
 
 static const char *__doc_SynapseGroup_isProceduralConnectivityRNGRequired = R"doc(Does this synapse group require an RNG to generate procedural connectivity?)doc";
 
+static const char *__doc_SynapseGroup_isRowCapacityGrowable = R"doc(Is the row capacity of this synapse group reallocated at runtime?)doc";
+
+static const char *__doc_SynapseGroup_isSharedConnectivityPreSpikeFused =
+R"doc(Has this synapse group's presynaptic spike processing been fused into
+the traversal of the synapse group whose connectivity it shares?)doc";
+
 static const char *__doc_SynapseGroup_isSparseConnectivityInitRequired = R"doc(Is sparse connectivity initialisation code required for this synapse group?)doc";
 
 static const char *__doc_SynapseGroup_isWUInitRNGRequired = R"doc(Does this synapse group require an RNG for it's weight update init code?)doc";
@@ -3911,6 +4109,8 @@ static const char *__doc_SynapseGroup_m_CustomUpdateReferences =
 R"doc(Custom updates which reference this synapse group.
 Because, if connectivity is sparse, all groups share connectivity this is required if connectivity changes.)doc";
 
+static const char *__doc_SynapseGroup_m_DendriticDelayWheelEnabled = R"doc(Are dendritic delays implemented using a sparse timing wheel?)doc";
+
 static const char *__doc_SynapseGroup_m_DendriticDelayLocation =
 R"doc(Location of this synapse group's dendritic delay buffers.
 This is ignored for simulations on hardware with a single memory space)doc";
@@ -3953,12 +4153,16 @@ model variables which are heterogeneously delayed)doc";
 
 static const char *__doc_SynapseGroup_m_KernelSize = R"doc(Kernel size)doc";
 
-static const char *__doc_SynapseGroup_m_MatrixType = R"doc(Connectivity type of synapses)doc";
+static const char *__doc_SynapseGroup_m_MatrixType = R"doc(Connectivity type of synapses
+
+**NOTE** this is only non-const so AUTO matrix types can be resolved)doc";
 
 static const char *__doc_SynapseGroup_m_MaxConnections = R"doc(Maximum number of target neurons any source neuron can connect to)doc";
 
 static const char *__doc_SynapseGroup_m_MaxDendriticDelayTimesteps = R"doc(Maximum dendritic delay timesteps supported for synapses in this population)doc";
 
+static const char *__doc_SynapseGroup_m_MaxDendriticDelayEvents = R"doc(Maximum number of dendritically delayed events which can be delivered in any single timestep)doc";
+
 static const char *__doc_SynapseGroup_m_MaxSourceConnections = R"doc(Maximum number of source neurons any target neuron can connect to)doc";
 
 static const char *__doc_SynapseGroup_m_Name = R"doc(Name of the synapse group)doc";
@@ -3985,6 +4189,8 @@ static const char *__doc_SynapseGroup_m_PSVarLocation =
 R"doc(Location of postsynaptic model variables.
 This is ignored for simulations on hardware with a single memory space)doc";
 
+static const char *__doc_SynapseGroup_m_PSVarTraces = R"doc(Traces of postsynaptic model state variables being recorded)doc";
+
 static const char *__doc_SynapseGroup_m_ParallelismHint = R"doc(Hint as to how synapse group should be parallelised)doc";
 
 static const char *__doc_SynapseGroup_m_PostTargetVar =
@@ -3995,6 +4201,13 @@ static const char *__doc_SynapseGroup_m_PreTargetVar =
 R"doc(Name of neuron input variable a presynaptic output specified with $(addToPre) will target.
 This will either be 'Isyn' or the name of one of the presynaptic neuron's additional input variables.)doc";
 
+static const char *__doc_SynapseGroup_m_RowCapacitySlack = R"doc(Number of free slots to maintain at the end of each row when row capacity is reallocated at runtime)doc";
+
+static const char *__doc_SynapseGroup_m_SharedConnectivityTarget =
+R"doc(Synapse group whose sparse connectivity this synapse group shares.
+
+If this is nullptr, this synapse group has its own connectivity)doc";
+
 static const char *__doc_SynapseGroup_m_SparseConnectivityInitialiser = R"doc(Initialiser used for creating sparse connectivity)doc";
 
 static const char *__doc_SynapseGroup_m_SparseConnectivityLocation =
@@ -4033,6 +4246,10 @@ static const char *__doc_SynapseGroup_m_WUVarLocation =
 R"doc(Location of individual per-synapse state variables.
 This is ignored for simulations on hardware with a single memory space)doc";
 
+static const char *__doc_SynapseGroup_resolveAutoMatrixType =
+R"doc(Replace AUTO matrix type with the fastest compatible type, supported by the backend, whose estimated
+memory requirements fit within memoryBudget, which is reduced by the memory this requires)doc";
+
 static const char *__doc_SynapseGroup_setAxonalDelaySteps = R"doc(Sets the number of delay steps used to delay events and variables between presynaptic neuron and synapse)doc";
 
 static const char *__doc_SynapseGroup_setBackPropDelaySteps = R"doc(Sets the number of delay steps used to delay events and variables between postsynaptic neuron and synapse)doc";
@@ -4053,6 +4270,14 @@ static const char *__doc_SynapseGroup_setMaxConnections = R"doc(Sets the maximum
 
 static const char *__doc_SynapseGroup_setMaxDendriticDelayTimesteps = R"doc(Sets the maximum dendritic delay for synapses in this synapse group)doc";
 
+static const char *__doc_SynapseGroup_setMaxDendriticDelayEvents =
+R"doc(Sets the maximum number of dendritically delayed events which can be scheduled for delivery in any single timestep
+
+If this is small compared to the number of target neurons, dendritic delays are implemented using a
+sparse timing wheel of (target, weight) entries rather than a dense ring buffer.
+**NOTE** events scheduled for delivery in timesteps whose bucket is already full are dropped
+and counted so they can be reported by Runtime::getDendriticDelayWheelOverflow.)doc";
+
 static const char *__doc_SynapseGroup_setMaxSourceConnections = R"doc(Sets the maximum number of source neurons any target neuron can connect to)doc";
 
 static const char *__doc_SynapseGroup_setNarrowSparseIndEnabled = R"doc(Enables or disables using narrow i.e. less than 32-bit types for sparse matrix indices)doc";
@@ -4073,6 +4298,12 @@ static const char *__doc_SynapseGroup_setPSVarLocation =
 R"doc(Set location of postsynaptic model state variable.
 This is ignored for simulations on hardware with a single memory space)doc";
 
+static const char *__doc_SynapseGroup_setPSVarTraceRecording =
+R"doc(Enable recording of trace of postsynaptic model state variable
+
+Every interval timesteps, the values of the variable in the postsynaptic neurons specified by neuronIDs are
+written to a recording buffer which spans the number of recording timesteps. An empty list of neurons disables the trace.)doc";
+
 static const char *__doc_SynapseGroup_setParallelismHint = R"doc(Provide a hint as to how this synapse group should be parallelised)doc";
 
 static const char *__doc_SynapseGroup_setPostTargetVar =
@@ -4083,6 +4314,25 @@ static const char *__doc_SynapseGroup_setPreTargetVar =
 R"doc(Set name of neuron input variable addToPost(..) commands will target.
 This should either be 'Isyn' or the name of one of the presynaptic neuron's additional input variables.)doc";
 
+static const char *__doc_SynapseGroup_setRowCapacitySlack =
+R"doc(Sets the number of free slots to keep at the end of every row of a SPARSE synapse group whose connectivity is modified at runtime
+
+If this is non-zero, the maximum connections set for the synapse group only determines the initial row capacity.
+After sparse initialisation and after each custom update which modifies its connectivity, the rows of
+the synapse group are reallocated so the longest row is followed by at least this many free slots.
+This is therefore the maximum number of synapses a single custom update can add to any row; if a custom update
+tries to add more, the extra synapses are dropped and Runtime::customUpdate throws an exception.
+Columns of the postsynaptic remap used for postsynaptic learning are not reallocated so, if the weight update
+model has postsynaptic spike or spike-like event code, the maximum source connections must be set to the number of presynaptic neurons.
+**NOTE** reallocation invalidates any host pointers previously obtained to the synapse group's per-synapse arrays)doc";
+
+static const char *__doc_SynapseGroup_setSharedConnectivityTarget =
+R"doc(Share the sparse connectivity of another synapse group rather than storing and initialising a copy of it
+
+Both synapse groups must have SPARSE connectivity between the same source and target neuron groups,
+initialised using the same snippet and parameters. Where possible, presynaptic spikes are then
+processed for all synapse groups sharing connectivity in a single traversal of each row.)doc";
+
 static const char *__doc_SynapseGroup_setSparseConnectivityLocation =
 R"doc(Set variable mode used for sparse connectivity.
 This is ignored for simulations on hardware with a single memory space)doc";
@@ -4105,6 +4355,10 @@ static const char *__doc_SynapseGroup_setWUVarLocation =
 R"doc(Set location of weight update model state variable.
 This is ignored for simulations on hardware with a single memory space)doc";
 
+static const char *__doc_SynapseGroup_updateDendriticDelayWheel =
+R"doc(Decide whether a sparse timing wheel requires less memory than a
+dense ring buffer to implement this synapse group's dendritic delays)doc";
+
 static const char *__doc_SynapseMatrixConnectivity = R"doc(Flags defining how synaptic connectivity is represented)doc";
 
 static const char *__doc_SynapseMatrixConnectivity_BITMASK = R"doc(Connectivity is sparse and stored using a bitmask.)doc";
@@ -4119,6 +4373,11 @@ static const char *__doc_SynapseMatrixConnectivity_TOEPLITZ = R"doc(Connectivity
 
 static const char *__doc_SynapseMatrixType = R"doc(Supported combinations of SynapticMatrixConnectivity and SynapticMatrixWeight)doc";
 
+static const char *__doc_SynapseMatrixType_AUTO =
+R"doc(One of the above types is chosen when the model is finalised, based on the estimated memory
+and per-spike cost of the types which are compatible with the synapse group's connectivity and weight update model.
+Synapse groups without a connectivity initialisation snippet are treated as being densely connected.)doc";
+
 static const char *__doc_SynapseMatrixType_BITMASK =
 R"doc(Connectivity is stored as a bitmask.
 For moderately sparse (>3%) connectivity, this uses the least memory. However, connectivity of this sort cannot
@@ -4575,6 +4834,26 @@ static const char *__doc_Utils_validateVarName = R"doc(Checks variable name is v
 
 static const char *__doc_Utils_validateVecNames = R"doc(Checks whether the 'name' fields of all structs in vector valid? GeNN variables and population names must obey C variable naming rules)doc";
 
+static const char *__doc_VarTrace = R"doc(Configuration of trace recording for a single per-neuron state variable)doc";
+
+static const char *__doc_VarTraceContainer = R"doc()doc";
+
+static const char *__doc_VarTraceContainer_empty = R"doc()doc";
+
+static const char *__doc_VarTraceContainer_get = R"doc()doc";
+
+static const char *__doc_VarTraceContainer_m_Traces = R"doc()doc";
+
+static const char *__doc_VarTraceContainer_set = R"doc()doc";
+
+static const char *__doc_VarTraceContainer_updateHash =
+R"doc(Update hash with parts of trace configuration that affect generated code
+**NOTE** the indices of the traced neurons are stored in an array so only their number is hashed)doc";
+
+static const char *__doc_VarTrace_interval = R"doc(Number of timesteps between samples)doc";
+
+static const char *__doc_VarTrace_neuronIDs = R"doc(Indices of neurons whose values are sampled)doc";
+
 static const char *__doc_VarAccess = R"doc(Supported combinations of access mode and dimension for neuron and synapse variables)doc";
 
 static const char *__doc_VarAccessDim = R"doc(Flags defining dimensions this variables has)doc";
@@ -4642,6 +4921,13 @@ static const char *__doc_WeightUpdateModels_Base = R"doc(Base class for all weig
 
 static const char *__doc_WeightUpdateModels_Base_getHashDigest = R"doc(Update hash from model)doc";
 
+static const char *__doc_WeightUpdateModels_Base_getLazyDecayVars =
+R"doc(Gets per-synapse variables which decay exponentially towards zero between updates and
+the names of the parameters or derived parameters which specify their time constants
+Rather than being decayed every timestep by synapse dynamics code, these variables
+are decayed in closed form whenever a synapse is updated using the time it was last updated.
+Therefore, the values of these variables in memory are only correct at the time of the last update)doc";
+
 static const char *__doc_WeightUpdateModels_Base_getPSMVarRefs = R"doc(Gets names and types of variable references to postsynaptic model)doc";
 
 static const char *__doc_WeightUpdateModels_Base_getPostDynamicsCode =
@@ -179,6 +179,10 @@ public:
     virtual Models::Base::ParamValVec getAdditionalInputVars() const override { PYBIND11_OVERRIDE_NAME(Models::Base::ParamValVec, Base, "get_additional_input_vars", getAdditionalInputVars); }
 
     virtual bool isAutoRefractoryRequired() const override { PYBIND11_OVERRIDE_NAME(bool, Base, "is_auto_refractory_required", isAutoRefractoryRequired); }
+
+    virtual LinearDynamics getLinearDynamics() const override { PYBIND11_OVERRIDE_NAME(LinearDynamics, Base, "get_linear_dynamics", getLinearDynamics); }
+    virtual std::vector<ODE> getNonlinearDynamics() const override { PYBIND11_OVERRIDE_NAME(std::vector<ODE>, Base, "get_nonlinear_dynamics", getNonlinearDynamics); }
+    virtual unsigned int getNumNonlinearDynamicsSubsteps() const override { PYBIND11_OVERRIDE_NAME(unsigned int, Base, "get_num_nonlinear_dynamics_substeps", getNumNonlinearDynamicsSubsteps); }
 };
 
 //----------------------------------------------------------------------------
@@ -222,6 +226,8 @@ public:
     virtual std::vector<Models::Base::VarRef> getPreNeuronVarRefs() const override { PYBIND11_OVERRIDE_NAME(std::vector<Models::Base::VarRef> , Base, "get_pre_neuron_var_refs", getPreNeuronVarRefs); }
     virtual std::vector<Models::Base::VarRef> getPostNeuronVarRefs() const override { PYBIND11_OVERRIDE_NAME(std::vector<Models::Base::VarRef> , Base, "get_post_neuron_var_refs", getPostNeuronVarRefs); }
     virtual std::vector<Models::Base::VarRef> getPSMVarRefs() const override { PYBIND11_OVERRIDE_NAME(std::vector<Models::Base::VarRef> , Base, "get_psm_var_refs", getPSMVarRefs); }
+
+    virtual Base::LazyDecayVarVec getLazyDecayVars() const override { PYBIND11_OVERRIDE_NAME(Base::LazyDecayVarVec, Base, "get_lazy_decay_vars", getLazyDecayVars); }
 };
 
 const CodeGenerator::ModelSpecMerged *generateCode(ModelSpecInternal &model, CodeGenerator::BackendBase &backend, 
@@ -295,6 +301,7 @@ PYBIND11_MODULE(_genn, m)
         WRAP_ENUM(SynapseMatrixType, PROCEDURAL)
         WRAP_ENUM(SynapseMatrixType, PROCEDURAL_KERNELG)
         WRAP_ENUM(SynapseMatrixType, TOEPLITZ)
+        WRAP_ENUM(SynapseMatrixType, AUTO)
 
         .def("__and__", [](SynapseMatrixType a, SynapseMatrixConnectivity b){ return a & b; }, 
              pybind11::is_operator())
@@ -435,14 +442,18 @@ PYBIND11_MODULE(_genn, m)
         WRAP_PROPERTY("time_precision", ModelSpec, TimePrecision)
         WRAP_PROPERTY("dt", ModelSpec, DT)
         WRAP_PROPERTY("batch_size", ModelSpec, BatchSize)
+        WRAP_PROPERTY("auto_matrix_memory_budget", ModelSpec, AutoMatrixMemoryBudget)
         WRAP_PROPERTY("seed", ModelSpec, Seed)
         WRAP_PROPERTY_IS("timing_enabled", ModelSpec, TimingEnabled)
+        WRAP_PROPERTY_IS("profiling_enabled", ModelSpec, ProfilingEnabled)
+        WRAP_PROPERTY_IS("approximate_maths_enabled", ModelSpec, ApproximateMathsEnabled)
         
         WRAP_PROPERTY_WO("default_var_location", ModelSpec, DefaultVarLocation)
         WRAP_PROPERTY_WO("default_sparse_connectivity_location", ModelSpec, DefaultSparseConnectivityLocation)
         WRAP_PROPERTY_WO("default_narrow_sparse_ind_enabled", ModelSpec, DefaultNarrowSparseIndEnabled)
         WRAP_PROPERTY_WO("fuse_postsynaptic_models", ModelSpec, FusePostsynapticModels)
         WRAP_PROPERTY_WO("fuse_pre_post_weight_update_models", ModelSpec, FusePrePostWeightUpdateModels)
+        WRAP_PROPERTY_WO("demote_constant_read_only_vars", ModelSpec, DemoteConstantReadOnlyVars)
 
         .def_property_readonly("num_neurons", &ModelSpec::getNumNeurons, DOC(ModelSpec, getNumNeurons))
         .def_property_readonly("_recording_in_use", &ModelSpecInternal::isRecordingInUse)
@@ -502,6 +513,7 @@ PYBIND11_MODULE(_genn, m)
         WRAP_PROPERTY_RO("name", CurrentSource, Name)
         WRAP_PROPERTY_RO_REF("model", CurrentSource, Model)
         WRAP_PROPERTY_RO("params", CurrentSource, Params)
+        WRAP_PROPERTY_RO("var_traces", CurrentSource, VarTraces)
 
         //--------------------------------------------------------------------
         // Methods
@@ -510,7 +522,11 @@ PYBIND11_MODULE(_genn, m)
              pybind11::arg("param_name"), pybind11::arg("dynamic") = true,
              DOC(CurrentSource, setParamDynamic))
         WRAP_METHOD("set_var_location", CurrentSource, setVarLocation)
-        WRAP_METHOD("get_var_location", CurrentSource, getVarLocation);
+        WRAP_METHOD("get_var_location", CurrentSource, getVarLocation)
+        WRAP_METHOD("is_var_demoted", CurrentSource, isVarDemoted)
+        .def("set_var_trace_recording", &CurrentSource::setVarTraceRecording,
+             pybind11::arg("var_name"), pybind11::arg("neuron_ids"), pybind11::arg("interval") = 1,
+             DOC(CurrentSource, setVarTraceRecording));
     
     //------------------------------------------------------------------------
     // genn.CustomConnectivityUpdate
@@ -605,6 +621,12 @@ PYBIND11_MODULE(_genn, m)
         WRAP_PROPERTY_IS("recording_zero_copy_enabled", NeuronGroup, RecordingZeroCopyEnabled)
         WRAP_PROPERTY_IS("spike_recording_enabled", NeuronGroup, SpikeRecordingEnabled)
         WRAP_PROPERTY_IS("spike_event_recording_enabled", NeuronGroup, SpikeEventRecordingEnabled)
+        WRAP_PROPERTY_IS("spike_count_recording_enabled", NeuronGroup, SpikeCountRecordingEnabled)
+        WRAP_PROPERTY("spike_rate_tau", NeuronGroup, SpikeRateTau)
+        WRAP_PROPERTY_RO("isi_histogram_num_bins", NeuronGroup, ISIHistogramNumBins)
+        WRAP_PROPERTY_RO("isi_histogram_bin_width", NeuronGroup, ISIHistogramBinWidth)
+        WRAP_PROPERTY_RO("var_traces", NeuronGroup, VarTraces)
+        WRAP_PROPERTY_IS("approximate_maths_enabled", NeuronGroup, ApproximateMathsEnabled)
         WRAP_PROPERTY("spike_time_location", NeuronGroup, SpikeTimeLocation)
         WRAP_PROPERTY("prev_spike_time_location", NeuronGroup, PrevSpikeTimeLocation)
 
@@ -620,6 +642,13 @@ PYBIND11_MODULE(_genn, m)
              DOC(NeuronGroup, setParamDynamic))
         WRAP_METHOD("set_var_location", NeuronGroup, setVarLocation)
         WRAP_METHOD("get_var_location", NeuronGroup, getVarLocation)
+        WRAP_METHOD("is_var_demoted", NeuronGroup, isVarDemoted)
+        .def("set_isi_histogram", &NeuronGroup::setISIHistogram,
+             pybind11::arg("num_bins"), pybind11::arg("bin_width") = 1.0,
+             DOC(NeuronGroup, setISIHistogram))
+        .def("set_var_trace_recording", &NeuronGroup::setVarTraceRecording,
+             pybind11::arg("var_name"), pybind11::arg("neuron_ids"), pybind11::arg("interval") = 1,
+             DOC(NeuronGroup, setVarTraceRecording))
 
         // **NOTE** we use the 'publicist' pattern to expose some protected methods
         .def("_is_var_queue_required", &NeuronGroupInternal::isVarQueueRequired);
@@ -638,6 +667,7 @@ PYBIND11_MODULE(_genn, m)
         WRAP_PROPERTY_RO("matrix_type", SynapseGroup, MatrixType)
         WRAP_PROPERTY_RO("sparse_connectivity_initialiser", SynapseGroup, SparseConnectivityInitialiser)
         WRAP_PROPERTY_RO("toeplitz_connectivity_initialiser", SynapseGroup, ToeplitzConnectivityInitialiser)
+        WRAP_PROPERTY_RO("ps_var_traces", SynapseGroup, PSVarTraces)
     
         WRAP_PROPERTY("post_target_var", SynapseGroup, PostTargetVar)
         WRAP_PROPERTY("pre_target_var", SynapseGroup, PreTargetVar)
@@ -647,17 +677,22 @@ PYBIND11_MODULE(_genn, m)
         WRAP_PROPERTY("max_connections", SynapseGroup, MaxConnections)
         WRAP_PROPERTY("max_source_connections",SynapseGroup, MaxSourceConnections)
         WRAP_PROPERTY("max_dendritic_delay_timesteps", SynapseGroup, MaxDendriticDelayTimesteps)
+        WRAP_PROPERTY("max_dendritic_delay_events", SynapseGroup, MaxDendriticDelayEvents)
+        WRAP_PROPERTY_RO_IS("dendritic_delay_wheel_enabled", SynapseGroup, DendriticDelayWheelEnabled)
+        WRAP_PROPERTY("row_capacity_slack", SynapseGroup, RowCapacitySlack)
         WRAP_PROPERTY("parallelism_hint", SynapseGroup, ParallelismHint)
         WRAP_PROPERTY("num_threads_per_spike", SynapseGroup, NumThreadsPerSpike)
         WRAP_PROPERTY("back_prop_delay_steps", SynapseGroup, BackPropDelaySteps)
         WRAP_PROPERTY("axonal_delay_steps", SynapseGroup, AxonalDelaySteps)
         WRAP_PROPERTY_WO("narrow_sparse_ind_enabled", SynapseGroup, NarrowSparseIndEnabled)
+        WRAP_PROPERTY("shared_connectivity_target", SynapseGroup, SharedConnectivityTarget)
 
         // **NOTE** we use the 'publicist' pattern to expose some protected properties
         .def_property_readonly("_ps_model_fused", &SynapseGroupInternal::isPSModelFused)
         .def_property_readonly("_wu_pre_model_fused", &SynapseGroupInternal::isWUPreModelFused)
         .def_property_readonly("_wu_post_model_fused", &SynapseGroupInternal::isWUPostModelFused)
         .def_property_readonly("_sparse_ind_type", &SynapseGroupInternal::getSparseIndType)
+        .def_property_readonly("_shared_connectivity_pre_spike_fused", &SynapseGroupInternal::isSharedConnectivityPreSpikeFused)
         
         //--------------------------------------------------------------------
         // Methods
@@ -676,6 +711,10 @@ PYBIND11_MODULE(_genn, m)
              DOC(SynapseGroup, setPSParamDynamic))
         WRAP_METHOD("get_ps_var_location", SynapseGroup, getPSVarLocation)
         WRAP_METHOD("set_ps_var_location", SynapseGroup, setPSVarLocation)
+        WRAP_METHOD("is_ps_var_demoted", SynapseGroup, isPSVarDemoted)
+        .def("set_ps_var_trace_recording", &SynapseGroup::setPSVarTraceRecording,
+             pybind11::arg("var_name"), pybind11::arg("neuron_ids"), pybind11::arg("interval") = 1,
+             DOC(SynapseGroup, setPSVarTraceRecording))
         
         // **NOTE** we use the 'publicist' pattern to expose some protected methods
         .def("_is_wu_post_var_heterogeneously_delayed", &SynapseGroupInternal::isWUPostVarHeterogeneouslyDelayed)
@@ -766,6 +805,33 @@ PYBIND11_MODULE(_genn, m)
         .def_readonly("type", &Snippet::Base::ParamVal::type)
         .def_readonly("value", &Snippet::Base::ParamVal::value);
 
+    //------------------------------------------------------------------------
+    // genn.LinearDynamics
+    //------------------------------------------------------------------------
+    pybind11::class_<NeuronModels::Base::LinearDynamics>(m, "LinearDynamics")
+        .def(pybind11::init<>())
+        .def(pybind11::init<const std::vector<std::string>&, NeuronModels::Base::LinearDynamics::CoefficientsFunc, const std::vector<std::string>&>(),
+             pybind11::arg("vars"), pybind11::arg("coefficients"), pybind11::arg("inputs"))
+        .def_readonly("vars", &NeuronModels::Base::LinearDynamics::vars)
+        .def_readonly("coefficients", &NeuronModels::Base::LinearDynamics::coefficients)
+        .def_readonly("inputs", &NeuronModels::Base::LinearDynamics::inputs);
+
+    //------------------------------------------------------------------------
+    // genn.ODE
+    //------------------------------------------------------------------------
+    pybind11::class_<NeuronModels::Base::ODE>(m, "ODE")
+        .def(pybind11::init<const std::string&, const std::string&>(),
+             pybind11::arg("var"), pybind11::arg("derivative"))
+        .def_readonly("var", &NeuronModels::Base::ODE::var)
+        .def_readonly("derivative", &NeuronModels::Base::ODE::derivative);
+
+    //------------------------------------------------------------------------
+    // genn.VarTrace
+    //------------------------------------------------------------------------
+    pybind11::class_<VarTrace>(m, "VarTrace", DOC(VarTrace))
+        .def_readonly("neuron_ids", &VarTrace::neuronIDs, DOC(VarTrace, neuronIDs))
+        .def_readonly("interval", &VarTrace::interval, DOC(VarTrace, interval));
+
     //------------------------------------------------------------------------
     // genn.SnippetBase
     //------------------------------------------------------------------------
@@ -901,6 +967,9 @@ PYBIND11_MODULE(_genn, m)
         WRAP_NS_METHOD("get_threshold_condition_code", NeuronModels, Base, getThresholdConditionCode)
         WRAP_NS_METHOD("get_reset_code", NeuronModels, Base, getResetCode)
         WRAP_NS_METHOD("get_additional_input_vars", NeuronModels, Base, getAdditionalInputVars)
+        WRAP_NS_METHOD("get_linear_dynamics", NeuronModels, Base, getLinearDynamics)
+        WRAP_NS_METHOD("get_nonlinear_dynamics", NeuronModels, Base, getNonlinearDynamics)
+        WRAP_NS_METHOD("get_num_nonlinear_dynamics_substeps", NeuronModels, Base, getNumNonlinearDynamicsSubsteps)
         
         WRAP_NS_METHOD("is_auto_refractory_required", NeuronModels, Base, isAutoRefractoryRequired);
 
@@ -937,7 +1006,8 @@ PYBIND11_MODULE(_genn, m)
         WRAP_NS_METHOD("get_post_vars", WeightUpdateModels, Base, getPostVars)
         WRAP_NS_METHOD("get_pre_neuron_var_refs", WeightUpdateModels, Base, getPreNeuronVarRefs)
         WRAP_NS_METHOD("get_post_neuron_var_refs", WeightUpdateModels, Base, getPostNeuronVarRefs)
-        WRAP_NS_METHOD("get_psm_var_refs", WeightUpdateModels, Base, getPSMVarRefs);
+        WRAP_NS_METHOD("get_psm_var_refs", WeightUpdateModels, Base, getPSMVarRefs)
+        WRAP_NS_METHOD("get_lazy_decay_vars", WeightUpdateModels, Base, getLazyDecayVars);
 
     //------------------------------------------------------------------------
     // genn.SparseConnectivityInit
@@ -999,7 +1069,8 @@ PYBIND11_MODULE(_genn, m)
         WRAP_NS_ATTR("genn_log_level", CodeGenerator, PreferencesBase, gennLogLevel)
         WRAP_NS_ATTR("code_generator_log_level", CodeGenerator, PreferencesBase, codeGeneratorLogLevel)
         WRAP_NS_ATTR("transpiler_log_level", CodeGenerator, PreferencesBase, transpilerLogLevel)
-        WRAP_NS_ATTR("runtime_log_level", CodeGenerator, PreferencesBase, runtimeLogLevel);
+        WRAP_NS_ATTR("runtime_log_level", CodeGenerator, PreferencesBase, runtimeLogLevel)
+        WRAP_NS_ATTR("max_specialised_groups", CodeGenerator, PreferencesBase, maxSpecialisedGroups);
     
     //------------------------------------------------------------------------
     // genn.PreferencesCUDAHIP
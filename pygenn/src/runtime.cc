@@ -4,6 +4,7 @@
 #include <pybind11/stl.h>
 
 // GeNN includes
+#include "runtime/ensemble.h"
 #include "runtime/runtime.h"
 
 // GeNN code generator includes
@@ -74,13 +75,22 @@ PYBIND11_MODULE(_runtime, m)
         //--------------------------------------------------------------------
         // Methods
         //--------------------------------------------------------------------
-        .def("allocate", &Runtime::allocate)
-        .def("initialize", &Runtime::initialize)
-        .def("initialize_sparse", &Runtime::initializeSparse)
-        .def("step_time", &Runtime::stepTime)
-        .def("custom_update", &Runtime::customUpdate)
+        .def("allocate", &Runtime::allocate, "num_recording_timesteps"_a = std::nullopt, "connectivity_source"_a = nullptr)
+        .def("seed_host_rng", &Runtime::seedHostRNG)
+        .def("initialize", &Runtime::initialize, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("initialize_sparse", &Runtime::initializeSparse, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("step_time", 
+             [](Runtime &r, unsigned int numTimesteps)
+             {
+                 for(unsigned int t = 0; t < numTimesteps; t++) {
+                     r.stepTime();
+                 }
+             }, "num_timesteps"_a = 1, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("custom_update", &Runtime::customUpdate, pybind11::call_guard<pybind11::gil_scoped_release>())
 
         .def("get_delay_pointer", &Runtime::getDelayPointer)
+        .def("get_synaptic_matrix_row_stride", &Runtime::getSynapticMatrixRowStride)
+        .def("get_dendritic_delay_wheel_overflow", &Runtime::getDendriticDelayWheelOverflow)
 
         WRAP_RUNTIME_OVERLOADS(CurrentSource)
         WRAP_RUNTIME_OVERLOADS(NeuronGroup)
@@ -93,6 +103,21 @@ PYBIND11_MODULE(_runtime, m)
         .def("get_custom_update_time", &Runtime::getCustomUpdateTime)
         .def("get_custom_update_transpose_time", &Runtime::getCustomUpdateTransposeTime)
         .def("get_custom_update_remap_time", &Runtime::getCustomUpdateRemapTime)
+
+        .def("get_profile",
+             [](const Runtime &r)
+             {
+                 // Convert profile entries to list of dictionaries
+                 pybind11::list profile;
+                 for(const auto &e : r.getProfile()) {
+                     profile.append(pybind11::dict("kernel"_a=e.kernel, "merged_group"_a=e.mergedGroupIndex,
+                                                   "population"_a=e.population, "time"_a=e.time, "calls"_a=e.calls,
+                                                   "neurons"_a=e.neurons, "spikes"_a=e.spikes, "synapses"_a=e.synapses));
+                 }
+                 return profile;
+             })
+        .def("reset_profile", &Runtime::resetProfile)
+        .def("write_profile_trace", &Runtime::writeProfileTrace)
         
         .def("get_recorded_spikes", 
              [](const Runtime &r, const GeNN::NeuronGroup &group)
@@ -108,6 +133,42 @@ PYBIND11_MODULE(_runtime, m)
                                 });
                  return npSpikes;
              })
+        .def("set_sparse_connections",
+             [](Runtime &r, const GeNN::SynapseGroup &group,
+                pybind11::array_t<unsigned int, pybind11::array::c_style | pybind11::array::forcecast> preInds,
+                pybind11::array_t<unsigned int, pybind11::array::c_style | pybind11::array::forcecast> postInds)
+             {
+                 if(preInds.ndim() != 1 || postInds.ndim() != 1 || preInds.size() != postInds.size()) {
+                     throw std::runtime_error("Pre and postsynaptic indices must be 1D arrays of the same length");
+                 }
+
+                 // Build connectivity without holding the GIL
+                 pybind11::array_t<size_t> synapseOrder(preInds.size());
+                 {
+                     const unsigned int *pre = preInds.data();
+                     const unsigned int *post = postInds.data();
+                     size_t *order = synapseOrder.mutable_data();
+                     pybind11::gil_scoped_release release;
+                     r.setSparseConnections(group, pre, post, preInds.size(), order);
+                 }
+                 return synapseOrder;
+             })
+        .def("get_recorded_spike_counts", 
+             [](const Runtime &r, const GeNN::NeuronGroup &group)
+             {
+                 const auto counts = r.getRecordedSpikeCounts(group);
+                 std::vector<pybind11::array_t<uint32_t>> npCounts;
+                 std::transform(counts.cbegin(), counts.cend(), std::back_inserter(npCounts),
+                                [](const auto &c){ return pybind11::array_t<uint32_t>(pybind11::cast(c)); });
+                 return npCounts;
+             })
+        .def("get_recorded_var_trace", 
+             pybind11::overload_cast<const GeNN::NeuronGroup&, const std::string&>(&Runtime::getRecordedVarTrace, pybind11::const_),
+             pybind11::return_value_policy::reference)
+        .def("get_recorded_var_trace", 
+             pybind11::overload_cast<const GeNN::CurrentSource&, const std::string&>(&Runtime::getRecordedVarTrace, pybind11::const_),
+             pybind11::return_value_policy::reference)
+        .def("get_recorded_ps_var_trace", &Runtime::getRecordedPSVarTrace, pybind11::return_value_policy::reference)
         .def("get_recorded_pre_spike_events", 
              [](const Runtime &r, const GeNN::SynapseGroup &group)
              {
@@ -138,4 +199,27 @@ PYBIND11_MODULE(_runtime, m)
                  return npSpikes;
              });
 
+    //------------------------------------------------------------------------
+    // runtime.Ensemble
+    //------------------------------------------------------------------------
+    pybind11::class_<Ensemble>(m, "Ensemble")
+        .def(pybind11::init<const std::string&, const GeNN::CodeGenerator::ModelSpecMerged&, 
+                            const GeNN::CodeGenerator::BackendBase&, size_t>())
+
+        //--------------------------------------------------------------------
+        // Properties
+        //--------------------------------------------------------------------
+        .def_property_readonly("num_replicas", &Ensemble::getNumReplicas)
+
+        //--------------------------------------------------------------------
+        // Methods
+        //--------------------------------------------------------------------
+        .def("allocate", &Ensemble::allocate)
+        .def("initialize", &Ensemble::initialize, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("initialize_sparse", &Ensemble::initializeSparse, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("step_time", &Ensemble::stepTime, "num_timesteps"_a = 1, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("custom_update", &Ensemble::customUpdate, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("pull_recording_buffers_from_device", &Ensemble::pullRecordingBuffersFromDevice)
+        .def("get_replica", pybind11::overload_cast<size_t>(&Ensemble::getReplica), 
+             pybind11::return_value_policy::reference_internal);
 }
@@ -34,11 +34,27 @@ PYBIND11_MODULE(single_threaded_cpu_backend, m)
 {
     pybind11::module_::import("pygenn._genn");
 
+    //------------------------------------------------------------------------
+    // single_threaded_cpu_backend.PresynapticUpdateStrategy
+    //------------------------------------------------------------------------
+    pybind11::enum_<PresynapticUpdateStrategy>(m, "PresynapticUpdateStrategy")
+        .value("ROW_WISE", PresynapticUpdateStrategy::ROW_WISE)
+        .value("WORD_PACKED_BITMASK", PresynapticUpdateStrategy::WORD_PACKED_BITMASK)
+        .value("TOEPLITZ_DIAGONAL_MAJOR", PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR)
+        .value("TOEPLITZ_SPIKE_MAJOR", PresynapticUpdateStrategy::TOEPLITZ_SPIKE_MAJOR)
+        .value("TOEPLITZ_CONV2D", PresynapticUpdateStrategy::TOEPLITZ_CONV2D);
+
     //------------------------------------------------------------------------
     // single_threaded_cpu_backend.Preferences
     //------------------------------------------------------------------------
     pybind11::class_<Preferences, CodeGenerator::PreferencesBase>(m, "Preferences")
-        .def(pybind11::init<>());
+        .def(pybind11::init<>())
+        .def_readwrite("instance_context", &Preferences::instanceContext)
+        .def_readwrite("auto_tune", &Preferences::autoTune)
+        .def_readwrite("auto_tune_timesteps", &Preferences::autoTuneTimesteps)
+        .def_readwrite("auto_tune_repeats", &Preferences::autoTuneRepeats)
+        .def_readwrite("manual_presynaptic_update_strategies", &Preferences::manualPresynapticUpdateStrategies)
+        .def_readwrite("target_isas", &Preferences::targetISAs);
 
     //------------------------------------------------------------------------
     // single_threaded_cpu_backend.Backend
@@ -49,4 +65,5 @@ PYBIND11_MODULE(single_threaded_cpu_backend, m)
     // Free functions
     //------------------------------------------------------------------------
     m.def("_create_backend", &createBackend, pybind11::return_value_policy::move);
+    m.def("_is_matrix_type_supported", &Optimiser::isMatrixTypeSupported);
 }
@@ -37,6 +37,7 @@ const EnvironmentLibrary::Library floatRandomFunctions = {
     {"gennrand_log_normal", {Type::ResolvedType::createFunction(Type::Float, {Type::Float, Type::Float}), "curand_log_normal_float(&$(_rng), $(0), $(1))"}},
     {"gennrand_gamma", {Type::ResolvedType::createFunction(Type::Float, {Type::Float}), "gammaDistFloat(&$(_rng), $(0))"}},
     {"gennrand_binomial", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Uint32, Type::Float}), "binomialDistFloat(&$(_rng), $(0), $(1))"}},
+    {"gennrand_poisson", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Float}), "curand_poisson(&$(_rng), $(0))"}},
 };
 
 const EnvironmentLibrary::Library doubleRandomFunctions = {
@@ -47,6 +48,7 @@ const EnvironmentLibrary::Library doubleRandomFunctions = {
     {"gennrand_log_normal", {Type::ResolvedType::createFunction(Type::Double, {Type::Double, Type::Double}), "curand_log_normal_double(&$(_rng), $(0), $(1))"}},
     {"gennrand_gamma", {Type::ResolvedType::createFunction(Type::Double, {Type::Double}), "gammaDistDouble(&$(_rng), $(0))"}},
     {"gennrand_binomial", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Uint32, Type::Double}), "binomialDistDouble(&$(_rng), $(0), $(1))"}},
+    {"gennrand_poisson", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Double}), "curand_poisson(&$(_rng), $(0))"}},
 };
 
 //--------------------------------------------------------------------------
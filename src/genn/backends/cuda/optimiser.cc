@@ -808,4 +808,9 @@ Backend createBackend(const ModelSpecInternal &model, const filesystem::path &ou
 
     }
 }
+//--------------------------------------------------------------------------
+bool isMatrixTypeSupported(SynapseMatrixType)
+{
+    return true;
+}
 }   // namespace CodeGenerator::Backends::Optimiser
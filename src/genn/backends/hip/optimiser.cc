@@ -59,4 +59,9 @@ Backend createBackend(const ModelSpecInternal &model, const filesystem::path&,
 
     return Backend(preferences.manualBlockSizes, preferences, preferences.manualDeviceID, model.zeroCopyInUse());
 }
+//--------------------------------------------------------------------------
+bool isMatrixTypeSupported(SynapseMatrixType)
+{
+    return true;
+}
 }   // namespace GeNN::CodeGenerator::HIP::Optimiser
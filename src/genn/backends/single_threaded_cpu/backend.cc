@@ -1,6 +1,13 @@
 #include "backend.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <tuple>
+
 // Standard C includes
+#include <cassert>
+#include <cctype>
+#include <cmath>
 #include <cstdlib>
 
 // GeNN includes
@@ -27,6 +34,11 @@ const EnvironmentLibrary::Library backendFunctions = {
     {"atomic_or", {Type::ResolvedType::createFunction(Type::Void, {Type::Uint32.createPointer(), Type::Uint32}), "(*($(0)) |= ($(1)))"}}
 };
 
+//! Supported x86-64 micro-architecture levels, in descending order
+//! **NOTE** rather than listing features, levels are checked by name so __builtin_cpu_supports 
+//! tests the complete psABI feature set of each level, exactly as the target clone dispatcher does
+const std::vector<std::string> targetISALevels = {"x86-64-v4", "x86-64-v3", "x86-64-v2"};
+
 //--------------------------------------------------------------------------
 // Timer
 //--------------------------------------------------------------------------
@@ -59,6 +71,112 @@ private:
     const bool m_TimingEnabled;
 };
 
+//--------------------------------------------------------------------------
+// GroupProfiler
+//--------------------------------------------------------------------------
+//! Times the body of a merged group loop and counts calls in the
+//! profiling counters generated for this population of the merged group
+class GroupProfiler
+{
+public:
+    template<typename G>
+    GroupProfiler(CodeStream &codeStream, const G &mergedGroup, bool profilingEnabled)
+    :   m_CodeStream(codeStream), m_ProfilingEnabled(profilingEnabled)
+    {
+        // Get reference to counters and record start time
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "GeNNProfileCounters &profile = profile" << mergedGroup.name << "Group" << mergedGroup.getIndex() << "[g];" << std::endl;
+            m_CodeStream << "const auto profileStart = std::chrono::high_resolution_clock::now();" << std::endl;
+        }
+    }
+
+    ~GroupProfiler()
+    {
+        // Record elapsed time
+        if(m_ProfilingEnabled) {
+            m_CodeStream << "profile.time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - profileStart).count();" << std::endl;
+            m_CodeStream << "profile.calls++;" << std::endl;
+        }
+    }
+
+private:
+    //--------------------------------------------------------------------------
+    // Members
+    //--------------------------------------------------------------------------
+    CodeStream &m_CodeStream;
+    const bool m_ProfilingEnabled;
+};
+
+//--------------------------------------------------------------------------
+// Instance context
+//--------------------------------------------------------------------------
+//! Get name of the member of GeNNContext which points to module's context
+std::string getModuleContextMember(const std::string &module)
+{
+    std::string member = module;
+    member[0] = std::tolower(member[0]);
+    return member;
+}
+//--------------------------------------------------------------------------
+//! Generate structure holding module's merged group arrays and macros to access them
+//! via context so code referencing them is identical to that using static arrays
+template<typename... G>
+void genModuleContext(CodeStream &os, const std::string &module, const std::vector<G>&... mergedGroups)
+{
+    os << "struct " << module << "Context";
+    {
+        CodeStream::Scope b(os);
+        ([&os](const auto &groups)
+         {
+             for(const auto &m : groups) {
+                 os << "struct Merged" << m.name << "Group" << m.getIndex() << " *merged" << m.name << "Group" << m.getIndex() << ";" << std::endl;
+             }
+         }(mergedGroups), ...);
+    }
+    os << ";" << std::endl;
+
+    // **NOTE** macros which reference themselves are not expanded recursively
+    ([&os, &module](const auto &groups)
+     {
+         for(const auto &m : groups) {
+             const std::string name = "merged" + m.name + "Group" + std::to_string(m.getIndex());
+             os << "#define " << name << " (context->" << getModuleContextMember(module) << "->" << name << ")" << std::endl;
+         }
+     }(mergedGroups), ...);
+    os << std::endl;
+}
+//--------------------------------------------------------------------------
+//! Generate functions to allocate and free module's merged group arrays within context
+template<typename... G>
+void genModuleContextAllocation(CodeStream &os, const std::string &module, const std::vector<G>&... mergedGroups)
+{
+    os << "void allocate" << module << "Context(GeNNContext *context)";
+    {
+        CodeStream::Scope b(os);
+        os << "context->" << getModuleContextMember(module) << " = new " << module << "Context;" << std::endl;
+        ([&os](const auto &groups)
+         {
+             for(const auto &m : groups) {
+                 os << "merged" << m.name << "Group" << m.getIndex() << " = new Merged" << m.name << "Group" << m.getIndex() << "[" << m.getGroups().size() << "]();" << std::endl;
+             }
+         }(mergedGroups), ...);
+    }
+    os << std::endl;
+
+    os << "void free" << module << "Context(GeNNContext *context)";
+    {
+        CodeStream::Scope b(os);
+        ([&os](const auto &groups)
+         {
+             for(const auto &m : groups) {
+                 os << "delete [] merged" << m.name << "Group" << m.getIndex() << ";" << std::endl;
+             }
+         }(mergedGroups), ...);
+        os << "delete context->" << getModuleContextMember(module) << ";" << std::endl;
+    }
+    os << std::endl;
+}
+
 //--------------------------------------------------------------------------
 // CodeGenerator::SingleThreadedCPU::Array
 //--------------------------------------------------------------------------
@@ -185,6 +303,19 @@ void genKernelIteration(EnvironmentExternalBase &env, G &g, size_t numKernelDims
     generateRecursive(env, 0);
 }
 //--------------------------------------------------------------------------
+//! Get code to add $(0) to postsynaptic input $(1) timesteps in the future
+//! via synapse group's dendritic delay timing wheel or ring buffer
+template<typename G>
+std::string getAddToPostDelay(const G &sg)
+{
+    if(sg.getArchetype().isDendriticDelayWheelEnabled()) {
+        return sg.getPostDenDelayWheelPush("$(id_post)");
+    }
+    else {
+        return "$(_den_delay)[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)";
+    }
+}
+//--------------------------------------------------------------------------
 void genRemap(EnvironmentExternalBase &env)
 {
     env.printLine("// Loop through synapses in corresponding matrix row");
@@ -209,6 +340,68 @@ void genRemap(EnvironmentExternalBase &env)
         env.printLine("$(_remap)[colMajorIndex] = rowMajorIndex;");
     }
 }
+//--------------------------------------------------------------------------
+void genLazyRemap(EnvironmentExternalBase &env)
+{
+    env.print("if(!*$(_remap_valid))");
+    {
+        CodeStream::Scope b(env.getStream());
+
+        // Zero column lengths so remap is built from scratch
+        env.printLine("std::fill_n($(_col_length), $(num_post), 0);");
+
+        env.printLine("// Loop through presynaptic neurons");
+        env.print("for (unsigned int i = 0; i < $(num_pre); i++)");
+        {
+            CodeStream::Scope b(env.getStream());
+            genRemap(env);
+        }
+        env.printLine("*$(_remap_valid) = 1;");
+    }
+}
+//--------------------------------------------------------------------------
+void genActivityProbes(EnvironmentExternalBase &env, const NeuronUpdateGroupMerged &ng, const ModelSpecInternal &model)
+{
+    // Count spikes emitted this timestep
+    if(ng.getArchetype().isSpikeCountRecordingEnabled()) {
+        env.getStream() << "spikeCount++;" << std::endl;
+    }
+
+    // Add contribution of spike to firing rate estimate (in Hz)
+    if(ng.getArchetype().isSpikeRateEstimationEnabled()) {
+        const double increment = 1000.0 / ng.getArchetype().getSpikeRateTau();
+        env.printLine("$(_spk_rate)[$(id)] += " + Type::writeNumeric(increment, model.getPrecision()) + ";");
+    }
+
+    // If neuron has spiked before, add interval since last spike to histogram
+    // **NOTE** st is read before the spike time is updated so still contains the previous spike time
+    if(ng.getArchetype().isISIHistogramEnabled()) {
+        const unsigned int numBins = ng.getArchetype().getISIHistogramNumBins();
+        env.print("if($(st) != -TIME_MAX)");
+        {
+            CodeStream::Scope b(env.getStream());
+            env.printLine("const unsigned int isiBin = (unsigned int)(($(t) - $(st)) / " + Type::writeNumeric(ng.getArchetype().getISIHistogramBinWidth(), model.getTimePrecision()) + ");");
+            env.printLine("$(_isi_hist)[(isiBin < " + std::to_string(numBins) + ") ? isiBin : " + std::to_string(numBins - 1) + "]++;");
+        }
+    }
+}
+//--------------------------------------------------------------------------
+bool isStaticAccumulate(const SynapseGroupInternal &sg)
+{
+    // Built-in static weight update models only read their weight, presynaptic variable 
+    // references and parameters and accumulate into the postsynaptic input
+    const auto *wum = sg.getWUInitialiser().getSnippet();
+    return (wum == WeightUpdateModels::StaticPulse::getInstance()
+            || wum == WeightUpdateModels::StaticPulseConstantWeight::getInstance()
+            || wum == WeightUpdateModels::StaticGraded::getInstance());
+}
+//--------------------------------------------------------------------------
+bool isDenseRowAccumulate(const SynapseGroupInternal &sg)
+{
+    // With individual DENSE weights, each presynaptic update of a static weight 
+    // update model is an AXPY of a weight row into the postsynaptic input
+    return (sg.getMatrixType() == SynapseMatrixType::DENSE && isStaticAccumulate(sg));
+}
 }
 
 //--------------------------------------------------------------------------
@@ -227,11 +420,12 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
     std::ostringstream neuronUpdateStream;
     CodeStream neuronUpdate(neuronUpdateStream);
 
-    // Begin environment with standard library
+    // Begin environment with standard library, substituting approximate maths functions if enabled
     EnvironmentLibrary backendEnv(neuronUpdate, backendFunctions);
-    EnvironmentLibrary neuronUpdateEnv(backendEnv, StandardLibrary::getMathsFunctions());
+    EnvironmentLibrary neuronUpdateEnv(backendEnv, modelMerged.getModel().isApproximateMathsEnabled() ? StandardLibrary::getApproximateMathsFunctions() : StandardLibrary::getMathsFunctions());
 
-    neuronUpdateEnv.getStream() << "void updateNeurons(" << modelMerged.getModel().getTimePrecision().getName() << " t";
+    genTargetClonesAttribute(neuronUpdateEnv.getStream());
+    neuronUpdateEnv.getStream() << "void updateNeurons(" << (isInstanceContextEnabled() ? "GeNNContext *context, " : "") << modelMerged.getModel().getTimePrecision().getName() << " t";
     if(modelMerged.getModel().isRecordingInUse()) {
         neuronUpdateEnv.getStream() << ", unsigned int recordingTimestep";
     }
@@ -327,6 +521,9 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                     EnvironmentGroupMergedField<NeuronUpdateGroupMerged> groupEnv(funcEnv, n);
                     buildStandardEnvironment(groupEnv, 1);
 
+                    const bool profilingEnabled = modelMerged.getModel().isProfilingEnabled();
+                    GroupProfiler p(groupEnv.getStream(), n, profilingEnabled);
+
                     // If spike or spike-like event recording is in use
                     if(n.getArchetype().isSpikeRecordingEnabled() || n.getArchetype().isSpikeEventRecordingEnabled()) {
                         // Calculate number of words which will be used to record this population's spikes
@@ -348,6 +545,11 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                         }
                     }
 
+                    // If spike counts are being recorded, zero local counter
+                    if(n.getArchetype().isSpikeCountRecordingEnabled()) {
+                        groupEnv.getStream() << "unsigned int spikeCount = 0;" << std::endl;
+                    }
+
                     groupEnv.getStream() << std::endl;
 
                     groupEnv.print("for(unsigned int i = 0; i < $(num_neurons); i++)");
@@ -356,18 +558,37 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
 
                         groupEnv.add(Type::Uint32, "id", "i");
 
+                        // If firing rates are being estimated, decay estimate
+                        const auto &model = modelMerged.getModel();
+                        if(n.getArchetype().isSpikeRateEstimationEnabled()) {
+                            const double decay = std::exp(-model.getDT() / n.getArchetype().getSpikeRateTau());
+                            groupEnv.printLine("$(_spk_rate)[$(id)] *= " + Type::writeNumeric(decay, model.getPrecision()) + ";");
+                        }
+
+                        // Substitute approximate maths functions if enabled for model or this population
+                        const bool approximateMaths = (model.isApproximateMathsEnabled() || n.getArchetype().isApproximateMathsEnabled());
+                        EnvironmentLibrary mathsEnv(groupEnv, approximateMaths ? StandardLibrary::getApproximateMathsFunctions() : StandardLibrary::getMathsFunctions());
+
                         // Add RNG libray
-                        EnvironmentLibrary rngEnv(groupEnv, StandardLibrary::getHostRNGFunctions(modelMerged.getModel().getPrecision()));
+                        EnvironmentLibrary rngEnv(mathsEnv, StandardLibrary::getHostRNGFunctions(model.getPrecision()));
 
                         // Generate neuron update
                         n.generateNeuronUpdate(
                             *this, rngEnv, 1,
                             // Emit true spikes
-                            [&n, this](EnvironmentExternalBase &env)
+                            [&n, &model, profilingEnabled, this](EnvironmentExternalBase &env)
                             {
                                 // Insert code to update WU vars
                                 n.generateWUVarUpdate(env, 1);
 
+                                // Count spike
+                                if(profilingEnabled) {
+                                    env.getStream() << "profile.spikes++;" << std::endl;
+                                }
+
+                                // Generate activity probes
+                                genActivityProbes(env, n, model);
+
                                 // If recording is enabled
                                 if(n.getArchetype().isSpikeRecordingEnabled()) {
                                     env.printLine("$(_record_spk)[(recordingTimestep * numRecordingWords) + ($(id) / 32)] |= (1 << ($(id) % 32));");
@@ -409,6 +630,19 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                                     });
                             });
                     }
+
+                    // Write spike count to recording buffer
+                    if(n.getArchetype().isSpikeCountRecordingEnabled()) {
+                        groupEnv.printLine("$(_record_spk_cnt)[recordingTimestep] = spikeCount;");
+                    }
+
+                    // Write samples of traced variables to recording buffers
+                    n.generateVarTraces(groupEnv, 1);
+
+                    // Count neurons processed
+                    if(profilingEnabled) {
+                        groupEnv.printLine("profile.neurons += $(num_neurons);");
+                    }
                 }
             });
     }
@@ -418,6 +652,12 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
     modelMerged.genMergedNeuronSpikeQueueUpdateStructs(os, *this);
     modelMerged.genMergedNeuronPrevSpikeTimeUpdateStructs(os, *this);
 
+    // If instance context is enabled, generate structure to hold merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContext(os, "NeuronUpdate", modelMerged.getMergedNeuronUpdateGroups(),
+                         modelMerged.getMergedNeuronSpikeQueueUpdateGroups(), modelMerged.getMergedNeuronPrevSpikeTimeUpdateGroups());
+    }
+
     // Generate arrays of merged structs and functions to set them
     modelMerged.genMergedNeuronUpdateGroupHostStructArrayPush(os, *this);
     modelMerged.genMergedNeuronSpikeQueueUpdateHostStructArrayPush(os, *this);
@@ -427,6 +667,12 @@ void Backend::genNeuronUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
     preambleHandler(os);
 
     os << neuronUpdateStream.str();
+
+    // If instance context is enabled, generate functions to allocate and free merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContextAllocation(os, "NeuronUpdate", modelMerged.getMergedNeuronUpdateGroups(),
+                                   modelMerged.getMergedNeuronSpikeQueueUpdateGroups(), modelMerged.getMergedNeuronPrevSpikeTimeUpdateGroups());
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase::MemorySpaces &memorySpaces, 
@@ -440,11 +686,12 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
     std::ostringstream synapseUpdateStream;
     CodeStream synapseUpdate(synapseUpdateStream);
 
-    // Begin environment with standard library
+    // Begin environment with standard library, substituting approximate maths functions if enabled
     EnvironmentLibrary backendEnv(synapseUpdate, backendFunctions);
-    EnvironmentLibrary synapseUpdateEnv(backendEnv, StandardLibrary::getMathsFunctions());
+    EnvironmentLibrary synapseUpdateEnv(backendEnv, modelMerged.getModel().isApproximateMathsEnabled() ? StandardLibrary::getApproximateMathsFunctions() : StandardLibrary::getMathsFunctions());
 
-    synapseUpdateEnv.getStream() << "void updateSynapses(" << modelMerged.getModel().getTimePrecision().getName() << " t)";
+    genTargetClonesAttribute(synapseUpdateEnv.getStream());
+    synapseUpdateEnv.getStream() << "void updateSynapses(" << (isInstanceContextEnabled() ? "GeNNContext *context, " : "") << modelMerged.getModel().getTimePrecision().getName() << " t)";
     {
         CodeStream::Scope b(synapseUpdateEnv.getStream());
 
@@ -493,16 +740,25 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
                         EnvironmentGroupMergedField<SynapseDynamicsGroupMerged> groupEnv(funcEnv, s);
                         buildStandardEnvironment(groupEnv, 1);
 
+                        const bool profilingEnabled = modelMerged.getModel().isProfilingEnabled();
+                        GroupProfiler p(groupEnv.getStream(), s, profilingEnabled);
+
                         // Loop through presynaptic neurons
                         groupEnv.print("for(unsigned int i = 0; i < $(num_pre); i++)");
                         {
                             // If this synapse group has sparse connectivity, loop through length of this row
                             CodeStream::Scope b(groupEnv.getStream());
                             if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                if(profilingEnabled) {
+                                    groupEnv.printLine("profile.synapses += $(_row_length)[i];");
+                                }
                                 groupEnv.print("for(unsigned int s = 0; s < $(_row_length)[i]; s++)");
                             }
                             // Otherwise, if it's dense, loop through each postsynaptic neuron
                             else if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                if(profilingEnabled) {
+                                    groupEnv.printLine("profile.synapses += $(num_post);");
+                                }
                                 groupEnv.print("for (unsigned int j = 0; j < $(num_post); j++)");
                             }
                             else {
@@ -530,12 +786,13 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
                                     synEnv.add(Type::Uint32.addConst(), "id_post", "j");
 
                                     // Add initialiser to calculate synaptic index
-                                    synEnv.add(indexType.addConst(), "id_syn", "idSyn", 
-                                               {synEnv.addInitialiser("const " + indexTypeName + " idSyn = ((" + indexTypeName + ")i * $(num_post)) + j;")});
+                                    // **NOTE** as in presynaptic update, this is calculated in 64-bit to allow vectorisation
+                                    synEnv.add(Type::Uint64.addConst(), "id_syn", "idSyn", 
+                                               {synEnv.addInitialiser("const size_t idSyn = ((size_t)i * $(num_post)) + j;")});
                                 }
 
                                 // Add correct functions for apply synaptic input
-                                synEnv.add(Type::getAddToPrePostDelay(s.getScalarType()), "addToPostDelay", "$(_den_delay)[" + s.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
+                                synEnv.add(Type::getAddToPrePostDelay(s.getScalarType()), "addToPostDelay", getAddToPostDelay(s));
                                 synEnv.add(Type::getAddToPrePost(s.getScalarType()), "addToPost", "$(_out_post)[" + s.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
                                 synEnv.add(Type::getAddToPrePost(s.getScalarType()), "addToPre", "$(_out_pre)[" + s.getPreISynIndex(1, "$(id_pre)") + "] += $(0)");
                                 
@@ -566,15 +823,18 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
                         // Create matching environment
                         EnvironmentGroupMergedField<PresynapticUpdateGroupMerged> groupEnv(funcEnv, s);
                         buildStandardEnvironment(groupEnv, 1);
+
+                        const bool profilingEnabled = modelMerged.getModel().isProfilingEnabled();
+                        GroupProfiler p(groupEnv.getStream(), s, profilingEnabled);
                     
                         // generate the code for processing spike-like events
                         if (s.getArchetype().isPreSpikeEventRequired()) {
-                            genPresynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), false);
+                            genPresynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), false, profilingEnabled);
                         }
 
                         // generate the code for processing true spike events
                         if (s.getArchetype().isPreSpikeRequired()) {
-                            genPresynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), true);
+                            genPresynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), true, profilingEnabled);
                         }
                         funcEnv.getStream() << std::endl;
                     }
@@ -601,14 +861,22 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
                         EnvironmentGroupMergedField<PostsynapticUpdateGroupMerged> groupEnv(funcEnv, s);
                         buildStandardEnvironment(groupEnv, 1);
 
+                        // If connectivity is sparse, build remap if it has been invalidated
+                        if(s.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                            genLazyRemap(groupEnv);
+                        }
+
+                        const bool profilingEnabled = modelMerged.getModel().isProfilingEnabled();
+                        GroupProfiler p(groupEnv.getStream(), s, profilingEnabled);
+
                         // generate the code for processing spike-like events
                         if (s.getArchetype().isPostSpikeEventRequired()) {
-                            genPostsynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), false);
+                            genPostsynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), false, profilingEnabled);
                         }
 
                         // generate the code for processing true spike events
                         if (s.getArchetype().isPostSpikeRequired()) {
-                            genPostsynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), true);
+                            genPostsynapticUpdate(groupEnv, s, modelMerged.getModel().getDT(), true, profilingEnabled);
                         }
                         groupEnv.getStream() << std::endl;
                     }
@@ -622,6 +890,12 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
     modelMerged.genMergedPostsynapticUpdateGroupStructs(os, *this);
     modelMerged.genMergedSynapseDynamicsGroupStructs(os, *this);
 
+    // If instance context is enabled, generate structure to hold merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContext(os, "SynapseUpdate", modelMerged.getMergedSynapseDendriticDelayUpdateGroups(), modelMerged.getMergedPresynapticUpdateGroups(),
+                         modelMerged.getMergedPostsynapticUpdateGroups(), modelMerged.getMergedSynapseDynamicsGroups());
+    }
+
     // Generate arrays of merged structs and functions to set them
     modelMerged.genMergedSynapseDendriticDelayUpdateHostStructArrayPush(os, *this);
     modelMerged.genMergedPresynapticUpdateGroupHostStructArrayPush(os, *this);
@@ -632,6 +906,12 @@ void Backend::genSynapseUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Bac
     preambleHandler(os);
 
     os << synapseUpdateStream.str();
+
+    // If instance context is enabled, generate functions to allocate and free merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContextAllocation(os, "SynapseUpdate", modelMerged.getMergedSynapseDendriticDelayUpdateGroups(), modelMerged.getMergedPresynapticUpdateGroups(),
+                                   modelMerged.getMergedPostsynapticUpdateGroups(), modelMerged.getMergedSynapseDynamicsGroups());
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase::MemorySpaces &memorySpaces, 
@@ -655,13 +935,13 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
     std::ostringstream customUpdateStream;
     CodeStream customUpdate(customUpdateStream);
     
-    // Begin environment with standard library
+    // Begin environment with standard library, substituting approximate maths functions if enabled
     EnvironmentLibrary backendEnv(customUpdate, backendFunctions);
-    EnvironmentLibrary customUpdateEnv(backendEnv, StandardLibrary::getMathsFunctions());
+    EnvironmentLibrary customUpdateEnv(backendEnv, modelMerged.getModel().isApproximateMathsEnabled() ? StandardLibrary::getApproximateMathsFunctions() : StandardLibrary::getMathsFunctions());
 
     // Loop through custom update groups
     for(const auto &g : customUpdateGroups) {
-        customUpdateEnv.getStream() << "void update" << g << "(unsigned long long timestep)";
+        customUpdateEnv.getStream() << "void update" << g << "(" << (isInstanceContextEnabled() ? "GeNNContext *context, " : "") << "unsigned long long timestep)";
         {
             CodeStream::Scope b(customUpdateEnv.getStream());
 
@@ -684,7 +964,7 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                 Timer t(funcEnv.getStream(), "customUpdate" + g, model.isTimingEnabled());
                 modelMerged.genMergedCustomUpdateGroups(
                     *this, memorySpaces, g,
-                    [this, &funcEnv](auto &c)
+                    [this, &funcEnv, &model](auto &c)
                     {
                         CodeStream::Scope b(funcEnv.getStream());
                         funcEnv.getStream() << "// merged custom update group " << c.getIndex() << std::endl;
@@ -700,6 +980,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                             buildSizeEnvironment(groupEnv);
                             buildStandardEnvironment(groupEnv, 1);
 
+                            const bool profilingEnabled = model.isProfilingEnabled();
+                            GroupProfiler p(groupEnv.getStream(), c, profilingEnabled);
+
                             if (c.getArchetype().isNeuronReduction()) {
                                 // Initialise reduction targets
                                 // **TODO** these should be provided with some sort of caching mechanism
@@ -708,6 +991,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                                 // Loop through group members
                                 EnvironmentGroupMergedField<CustomUpdateGroupMerged> memberEnv(groupEnv, c);
                                 if (c.getArchetype().getDims() & VarAccessDim::ELEMENT) {
+                                    if(profilingEnabled) {
+                                        memberEnv.printLine("profile.neurons += $(num_neurons);");
+                                    }
                                     memberEnv.print("for(unsigned int i = 0; i < $(num_neurons); i++)");
                                     memberEnv.add(Type::Uint32.addConst(), "id", "i");
                                 }
@@ -736,6 +1022,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                                 // Loop through group members
                                 EnvironmentGroupMergedField<CustomUpdateGroupMerged> memberEnv(groupEnv, c);
                                 if (c.getArchetype().getDims() & VarAccessDim::ELEMENT) {
+                                    if(profilingEnabled) {
+                                        memberEnv.printLine("profile.neurons += $(num_neurons);");
+                                    }
                                     memberEnv.print("for(unsigned int i = 0; i < $(num_neurons); i++)");
                                     memberEnv.add(Type::Uint32.addConst(), "id", "i");
                                 }
@@ -761,7 +1050,7 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                 // Loop through merged custom WU update groups
                 modelMerged.genMergedCustomUpdateWUGroups(
                     *this, memorySpaces, g,
-                    [this, &funcEnv](auto &c)
+                    [this, &funcEnv, &model](auto &c)
                     {
                         CodeStream::Scope b(funcEnv.getStream());
                         funcEnv.getStream() << "// merged custom WU update group " << c.getIndex() << std::endl;
@@ -777,6 +1066,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                             buildSizeEnvironment(groupEnv);
                             buildStandardEnvironment(groupEnv, 1);
 
+                            const bool profilingEnabled = model.isProfilingEnabled();
+                            GroupProfiler p(groupEnv.getStream(), c, profilingEnabled);
+
                             // **TODO** add fields
                             const SynapseGroupInternal *sg = c.getArchetype().getSynapseGroup();
                             if (sg->getMatrixType() & SynapseMatrixWeight::KERNEL) {
@@ -800,10 +1092,16 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                                     // If this synapse group has sparse connectivity, loop through length of this row
                                     CodeStream::Scope b(groupEnv.getStream());
                                     if (sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
+                                        if(profilingEnabled) {
+                                            groupEnv.printLine("profile.synapses += $(_row_length)[i];");
+                                        }
                                         groupEnv.print("for(unsigned int s = 0; s < $(_row_length)[i]; s++)");
                                     }
                                     // Otherwise, if it's dense, loop through each postsynaptic neuron
                                     else if (sg->getMatrixType() & SynapseMatrixConnectivity::DENSE) {
+                                        if(profilingEnabled) {
+                                            groupEnv.printLine("profile.synapses += $(num_post);");
+                                        }
                                         groupEnv.print("for (unsigned int j = 0; j < $(num_post); j++)");
                                     }
                                     else {
@@ -850,7 +1148,7 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                 // Loop through merged custom connectivity update groups
                 modelMerged.genMergedCustomConnectivityUpdateGroups(
                     *this, memorySpaces, g,
-                    [this, &funcEnv](auto &c)
+                    [this, &funcEnv, &model](auto &c)
                     {
                         CodeStream::Scope b(funcEnv.getStream());
                         funcEnv.getStream() << "// merged custom connectivity update group " << c.getIndex() << std::endl;
@@ -867,6 +1165,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                             // Create matching environment
                             EnvironmentGroupMergedField<CustomConnectivityUpdateGroupMerged> groupEnv(rngEnv, c);
                             buildStandardEnvironment(groupEnv);
+
+                            const bool profilingEnabled = model.isProfilingEnabled();
+                            GroupProfiler p(groupEnv.getStream(), c, profilingEnabled);
            
                             // Loop through presynaptic neurons
                             groupEnv.print("for(unsigned int i = 0; i < $(num_pre); i++)");
@@ -902,13 +1203,8 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                             EnvironmentGroupMergedField<CustomConnectivityRemapUpdateGroupMerged> groupEnv(funcEnv, c);
                             buildStandardEnvironment(groupEnv);
                             
-                            groupEnv.printLine("// Loop through presynaptic neurons");
-                            groupEnv.print("for (unsigned int i = 0; i < $(num_pre); i++)");
-                            {
-                                CodeStream::Scope b(groupEnv.getStream());
-
-                                genRemap(groupEnv);
-                            }
+                            // Invalidate remap so it gets rebuilt before next postsynaptic update
+                            groupEnv.printLine("*$(_remap_valid) = 0;");
                         }
                     });
             }
@@ -918,7 +1214,7 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                 Timer t(funcEnv.getStream(), "customUpdate" + g + "Transpose", model.isTimingEnabled());
                 modelMerged.genMergedCustomUpdateTransposeWUGroups(
                     *this, memorySpaces, g,
-                    [this, &funcEnv](auto &c)
+                    [this, &funcEnv, &model](auto &c)
                     {
                         CodeStream::Scope b(funcEnv.getStream());
                         funcEnv.getStream() << "// merged custom WU transpose update group " << c.getIndex() << std::endl;
@@ -934,6 +1230,9 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
                             buildSizeEnvironment(groupEnv);
                             buildStandardEnvironment(groupEnv, 1);
 
+                            const bool profilingEnabled = model.isProfilingEnabled();
+                            GroupProfiler p(groupEnv.getStream(), c, profilingEnabled);
+
                             // Add field for transpose field and get its name
                             const std::string transposeVarName = c.addTransposeField(groupEnv);
 
@@ -981,6 +1280,13 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
     modelMerged.genMergedCustomConnectivityRemapUpdateStructs(os, *this);
     modelMerged.genMergedCustomConnectivityHostUpdateStructs(os, *this);
 
+    // If instance context is enabled, generate structure to hold merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContext(os, "CustomUpdate", modelMerged.getMergedCustomUpdateGroups(), modelMerged.getMergedCustomUpdateWUGroups(),
+                         modelMerged.getMergedCustomUpdateTransposeWUGroups(), modelMerged.getMergedCustomConnectivityUpdateGroups(),
+                         modelMerged.getMergedCustomConnectivityRemapUpdateGroups(), modelMerged.getMergedCustomConnectivityHostUpdateGroups());
+    }
+
     // Generate arrays of merged structs and functions to set them
     modelMerged.genMergedCustomUpdateHostStructArrayPush(os, *this);
     modelMerged.genMergedCustomUpdateWUHostStructArrayPush(os, *this);
@@ -994,6 +1300,12 @@ void Backend::genCustomUpdate(CodeStream &os, ModelSpecMerged &modelMerged, Back
 
     os << customUpdateStream.str();
 
+    // If instance context is enabled, generate functions to allocate and free merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContextAllocation(os, "CustomUpdate", modelMerged.getMergedCustomUpdateGroups(), modelMerged.getMergedCustomUpdateWUGroups(),
+                                   modelMerged.getMergedCustomUpdateTransposeWUGroups(), modelMerged.getMergedCustomConnectivityUpdateGroups(),
+                                   modelMerged.getMergedCustomConnectivityRemapUpdateGroups(), modelMerged.getMergedCustomConnectivityHostUpdateGroups());
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase::MemorySpaces &memorySpaces, 
@@ -1013,7 +1325,7 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
     EnvironmentLibrary backendEnv(rngEnv, backendFunctions);
     EnvironmentLibrary initEnv(backendEnv, StandardLibrary::getMathsFunctions());
 
-    initEnv.getStream() << "void initialize()";
+    initEnv.getStream() << "void initialize(" << (isInstanceContextEnabled() ? "GeNNContext *context" : "") << ")";
     {
         CodeStream::Scope b(initEnv.getStream());
         EnvironmentExternal funcEnv(initEnv);
@@ -1155,6 +1467,12 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
             {
                 CodeStream::Scope b(funcEnv.getStream());
                 funcEnv.getStream() << "// merged synapse connectivity init group " << s.getIndex() << std::endl;
+
+                // If this instance shares connectivity with another, skip initialising it
+                // **NOTE** connectivity built alongside kernel variables is always initialised by each instance
+                if(isInstanceContextEnabled() && s.getArchetype().getKernelSize().empty()) {
+                    funcEnv.getStream() << "if(!skipConnectivityInit) ";
+                }
                 funcEnv.getStream() << "for(unsigned int g = 0; g < " << s.getGroups().size() << "; g++)";
                 {
                     CodeStream::Scope b(funcEnv.getStream());
@@ -1279,7 +1597,7 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
             });
     }
     initEnv.getStream() << std::endl;
-    initEnv.getStream() << "void initializeSparse()";
+    initEnv.getStream() << "void initializeSparse(" << (isInstanceContextEnabled() ? "GeNNContext *context" : "") << ")";
     {
         CodeStream::Scope b(initEnv.getStream());
         EnvironmentExternal funcEnv(initEnv);
@@ -1303,22 +1621,23 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
                     EnvironmentGroupMergedField<SynapseSparseInitGroupMerged> groupEnv(funcEnv, s);
                     buildStandardEnvironment(groupEnv, modelMerged.getModel().getBatchSize());
 
-                    groupEnv.printLine("// Loop through presynaptic neurons");
-                    groupEnv.print("for (unsigned int i = 0; i < $(num_pre); i++)");
-                    {
-                        CodeStream::Scope b(groupEnv.getStream());
+                    // If postsynaptic learning is required, invalidate remap 
+                    // **NOTE** it will be built before first postsynaptic update
+                    if(s.getArchetype().isPostSpikeRequired() || s.getArchetype().isPostSpikeEventRequired()) {
+                        groupEnv.printLine("*$(_remap_valid) = 0;");
+                    }
 
-                        // Generate sparse initialisation code
-                        groupEnv.add(Type::Uint32.addConst(), "id_pre", "i");
-                        if(s.getArchetype().isWUVarInitRequired()) {
+                    // Generate sparse initialisation code
+                    if(s.getArchetype().isWUVarInitRequired()) {
+                        groupEnv.printLine("// Loop through presynaptic neurons");
+                        groupEnv.print("for (unsigned int i = 0; i < $(num_pre); i++)");
+                        {
+                            CodeStream::Scope b(groupEnv.getStream());
+
+                            groupEnv.add(Type::Uint32.addConst(), "id_pre", "i");
                             groupEnv.add(Type::Uint32.addConst(), "row_len", "$(_row_length)[i]");
                             s.generateInit(*this, groupEnv, 1);
                         }
-
-                        // If postsynaptic learning is required
-                        if(s.getArchetype().isPostSpikeRequired() || s.getArchetype().isPostSpikeEventRequired()) {
-                            genRemap(groupEnv);
-                        }
                     }
                 }
             });
@@ -1397,6 +1716,17 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
     modelMerged.genMergedCustomConnectivityUpdatePostInitStructs(os, *this);
     modelMerged.genMergedCustomConnectivityUpdateSparseInitStructs(os, *this);
 
+    // If instance context is enabled, generate structure to hold merged group arrays
+    // **NOTE** merged synapse connectivity host init structures are generated later by preamble handler
+    if(isInstanceContextEnabled()) {
+        genModuleContext(os, "Init", modelMerged.getMergedNeuronInitGroups(), modelMerged.getMergedSynapseInitGroups(),
+                         modelMerged.getMergedCustomUpdateInitGroups(), modelMerged.getMergedCustomWUUpdateInitGroups(),
+                         modelMerged.getMergedSynapseConnectivityInitGroups(), modelMerged.getMergedSynapseSparseInitGroups(),
+                         modelMerged.getMergedCustomWUUpdateSparseInitGroups(), modelMerged.getMergedCustomConnectivityUpdatePreInitGroups(),
+                         modelMerged.getMergedCustomConnectivityUpdatePostInitGroups(), modelMerged.getMergedCustomConnectivityUpdateSparseInitGroups(),
+                         modelMerged.getMergedSynapseConnectivityHostInitGroups());
+    }
+
     // Generate arrays of merged structs and functions to set them
     modelMerged.genMergedNeuronInitGroupHostStructArrayPush(os, *this);
     modelMerged.genMergedSynapseInitGroupHostStructArrayPush(os, *this);
@@ -1414,6 +1744,15 @@ void Backend::genInit(CodeStream &os, ModelSpecMerged &modelMerged, BackendBase:
 
     os << initStream.str();
 
+    // If instance context is enabled, generate functions to allocate and free merged group arrays
+    if(isInstanceContextEnabled()) {
+        genModuleContextAllocation(os, "Init", modelMerged.getMergedNeuronInitGroups(), modelMerged.getMergedSynapseInitGroups(),
+                                   modelMerged.getMergedCustomUpdateInitGroups(), modelMerged.getMergedCustomWUUpdateInitGroups(),
+                                   modelMerged.getMergedSynapseConnectivityInitGroups(), modelMerged.getMergedSynapseSparseInitGroups(),
+                                   modelMerged.getMergedCustomWUUpdateSparseInitGroups(), modelMerged.getMergedCustomConnectivityUpdatePreInitGroups(),
+                                   modelMerged.getMergedCustomConnectivityUpdatePostInitGroups(), modelMerged.getMergedCustomConnectivityUpdateSparseInitGroups(),
+                                   modelMerged.getMergedSynapseConnectivityHostInitGroups());
+    }
 }
 //--------------------------------------------------------------------------
 size_t Backend::getSynapticMatrixRowStride(const SynapseGroupInternal &sg) const
@@ -1478,10 +1817,46 @@ void Backend::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerged &mode
     // to match this, bring std::min and std::max into global namespace
     os << "using std::min;" << std::endl;
     os << "using std::max;" << std::endl;
+    os << std::endl;
+
+    // Generate definitions of samplers used by host RNG functions
+    StandardLibrary::genHostRNGFunctions(os);
+
+    // If approximate maths functions are used anywhere in model, generate definitions
+    if(model.isApproximateMathsEnabled() 
+       || std::any_of(model.getNeuronGroups().cbegin(), model.getNeuronGroups().cend(),
+                      [](const auto &n){ return n.second.isApproximateMathsEnabled(); }))
+    {
+        os << std::endl;
+        StandardLibrary::genApproximateMathsFunctions(os);
+    }
 }
 //--------------------------------------------------------------------------
-void Backend::genRunnerPreamble(CodeStream &, const ModelSpecMerged &) const
+void Backend::genRunnerPreamble(CodeStream &os, const ModelSpecMerged &) const
 {
+    // If update code is compiled for multiple ISAs, generate function to report 
+    // which one the CPU supports and was therefore selected when library was loaded
+    const auto &targetISAs = getPreferences<Preferences>().targetISAs;
+    if(!targetISAs.empty()) {
+        os << "extern \"C\" EXPORT_FUNC const char *getTargetISA()";
+        {
+            CodeStream::Scope b(os);
+            os << "#if defined(__x86_64__) && defined(__linux__)" << std::endl;
+            os << "__builtin_cpu_init();" << std::endl;
+            for(const auto &t : targetISALevels) {
+                if(std::find(targetISAs.cbegin(), targetISAs.cend(), t) != targetISAs.cend()) {
+                    os << "if(__builtin_cpu_supports(\"" << t << "\"))";
+                    {
+                        CodeStream::Scope b(os);
+                        os << "return \"" << t << "\";" << std::endl;
+                    }
+                }
+            }
+            os << "#endif" << std::endl;
+            os << "return \"default\";" << std::endl;
+        }
+        os << std::endl;
+    }
 }
 //--------------------------------------------------------------------------
 void Backend::genAllocateMemPreamble(CodeStream&, const ModelSpecMerged&) const
@@ -1794,24 +2169,73 @@ boost::uuids::detail::sha1::digest_type Backend::getHashDigest() const
     // Update hash with preferences
     getPreferences<Preferences>().updateHash(hash);
 
+    // Update hash with autotuned presynaptic update strategies
+    Utils::updateHash(m_PresynapticUpdateStrategies, hash);
+
     return hash.get_digest();
 }
 //--------------------------------------------------------------------------
+PresynapticUpdateStrategy Backend::getPresynapticUpdateStrategy(const PresynapticUpdateGroupMerged &sg) const
+{
+    // If a strategy has been selected for this merged group by autotuning, use it
+    const auto strategy = m_PresynapticUpdateStrategies.find(sg.getHashDigest());
+    if(strategy != m_PresynapticUpdateStrategies.cend()) {
+        return strategy->second;
+    }
+    // Otherwise, select default based on connectivity
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+        return isToeplitzConv2DSupported(sg) ? PresynapticUpdateStrategy::TOEPLITZ_CONV2D : PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR;
+    }
+    else if((sg.getArchetype().getParallelismHint() == SynapseGroup::ParallelismHint::WORD_PACKED_BITMASK)
+            && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK))
+    {
+        return PresynapticUpdateStrategy::WORD_PACKED_BITMASK;
+    }
+    else {
+        return PresynapticUpdateStrategy::ROW_WISE;
+    }
+}
+//--------------------------------------------------------------------------
+bool Backend::isToeplitzConv2DSupported(const PresynapticUpdateGroupMerged &sg) const
+{
+    const auto &archetype = sg.getArchetype();
+    if(!(archetype.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) || archetype.isPresynapticOutputRequired()) {
+        return false;
+    }
+
+    const auto *snippet = archetype.getToeplitzConnectivityInitialiser().getSnippet();
+    return (snippet == InitToeplitzConnectivitySnippet::Conv2D::getInstance()
+            || snippet == InitToeplitzConnectivitySnippet::AvgPoolConv2D::getInstance());
+}
+//--------------------------------------------------------------------------
 void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpdateGroupMerged &sg, 
-                                   double dt, bool trueSpike) const
+                                   double dt, bool trueSpike, bool profilingEnabled) const
 {
     // Get suffix based on type of events
     const std::string eventSuffix = trueSpike ? "" : "_event";
 
     const bool delayRequired = (trueSpike ? sg.getArchetype().getSrcNeuronGroup()->isSpikeDelayRequired()
                                 : sg.getArchetype().getSrcNeuronGroup()->isSpikeEventDelayRequired());
-    if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+
+    // Count presynaptic events processed
+    if(profilingEnabled) {
+        env.printLine("profile.spikes += $(_src_spk_cnt" + eventSuffix + ")[" + (delayRequired ? "$(_pre_delay_slot)" : "0") + "];");
+    }
+
+    const auto strategy = getPresynapticUpdateStrategy(sg);
+    if(strategy == PresynapticUpdateStrategy::TOEPLITZ_CONV2D) {
+        genToeplitzConv2DPresynapticUpdate(env, sg, dt, trueSpike, profilingEnabled);
+    }
+    else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
         // Create environment for generating presynaptic update code into seperate CodeStream
         std::ostringstream preUpdateStream;
         CodeStream preUpdate(preUpdateStream);
         {
             CodeStream::Scope b(preUpdate);
             EnvironmentExternal preUpdateEnv(env, preUpdate);
+            if(profilingEnabled) {
+                preUpdate << "profile.synapses++;" << std::endl;
+            }
             preUpdateEnv.add(Type::Uint32.addConst(), "id_pre", "ipre");
 
             // Replace $(id_post) with first 'function' parameter as simulation code is
@@ -1829,7 +2253,7 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
             }
                     
             // Add correct functions for apply synaptic input
-            preUpdateEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", "$(_den_delay)[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
+            preUpdateEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", getAddToPostDelay(sg));
             preUpdateEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPost", "$(_out_post)[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
             preUpdateEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPre", "$(_out_pre)[" + sg.getPreISynIndex(1, "$(id_pre)") + "] += $(0)");
 
@@ -1842,55 +2266,102 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
             }
         }
 
-        // Loop through Toeplitz matrix diagonals
-        env.print("for(unsigned int j = 0; j < $(_row_stride); j++)");
-        {
-            CodeStream::Scope b(env.getStream());
+        // Define type
+        const auto addSynapseType = Type::ResolvedType::createFunction(
+            Type::Void, std::vector<Type::ResolvedType>{1ull + sg.getArchetype().getKernelSize().size(), Type::Uint32});
 
-            // Create second environment for initialising Toeplitz connectivity
-            EnvironmentExternal toeplitzEnv(env);
-            toeplitzEnv.add(Type::Uint32.addConst(), "id_diag", "j");
-            
-            // Define type
-            const auto addSynapseType = Type::ResolvedType::createFunction(
-                Type::Void, std::vector<Type::ResolvedType>{1ull + sg.getArchetype().getKernelSize().size(), Type::Uint32});
-
-            // Generate toeplitz connectivity generation code using custom for_each_synapse loop
-            sg.generateToeplitzConnectivity(
-                toeplitzEnv,
-                // Within for_each_synapse loops, define addSynapse function and id_pre
-                [addSynapseType](auto &env, auto &errorHandler)
-                {
-                    env.define(Transpiler::Token{Transpiler::Token::Type::IDENTIFIER, "addSynapse", 0}, addSynapseType, errorHandler);
-                    env.define(Transpiler::Token{Transpiler::Token::Type::IDENTIFIER, "id_pre", 0}, Type::Uint32.addConst(), errorHandler);
-                },
-                [addSynapseType, delayRequired, trueSpike, &eventSuffix, &preUpdateStream](auto &env, auto generateBody)
+        // Within for_each_synapse loops, define addSynapse function and id_pre
+        const auto forEachSynapseTypeCheckHandler = 
+            [addSynapseType](auto &env, auto &errorHandler)
+            {
+                env.define(Transpiler::Token{Transpiler::Token::Type::IDENTIFIER, "addSynapse", 0}, addSynapseType, errorHandler);
+                env.define(Transpiler::Token{Transpiler::Token::Type::IDENTIFIER, "id_pre", 0}, Type::Uint32.addConst(), errorHandler);
+            };
+
+        const std::string queueOffset = delayRequired ? "$(_pre_delay_offset) + " : "";
+        if(strategy == PresynapticUpdateStrategy::TOEPLITZ_SPIKE_MAJOR) {
+            // Detect spike events or spikes and do the update
+            env.getStream() << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+            if(delayRequired) {
+                env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[$(_pre_delay_slot)]; i++)");
+            }
+            else {
+                env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[0]; i++)");
+            }
+            {
+                CodeStream::Scope b(env.getStream());
+                env.printLine("const unsigned int ipre = $(_src_spk" + eventSuffix + ")[" + queueOffset + "i];");
+
+                // Loop through Toeplitz matrix diagonals
+                env.print("for(unsigned int j = 0; j < $(_row_stride); j++)");
                 {
-                    // Detect spike events or spikes and do the update
-                    env.getStream() << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
-                    if(delayRequired) {
-                        env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[$(_pre_delay_slot)]; i++)");
-                    }
-                    else {
-                        env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[0]; i++)");
-                    }
+                    CodeStream::Scope b(env.getStream());
+
+                    // Create second environment for initialising Toeplitz connectivity
+                    EnvironmentExternal toeplitzEnv(env);
+                    toeplitzEnv.add(Type::Uint32.addConst(), "id_diag", "j");
+
+                    // Generate toeplitz connectivity generation code with for_each_synapse 
+                    // loop replaced by a single iteration for this presynaptic spike
+                    sg.generateToeplitzConnectivity(
+                        toeplitzEnv, forEachSynapseTypeCheckHandler,
+                        [addSynapseType, &preUpdateStream](auto &env, auto generateBody)
+                        {
+                            CodeStream::Scope b(env.getStream());
+                            EnvironmentExternal bodyEnv(env);
+
+                            // Add presynaptic index
+                            bodyEnv.add(Type::Uint32.addConst(), "id_pre", "ipre");
+
+                            // Add function substitution with parameters to add 
+                            bodyEnv.add(addSynapseType, "addSynapse", preUpdateStream.str());
+
+                            // Generate body of for_each_synapse loop within this new environment
+                            generateBody(bodyEnv);
+                        });
+                }
+            }
+        }
+        else {
+            // Loop through Toeplitz matrix diagonals
+            env.print("for(unsigned int j = 0; j < $(_row_stride); j++)");
+            {
+                CodeStream::Scope b(env.getStream());
+
+                // Create second environment for initialising Toeplitz connectivity
+                EnvironmentExternal toeplitzEnv(env);
+                toeplitzEnv.add(Type::Uint32.addConst(), "id_diag", "j");
+
+                // Generate toeplitz connectivity generation code using custom for_each_synapse loop
+                sg.generateToeplitzConnectivity(
+                    toeplitzEnv, forEachSynapseTypeCheckHandler,
+                    [addSynapseType, delayRequired, trueSpike, &eventSuffix, &queueOffset, &preUpdateStream](auto &env, auto generateBody)
                     {
-                        CodeStream::Scope b(env.getStream());
-                        EnvironmentExternal bodyEnv(env);
+                        // Detect spike events or spikes and do the update
+                        env.getStream() << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+                        if(delayRequired) {
+                            env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[$(_pre_delay_slot)]; i++)");
+                        }
+                        else {
+                            env.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[0]; i++)");
+                        }
+                        {
+                            CodeStream::Scope b(env.getStream());
+                            EnvironmentExternal bodyEnv(env);
 
-                        const std::string queueOffset = delayRequired ? "$(_pre_delay_offset) + " : "";
-                        bodyEnv.printLine("const unsigned int ipre = $(_src_spk" + eventSuffix + ")[" + queueOffset + "i];");
-                        
-                        // Add presynaptic index
-                        bodyEnv.add(Type::Uint32.addConst(), "id_pre", "ipre");
+                            bodyEnv.printLine("const unsigned int ipre = $(_src_spk" + eventSuffix + ")[" + queueOffset + "i];");
+                            
+                            // Add presynaptic index
+                            bodyEnv.add(Type::Uint32.addConst(), "id_pre", "ipre");
 
-                        // Add function substitution with parameters to add 
-                        bodyEnv.add(addSynapseType, "addSynapse", preUpdateStream.str());
+                            // Add function substitution with parameters to add 
+                            bodyEnv.add(addSynapseType, "addSynapse", preUpdateStream.str());
 
-                        // Generate body of for_each_synapse loop within this new environment
-                        generateBody(bodyEnv);
-                    }
-                });
+                            // Generate body of for_each_synapse loop within this new environment
+                            generateBody(bodyEnv);
+                        }
+                    });
+            }
         }
     }
     else {
@@ -1914,6 +2385,9 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
             // If connectivity is sparse
             if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                 groupEnv.printLine("const unsigned int npost = $(_row_length)[$(id_pre)];");
+                if(profilingEnabled) {
+                    groupEnv.getStream() << "profile.synapses += npost;" << std::endl;
+                }
                 groupEnv.getStream() << "for (unsigned int j = 0; j < npost; j++)";
                 {
                     CodeStream::Scope b(groupEnv.getStream());
@@ -1927,12 +2401,15 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
                                {synEnv.addInitialiser("const unsigned int idPost = $(_ind)[$(id_syn)];")});
                     
                     // Add correct functions for apply synaptic input
-                    synEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", "$(_den_delay)[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
+                    synEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", getAddToPostDelay(sg));
                     synEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPost", "$(_out_post)[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
                     synEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPre", "$(_out_pre)[" + sg.getPreISynIndex(1, "$(id_pre)") + "] += $(0)");
 
                     if(trueSpike) {
                         sg.generateSpikeUpdate(*this, synEnv, 1, dt);
+
+                        // Process spike for any synapse groups sharing this group's connectivity within the same traversal of the row
+                        sg.generateSharedConnectivitySpikeUpdate(*this, synEnv, 1, dt);
                     }
                     else {
                         sg.generateSpikeEventUpdate(*this, synEnv, 1, dt);
@@ -1942,7 +2419,7 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
             else if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::PROCEDURAL) {
                 throw std::runtime_error("The single-threaded CPU backend does not support procedural connectivity.");
             }
-            else if((sg.getArchetype().getParallelismHint() == SynapseGroup::ParallelismHint::WORD_PACKED_BITMASK)
+            else if((strategy == PresynapticUpdateStrategy::WORD_PACKED_BITMASK)
                     && (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::BITMASK))
             {
                 // Determine the number of words in each row
@@ -1959,7 +2436,7 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
                     groupEnv.add(Type::Uint32.addConst(), "id_post", "ipost");
                     
                     // Add correct functions for apply synaptic input
-                    groupEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", "$(_den_delay)[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
+                    groupEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", getAddToPostDelay(sg));
                     groupEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPost", "$(_out_post)[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
                     groupEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPre", "$(_out_pre)[" + sg.getPreISynIndex(1, "$(id_pre)") + "] += $(0)");
 
@@ -1983,6 +2460,9 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
                         groupEnv.print("if(ipost < $(num_post))");
                         {
                             CodeStream::Scope b(env.getStream());
+                            if(profilingEnabled) {
+                                groupEnv.getStream() << "profile.synapses++;" << std::endl;
+                            }
                             if(trueSpike) {
                                 sg.generateSpikeUpdate(*this, groupEnv, 1, dt);
                             }
@@ -1998,6 +2478,19 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
             }
             // Otherwise (DENSE or BITMASK)
             else {
+                // If connectivity is dense, count all synapses outside of loop so it remains vectorisable
+                const bool dense = (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::DENSE);
+                if(profilingEnabled && dense) {
+                    groupEnv.printLine("profile.synapses += $(num_post);");
+                }
+
+                // If weight update is a row AXPY, there are no dependencies between postsynaptic neurons
+                // **NOTE** this saves GCC from versioning the loop to check the input and weights don't alias
+                if(isDenseRowAccumulate(sg.getArchetype())) {
+                    groupEnv.getStream() << "#if defined(__GNUC__) && !defined(__clang__)" << std::endl;
+                    groupEnv.getStream() << "#pragma GCC ivdep" << std::endl;
+                    groupEnv.getStream() << "#endif" << std::endl;
+                }
                 groupEnv.print("for (unsigned int ipost = 0; ipost < $(num_post); ipost++)");
                 {
                     CodeStream::Scope b(groupEnv.getStream());
@@ -2005,7 +2498,7 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
                     synEnv.add(Type::Uint32, "id_post", "ipost");
                     
                     // Add correct functions for apply synaptic input
-                    synEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", "$(_den_delay)[" + sg.getPostDenDelayIndex(1, "$(id_post)", "$(1)") + "] += $(0)");
+                    synEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", getAddToPostDelay(sg));
                     synEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPost", "$(_out_post)[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
                     synEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPre", "$(_out_pre)[" + sg.getPreISynIndex(1, "$(id_pre)") + "] += $(0)");
 
@@ -2018,8 +2511,14 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
                         synEnv.getStream() << CodeStream::OB(20);
                     }
                     else {
-                        synEnv.add(indexType.addConst(), "id_syn", "idSyn",
-                                   {synEnv.addInitialiser("const " + indexTypeName + " idSyn = ((" + indexTypeName + ")$(id_pre) * $(num_post)) + $(id_post);")});
+                        // **NOTE** GCC can't prove 32-bit unsigned index arithmetic doesn't
+                        // wrap so synapse index is calculated in 64-bit to allow vectorisation
+                        synEnv.add(Type::Uint64.addConst(), "id_syn", "idSyn",
+                                   {synEnv.addInitialiser("const size_t idSyn = ((size_t)$(id_pre) * $(num_post)) + $(id_post);")});
+                    }
+
+                    if(profilingEnabled && !dense) {
+                        synEnv.getStream() << "profile.synapses++;" << std::endl;
                     }
 
                     if(trueSpike) {
@@ -2038,8 +2537,112 @@ void Backend::genPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpda
     }
 }
 //--------------------------------------------------------------------------
+void Backend::genToeplitzConv2DPresynapticUpdate(EnvironmentExternalBase &env, PresynapticUpdateGroupMerged &sg, 
+                                                 double dt, bool trueSpike, bool profilingEnabled) const
+{
+    assert(isToeplitzConv2DSupported(sg));
+
+    // Get suffix based on type of events
+    const std::string eventSuffix = trueSpike ? "" : "_event";
+    const bool delayRequired = (trueSpike ? sg.getArchetype().getSrcNeuronGroup()->isSpikeDelayRequired()
+                                : sg.getArchetype().getSrcNeuronGroup()->isSpikeEventDelayRequired());
+    const bool avgPool = (sg.getArchetype().getToeplitzConnectivityInitialiser().getSnippet() 
+                          == InitToeplitzConnectivitySnippet::AvgPoolConv2D::getInstance());
+
+    // Substitute in parameters and derived parameters of convolution
+    EnvironmentGroupMergedField<PresynapticUpdateGroupMerged> groupEnv(env, sg);
+    groupEnv.addInitialiserParams("", &SynapseGroupInternal::getToeplitzConnectivityInitialiser);
+    groupEnv.addInitialiserDerivedParams("", &SynapseGroupInternal::getToeplitzConnectivityInitialiser);
+
+    // Detect spike events or spikes and do the update
+    const std::string queueOffset = delayRequired ? "$(_pre_delay_offset) + " : "";
+    groupEnv.getStream() << "// process presynaptic events: " << (trueSpike ? "True Spikes" : "Spike type events") << std::endl;
+    groupEnv.print("for (unsigned int i = 0; i < $(_src_spk_cnt" + eventSuffix + ")[" + (delayRequired ? "$(_pre_delay_slot)" : "0") + "]; i++)");
+    {
+        CodeStream::Scope b(groupEnv.getStream());
+        groupEnv.printLine("const unsigned int ipre = $(_src_spk" + eventSuffix + ")[" + queueOffset + "i];");
+
+        // Convert presynaptic index into row, column and channel of convolution input
+        const std::string inChans = avgPool ? "$(pool_ic)" : "$(conv_ic)";
+        if(avgPool) {
+            // If presynaptic neuron isn't within a pooling window, skip
+            groupEnv.printLine("const int prePoolInRow = (ipre / $(pool_ic)) / $(pool_iw);");
+            groupEnv.printLine("const int prePoolInCol = (ipre / $(pool_ic)) % $(pool_iw);");
+            groupEnv.printLine("const int preRow = prePoolInRow / $(pool_sh);");
+            groupEnv.printLine("const int preCol = prePoolInCol / $(pool_sw);");
+            groupEnv.print("if(prePoolInRow >= ((preRow * $(pool_sh)) + $(pool_kh)) || prePoolInCol >= ((preCol * $(pool_sw)) + $(pool_kw)))");
+            {
+                CodeStream::Scope b(groupEnv.getStream());
+                groupEnv.getStream() << "continue;" << std::endl;
+            }
+        }
+        else {
+            groupEnv.printLine("const int preRow = (ipre / $(conv_ic)) / $(conv_iw);");
+            groupEnv.printLine("const int preCol = (ipre / $(conv_ic)) % $(conv_iw);");
+        }
+        groupEnv.printLine("const unsigned int preChan = ipre % " + inChans + ";");
+
+        // Clip kernel to the rows and columns which fall within the output, rather than testing every synapse
+        groupEnv.printLine("const int minKernRow = max(0, (int)$(conv_bh) - preRow);");
+        groupEnv.printLine("const int maxKernRow = min((int)$(conv_kh), (int)$(conv_oh) + (int)$(conv_bh) - preRow);");
+        groupEnv.printLine("const int minKernCol = max(0, (int)$(conv_bw) - preCol);");
+        groupEnv.printLine("const int maxKernCol = min((int)$(conv_kw), (int)$(conv_ow) + (int)$(conv_bw) - preCol);");
+        groupEnv.getStream() << "for(int kernRow = minKernRow; kernRow < maxKernRow; kernRow++)";
+        {
+            CodeStream::Scope b(groupEnv.getStream());
+            groupEnv.getStream() << "for(int kernCol = minKernCol; kernCol < maxKernCol; kernCol++)";
+            {
+                CodeStream::Scope b(groupEnv.getStream());
+
+                // Postsynaptic neurons for all output channels are contiguous
+                groupEnv.printLine("const unsigned int postOffset = (((preRow + kernRow - (int)$(conv_bh)) * $(conv_ow)) + (preCol + kernCol - (int)$(conv_bw))) * $(conv_oc);");
+                if(profilingEnabled) {
+                    groupEnv.printLine("profile.synapses += $(conv_oc);");
+                }
+
+                // If weight update model is a built-in static one, each output channel only 
+                // updates its own postsynaptic input so it's safe to ask GCC to vectorise this loop
+                if(isStaticAccumulate(sg.getArchetype())) {
+                    groupEnv.getStream() << "#if defined(__GNUC__) && !defined(__clang__)" << std::endl;
+                    groupEnv.getStream() << "#pragma GCC ivdep" << std::endl;
+                    groupEnv.getStream() << "#endif" << std::endl;
+                }
+                groupEnv.print("for(unsigned int kernOutChan = 0; kernOutChan < $(conv_oc); kernOutChan++)");
+                {
+                    CodeStream::Scope b(groupEnv.getStream());
+                    EnvironmentGroupMergedField<PresynapticUpdateGroupMerged> synEnv(groupEnv, sg);
+                    synEnv.add(Type::Uint32.addConst(), "id_pre", "ipre");
+                    // **NOTE** GCC can't prove 32-bit unsigned index arithmetic doesn't
+                    // wrap so postsynaptic index is calculated in 64-bit to allow vectorisation
+                    synEnv.add(Type::Uint32.addConst(), "id_post", "idPost",
+                               {synEnv.addInitialiser("const size_t idPost = (size_t)postOffset + kernOutChan;")});
+
+                    // Kernel is flipped and indexed by [row, column, input channel, output channel]
+                    synEnv.add(Type::Uint32.addConst(), "id_kernel_0", "flipKernRow",
+                               {synEnv.addInitialiser("const unsigned int flipKernRow = $(conv_kh) - kernRow - 1;")});
+                    synEnv.add(Type::Uint32.addConst(), "id_kernel_1", "flipKernCol",
+                               {synEnv.addInitialiser("const unsigned int flipKernCol = $(conv_kw) - kernCol - 1;")});
+                    synEnv.add(Type::Uint32.addConst(), "id_kernel_2", "preChan");
+                    synEnv.add(Type::Uint32.addConst(), "id_kernel_3", "kernOutChan");
+
+                    // Add correct functions for apply synaptic input
+                    synEnv.add(Type::getAddToPrePostDelay(sg.getScalarType()), "addToPostDelay", getAddToPostDelay(sg));
+                    synEnv.add(Type::getAddToPrePost(sg.getScalarType()), "addToPost", "$(_out_post)[" + sg.getPostISynIndex(1, "$(id_post)") + "] += $(0)");
+
+                    if(trueSpike) {
+                        sg.generateSpikeUpdate(*this, synEnv, 1, dt);
+                    }
+                    else {
+                        sg.generateSpikeEventUpdate(*this, synEnv, 1, dt);
+                    }
+                }
+            }
+        }
+    }
+}
+//--------------------------------------------------------------------------
 void Backend::genPostsynapticUpdate(EnvironmentExternalBase &env, PostsynapticUpdateGroupMerged &sg, 
-                                    double dt, bool trueSpike) const
+                                    double dt, bool trueSpike, bool profilingEnabled) const
 {
     // Get suffix based on type of events
     const std::string eventSuffix = trueSpike ? "" : "_event";
@@ -2054,6 +2657,11 @@ void Backend::genPostsynapticUpdate(EnvironmentExternalBase &env, PostsynapticUp
         env.printLine("const unsigned int numSpikes = $(_trg_spk_cnt" + eventSuffix + ")[0];");
     }
 
+    // Count postsynaptic events processed
+    if(profilingEnabled) {
+        env.getStream() << "profile.spikes += numSpikes;" << std::endl;
+    }
+
     // Loop through postsynaptic spikes
     env.getStream() << "for (unsigned int j = 0; j < numSpikes; j++)";
     {
@@ -2066,9 +2674,15 @@ void Backend::genPostsynapticUpdate(EnvironmentExternalBase &env, PostsynapticUp
         // Loop through column of presynaptic neurons
         if (sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
             env.printLine("const unsigned int npre = $(_col_length)[spike];");
+            if(profilingEnabled) {
+                env.getStream() << "profile.synapses += npre;" << std::endl;
+            }
             env.getStream() << "for (unsigned int i = 0; i < npre; i++)";
         }
         else {
+            if(profilingEnabled) {
+                env.printLine("profile.synapses += $(num_pre);");
+            }
             env.print("for (unsigned int i = 0; i < $(num_pre); i++)");
         }
         {
@@ -2077,13 +2691,34 @@ void Backend::genPostsynapticUpdate(EnvironmentExternalBase &env, PostsynapticUp
 
             if(sg.getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
                 // Add initialisers to calculate column and row-major indices
-                // **TODO** fast divide optimisations
                 const size_t colMajorIdxInit = synEnv.addInitialiser("const unsigned int colMajorIndex = (spike * $(_col_stride)) + i;");
                 const size_t rowMajorIdxInit = synEnv.addInitialiser("const unsigned int rowMajorIndex = $(_remap)[colMajorIndex];");
-                const size_t idPreInit = synEnv.addInitialiser("const unsigned int idPre = rowMajorIndex / $(_row_stride);");
 
-                // Add presynaptic and synapse index to environment
-                synEnv.add(Type::Uint32.addConst(), "id_pre", "idPre", {colMajorIdxInit, rowMajorIdxInit, idPreInit});
+                // If row stride is the same across merged groups, it will be a literal so compiler can optimise division
+                // **NOTE** if row capacity is growable, row stride changes at runtime so fast division constants can't be precalculated
+                const auto &groups = sg.getGroups();
+                const uint32_t archetypeRowStride = getSynapticMatrixRowStride(sg.getArchetype());
+                if(sg.getArchetype().isRowCapacityGrowable()
+                   || std::all_of(groups.cbegin(), groups.cend(),
+                                  [archetypeRowStride, this](const auto &g){ return getSynapticMatrixRowStride(g.get()) == archetypeRowStride; }))
+                {
+                    const size_t idPreInit = synEnv.addInitialiser("const unsigned int idPre = rowMajorIndex / $(_row_stride);");
+                    synEnv.add(Type::Uint32.addConst(), "id_pre", "idPre", {colMajorIdxInit, rowMajorIdxInit, idPreInit});
+                }
+                // Otherwise, replace division with multiply and shifts calculated for each group
+                else {
+                    synEnv.addField(Type::Uint32.addConst(), "_row_stride_div_mul", Type::Uint32, "rowStrideDivMul",
+                                    [this](const auto &g, size_t) { return std::get<0>(getFastDivide(getSynapticMatrixRowStride(g))); });
+                    synEnv.addField(Type::Uint32.addConst(), "_row_stride_div_shift_1", Type::Uint32, "rowStrideDivShift1",
+                                    [this](const auto &g, size_t) { return std::get<1>(getFastDivide(getSynapticMatrixRowStride(g))); });
+                    synEnv.addField(Type::Uint32.addConst(), "_row_stride_div_shift_2", Type::Uint32, "rowStrideDivShift2",
+                                    [this](const auto &g, size_t) { return std::get<2>(getFastDivide(getSynapticMatrixRowStride(g))); });
+                    const size_t rowMajorIdxHighInit = synEnv.addInitialiser("const unsigned int rowMajorIndexHigh = (unsigned int)(((uint64_t)$(_row_stride_div_mul) * rowMajorIndex) >> 32);");
+                    const size_t idPreInit = synEnv.addInitialiser("const unsigned int idPre = (rowMajorIndexHigh + ((rowMajorIndex - rowMajorIndexHigh) >> $(_row_stride_div_shift_1))) >> $(_row_stride_div_shift_2);");
+                    synEnv.add(Type::Uint32.addConst(), "id_pre", "idPre", {colMajorIdxInit, rowMajorIdxInit, rowMajorIdxHighInit, idPreInit});
+                }
+
+                // Add synapse index to environment
                 synEnv.add(Type::Uint32.addConst(), "id_syn", "rowMajorIndex", {colMajorIdxInit, rowMajorIdxInit});
             }
             else {
@@ -2144,6 +2779,26 @@ void Backend::genEmitEvent(EnvironmentExternalBase &env, NeuronUpdateGroupMerged
     env.printLine(" = $(id);");
 }
 //--------------------------------------------------------------------------
+void Backend::genTargetClonesAttribute(CodeStream &os) const
+{
+    const auto &targetISAs = getPreferences<Preferences>().targetISAs;
+    if(targetISAs.empty()) {
+        return;
+    }
+
+    // **NOTE** target clones are dispatched using indirect functions which are only supported on Linux
+    os << "#if defined(__x86_64__) && defined(__linux__)" << std::endl;
+    os << "__attribute__((target_clones(\"default\"";
+    for(const auto &t : targetISAs) {
+        if(std::find(targetISALevels.cbegin(), targetISALevels.cend(), t) == targetISALevels.cend()) {
+            throw std::runtime_error("Target ISA '" + t + "' is not supported by the single-threaded CPU backend");
+        }
+        os << ", \"arch=" << t << "\"";
+    }
+    os << ")))" << std::endl;
+    os << "#endif" << std::endl;
+}
+//--------------------------------------------------------------------------
 void Backend::genWriteBackReductions(EnvironmentExternalBase &env, CustomUpdateGroupMerged &cg, const std::string &idxName) const
 {
     genWriteBackReductions(
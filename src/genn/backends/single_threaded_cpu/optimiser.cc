@@ -1,12 +1,366 @@
 #include "optimiser.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+// PLOG includes
+#include <plog/Log.h>
+
+// GeNN includes
+#include "logging.h"
+#include "modelSpecInternal.h"
+
+// GeNN code generator includes
+#include "code_generator/generateMakefile.h"
+#include "code_generator/generateModules.h"
+#include "code_generator/modelSpecMerged.h"
+
+// GeNN runtime includes
+#include "runtime/runtime.h"
+
+using namespace GeNN;
+using namespace GeNN::CodeGenerator;
+using namespace GeNN::CodeGenerator::SingleThreadedCPU;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+//! Merged presynaptic update group which can be autotuned
+struct TunableGroup
+{
+    size_t index;
+    boost::uuids::detail::sha1::digest_type hashDigest;
+    std::vector<PresynapticUpdateStrategy> candidates;
+};
+
+const char *getStrategyName(PresynapticUpdateStrategy strategy)
+{
+    switch(strategy) {
+    case PresynapticUpdateStrategy::ROW_WISE:
+        return "ROW_WISE";
+    case PresynapticUpdateStrategy::WORD_PACKED_BITMASK:
+        return "WORD_PACKED_BITMASK";
+    case PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR:
+        return "TOEPLITZ_DIAGONAL_MAJOR";
+    case PresynapticUpdateStrategy::TOEPLITZ_SPIKE_MAJOR:
+        return "TOEPLITZ_SPIKE_MAJOR";
+    case PresynapticUpdateStrategy::TOEPLITZ_CONV2D:
+        return "TOEPLITZ_CONV2D";
+    }
+    return "UNKNOWN";
+}
+//--------------------------------------------------------------------------
+//! Get strategies which could be used to generate presynaptic update of merged group
+std::vector<PresynapticUpdateStrategy> getCandidateStrategies(const Backend &backend, const PresynapticUpdateGroupMerged &sg)
+{
+    const auto &archetype = sg.getArchetype();
+    if(archetype.getMatrixType() & SynapseMatrixConnectivity::TOEPLITZ) {
+        std::vector<PresynapticUpdateStrategy> candidates{PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR, PresynapticUpdateStrategy::TOEPLITZ_SPIKE_MAJOR};
+        if(backend.isToeplitzConv2DSupported(sg)) {
+            candidates.push_back(PresynapticUpdateStrategy::TOEPLITZ_CONV2D);
+        }
+        return candidates;
+    }
+    // **NOTE** BITMASK connectivity which isn't initialised on device is empty
+    // during calibration so timing updates of it would be meaningless
+    else if((archetype.getMatrixType() & SynapseMatrixConnectivity::BITMASK)
+            && archetype.isSparseConnectivityInitRequired())
+    {
+        return {PresynapticUpdateStrategy::ROW_WISE, PresynapticUpdateStrategy::WORD_PACKED_BITMASK};
+    }
+    else {
+        return {};
+    }
+}
+//--------------------------------------------------------------------------
+//! Convert manually-selected presynaptic update strategies, indexed by synapse group name, to ones indexed by merged group
+Backend::PresynapticUpdateStrategies getManualStrategies(const ModelSpecInternal &model, const Preferences &preferences)
+{
+    Backend::PresynapticUpdateStrategies strategies;
+    if(preferences.manualPresynapticUpdateStrategies.empty()) {
+        return strategies;
+    }
+
+    // Check all manual strategies refer to synapse groups
+    for(const auto &m : preferences.manualPresynapticUpdateStrategies) {
+        if(model.getSynapseGroups().find(m.first) == model.getSynapseGroups().cend()) {
+            throw std::runtime_error("Presynaptic update strategy selected for unknown synapse group '" + m.first + "'");
+        }
+    }
+
+    // Merge model with default strategies
+    const Backend defaultBackend(preferences);
+    const ModelSpecMerged defaultModelMerged(defaultBackend, model);
+    for(const auto &sg : defaultModelMerged.getMergedPresynapticUpdateGroups()) {
+        for(const auto &g : sg.getGroups()) {
+            const auto manual = preferences.manualPresynapticUpdateStrategies.find(g.get().getName());
+            if(manual == preferences.manualPresynapticUpdateStrategies.cend()) {
+                continue;
+            }
+
+            // Check strategy is either the default or one of the alternatives
+            const auto candidates = getCandidateStrategies(defaultBackend, sg);
+            if(manual->second != defaultBackend.getPresynapticUpdateStrategy(sg)
+               && std::find(candidates.cbegin(), candidates.cend(), manual->second) == candidates.cend())
+            {
+                throw std::runtime_error("Presynaptic update strategy " + std::string{getStrategyName(manual->second)} 
+                                         + " cannot be used for synapse group '" + manual->first + "'");
+            }
+
+            // Check strategy doesn't conflict with one selected for another group within merged group
+            const auto strategy = strategies.emplace(sg.getHashDigest(), manual->second);
+            if(strategy.first->second != manual->second) {
+                throw std::runtime_error("Synapse group '" + manual->first + "' is merged with synapse groups which use a different presynaptic update strategy");
+            }
+            LOGD_BACKEND << "Merged presynaptic update group " << sg.getIndex() << " manually set to use " << getStrategyName(manual->second) << " strategy";
+        }
+    }
+    return strategies;
+}
+//--------------------------------------------------------------------------
+bool hasExtraGlobalParams(const std::map<std::string, InitVarSnippet::Init> &varInitialisers)
+{
+    return std::any_of(varInitialisers.cbegin(), varInitialisers.cend(),
+                       [](const auto &v){ return !v.second.getSnippet()->getExtraGlobalParams().empty(); });
+}
+//--------------------------------------------------------------------------
+//! Does model have any extra global parameters which would need to be set by user before simulation
+bool hasExtraGlobalParams(const ModelSpecInternal &model)
+{
+    for(const auto &n : model.getNeuronGroups()) {
+        if(!n.second.getModel()->getExtraGlobalParams().empty() || hasExtraGlobalParams(n.second.getVarInitialisers())) {
+            return true;
+        }
+    }
+    for(const auto &c : model.getLocalCurrentSources()) {
+        if(!c.second.getModel()->getExtraGlobalParams().empty() || hasExtraGlobalParams(c.second.getVarInitialisers())) {
+            return true;
+        }
+    }
+    for(const auto &s : model.getSynapseGroups()) {
+        const auto &wu = s.second.getWUInitialiser();
+        const auto &ps = s.second.getPSInitialiser();
+        if(!wu.getSnippet()->getExtraGlobalParams().empty() || !ps.getSnippet()->getExtraGlobalParams().empty()
+           || !s.second.getSparseConnectivityInitialiser().getSnippet()->getExtraGlobalParams().empty()
+           || !s.second.getToeplitzConnectivityInitialiser().getSnippet()->getExtraGlobalParams().empty()
+           || hasExtraGlobalParams(wu.getVarInitialisers()) || hasExtraGlobalParams(wu.getPreVarInitialisers())
+           || hasExtraGlobalParams(wu.getPostVarInitialisers()) || hasExtraGlobalParams(ps.getVarInitialisers()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+//--------------------------------------------------------------------------
+Backend::PresynapticUpdateStrategies readCache(const filesystem::path &cachePath)
+{
+    Backend::PresynapticUpdateStrategies cache;
+    std::ifstream is(cachePath.str());
+    while(true) {
+        // Read hash digest as hex, followed by strategy
+        boost::uuids::detail::sha1::digest_type hashDigest;
+        unsigned int strategy;
+        is >> std::hex;
+        for(auto &d : hashDigest) {
+            is >> d;
+        }
+        is >> std::dec >> strategy;
+
+        // Stop at end of file or first malformed entry
+        if(!is || strategy > static_cast<unsigned int>(PresynapticUpdateStrategy::LAST)) {
+            break;
+        }
+        cache.emplace(hashDigest, static_cast<PresynapticUpdateStrategy>(strategy));
+    }
+    return cache;
+}
+//--------------------------------------------------------------------------
+void writeCache(const filesystem::path &cachePath, const Backend::PresynapticUpdateStrategies &cache)
+{
+    std::ofstream os(cachePath.str());
+    for(const auto &c : cache) {
+        // Write digest as hex with each word seperated by a space, followed by strategy
+        os << std::hex;
+        for(const auto d : c.first) {
+            os << d << " ";
+        }
+        os << std::dec << static_cast<unsigned int>(c.second) << std::endl;
+    }
+}
+//--------------------------------------------------------------------------
+//! Remove directory containing calibration code
+void removeCalibration(const filesystem::path &calibrationPath)
+{
+    // **NOTE** the path library used elsewhere can only remove individual files
+    std::error_code error;
+    std::filesystem::remove_all(calibrationPath.str(), error);
+    if(error) {
+        LOGW_BACKEND << "Cannot remove autotuning calibration code from '" << calibrationPath.str() << "': " << error.message();
+    }
+}
+//--------------------------------------------------------------------------
+//! Generate, build and simulate model using presynaptic update strategies, returning 
+//! the shortest wall-clock time taken to simulate autoTuneTimesteps over autoTuneRepeats repeats
+double timeCalibration(const ModelSpecInternal &model, const filesystem::path &calibrationPath,
+                       const Preferences &preferences, const Backend::PresynapticUpdateStrategies &strategies)
+{
+    // Create backend and merge model
+    const Backend backend(preferences, strategies);
+    ModelSpecMerged modelMerged(backend, model);
+
+    // Generate code
+    // **NOTE** this backend doesn't copy any files from share path
+    filesystem::create_directory(calibrationPath);
+    const auto codePath = calibrationPath / (model.getName() + "_CODE");
+    const auto moduleNames = generateAll(modelMerged, backend, filesystem::path(), codePath, true);
+    {
+        std::ofstream makefile((codePath / "Makefile").str());
+        generateMakefile(makefile, backend, moduleNames);
+    }
+
+    // Build using make, using as many threads as possible
+    const unsigned int numThreads = std::thread::hardware_concurrency();
+    const std::string buildCommand = "make -s -C \"" + codePath.str() + "\" -j " + std::to_string(numThreads);
+    const int retval = system(buildCommand.c_str());
+    if (retval != 0) {
+        throw std::runtime_error("Building autotuning calibration code with call:'" + buildCommand + "' failed with return value:" + std::to_string(retval));
+    }
+
+    // Load and initialise model, with enough recording 
+    // buffer space for the timesteps simulated in all repeats
+    const unsigned int numRepeats = std::max(1u, preferences.autoTuneRepeats);
+    Runtime::Runtime runtime(calibrationPath, modelMerged, backend);
+    runtime.allocate(preferences.autoTuneTimesteps * numRepeats);
+    runtime.initialize();
+    runtime.initializeSparse();
+
+    // Time consecutive blocks of simulation, keeping the fastest as it is least affected by noise
+    double bestTime = std::numeric_limits<double>::max();
+    for(unsigned int r = 0; r < numRepeats; r++) {
+        const auto start = std::chrono::steady_clock::now();
+        for(unsigned int t = 0; t < preferences.autoTuneTimesteps; t++) {
+            runtime.stepTime();
+        }
+        bestTime = std::min(bestTime, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return bestTime;
+}
+//--------------------------------------------------------------------------
+Backend::PresynapticUpdateStrategies autoTune(const ModelSpecInternal &model, const filesystem::path &outputPath,
+                                              const Preferences &preferences, const Backend::PresynapticUpdateStrategies &manualStrategies)
+{
+    // Merge model with default strategies and find merged presynaptic update 
+    // groups with alternatives, whose strategy hasn't been selected manually
+    const Backend defaultBackend(preferences);
+    const ModelSpecMerged defaultModelMerged(defaultBackend, model);
+    std::vector<TunableGroup> tunableGroups;
+    Backend::PresynapticUpdateStrategies strategies = manualStrategies;
+    for(const auto &sg : defaultModelMerged.getMergedPresynapticUpdateGroups()) {
+        auto candidates = getCandidateStrategies(defaultBackend, sg);
+        if(!candidates.empty() && manualStrategies.find(sg.getHashDigest()) == manualStrategies.cend()) {
+            // Move default strategy to front so it is the starting point for calibration
+            const auto defaultStrategy = defaultBackend.getPresynapticUpdateStrategy(sg);
+            std::iter_swap(candidates.begin(), std::find(candidates.begin(), candidates.end(), defaultStrategy));
+
+            tunableGroups.push_back({sg.getIndex(), sg.getHashDigest(), candidates});
+            strategies.emplace(sg.getHashDigest(), defaultStrategy);
+        }
+    }
+
+    if(tunableGroups.empty()) {
+        LOGD_BACKEND << "No merged presynaptic update groups to autotune";
+        return strategies;
+    }
+
+    // Use cached strategies for any groups which have previously been tuned
+    filesystem::create_directory(outputPath);
+    const auto cachePath = outputPath / "autoTune.sha";
+    auto cache = readCache(cachePath);
+    std::vector<TunableGroup> uncachedGroups;
+    for(const auto &t : tunableGroups) {
+        const auto c = cache.find(t.hashDigest);
+        if(c != cache.cend() && std::find(t.candidates.cbegin(), t.candidates.cend(), c->second) != t.candidates.cend()) {
+            LOGD_BACKEND << "Merged presynaptic update group " << t.index << " unchanged - re-using " << getStrategyName(c->second) << " strategy";
+            strategies[t.hashDigest] = c->second;
+        }
+        else {
+            uncachedGroups.push_back(t);
+        }
+    }
+
+    if(uncachedGroups.empty()) {
+        return strategies;
+    }
+
+    // **NOTE** calibration runs can't set extra global parameters so would read unallocated memory
+    if(hasExtraGlobalParams(model)) {
+        LOGW_BACKEND << "Unable to autotune models with extra global parameters - using default presynaptic update strategies";
+        return strategies;
+    }
+
+#ifdef _WIN32
+    LOGW_BACKEND << "Autotuning is not currently supported on Windows - using default presynaptic update strategies";
+    return strategies;
+#else
+    // Create directory for calibration code
+    // **NOTE** if building or simulating any calibration fails, it is removed before rethrowing
+    const auto autoTunePath = outputPath / "autotune";
+    filesystem::create_directory(autoTunePath);
+    unsigned int numCalibrations = 0;
+    try {
+        // Time calibration run with default strategies
+        double bestTime = timeCalibration(model, autoTunePath / std::to_string(numCalibrations++), preferences, strategies);
+        LOGD_BACKEND << "Default strategies: " << bestTime << "s";
+
+        // Loop through groups, timing each of their alternative strategies in turn and keeping the fastest
+        // **NOTE** with strategies of groups already tuned fixed at their fastest, this is a greedy coordinate search
+        for(const auto &t : uncachedGroups) {
+            LOGD_BACKEND << "Merged presynaptic update group " << t.index << ":";
+            for(auto c = t.candidates.cbegin() + 1; c != t.candidates.cend(); c++) {
+                auto trialStrategies = strategies;
+                trialStrategies[t.hashDigest] = *c;
+                const double time = timeCalibration(model, autoTunePath / std::to_string(numCalibrations++), preferences, trialStrategies);
+                LOGD_BACKEND << "\t" << getStrategyName(*c) << ": " << time << "s";
+                if(time < bestTime) {
+                    bestTime = time;
+                    strategies = trialStrategies;
+                }
+            }
+
+            // Cache strategy
+            const auto strategy = strategies.at(t.hashDigest);
+            LOGI_BACKEND << "Merged presynaptic update group " << t.index << " using " << getStrategyName(strategy) << " strategy";
+            cache[t.hashDigest] = strategy;
+        }
+    }
+    catch(...) {
+        removeCalibration(autoTunePath);
+        throw;
+    }
+
+    writeCache(cachePath, cache);
+
+    // Remove calibration code
+    removeCalibration(autoTunePath);
+    return strategies;
+#endif
+}
+}   // Anonymous namespace
+
 //--------------------------------------------------------------------------
 // GeNN::CodeGenerator::SingleThreadedCPU::Optimiser
 //--------------------------------------------------------------------------
 namespace GeNN::CodeGenerator::SingleThreadedCPU::Optimiser
 {
-Backend createBackend(const ModelSpecInternal&,const filesystem::path&,
-                      plog::Severity backendLevel, plog::IAppender *backendAppender, 
+Backend createBackend(const ModelSpecInternal &model, const filesystem::path &outputPath,
+                      plog::Severity backendLevel, plog::IAppender *backendAppender,
                       const Preferences &preferences)
 {
     // If there isn't already a plog instance, initialise one
@@ -18,6 +372,19 @@ Backend createBackend(const ModelSpecInternal&,const filesystem::path&,
         plog::get<Logging::CHANNEL_BACKEND>()->setMaxSeverity(backendLevel);
     }
 
-    return Backend(preferences);
+    // Create backend with any manually-selected presynaptic update strategies and, if autotuning is enabled, tune the others
+    const auto manualStrategies = getManualStrategies(model, preferences);
+    if(preferences.autoTune) {
+        return Backend(preferences, autoTune(model, outputPath, preferences, manualStrategies));
+    }
+    else {
+        return Backend(preferences, manualStrategies);
+    }
+}
+//--------------------------------------------------------------------------
+bool isMatrixTypeSupported(SynapseMatrixType type)
+{
+    // Procedural connectivity is only implemented on SIMT backends
+    return !(type & SynapseMatrixConnectivity::PROCEDURAL);
 }
 }   // namespace GeNN::CodeGenerator::SingleThreadedCPU::Optimiser
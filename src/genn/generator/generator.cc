@@ -62,7 +62,7 @@ int main(int argc,     //!< number of arguments; expected to be 3
         modelDefinition(static_cast<ModelSpec&>(std::ref(model)));
 
         // Finalize model
-        model.finalise();
+        model.finalise(Optimiser::isMatrixTypeSupported);
 
         // Determine code generation path
         const filesystem::path outputPath = targetPath / (model.getName() + "_CODE");
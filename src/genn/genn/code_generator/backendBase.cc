@@ -37,6 +37,32 @@ void buildCustomUpdateSizeEnvironment(EnvironmentGroupMergedField<G> &env)
     env.add(Type::Uint32.addConst(), "_size", "$(num_neurons)");
 }
 //--------------------------------------------------------------------------
+template<typename G, typename S>
+void addRowStrideField(const BackendBase &backend, EnvironmentGroupMergedField<G> &env, 
+                       const Type::ResolvedType &type, S getSynapseGroupFn)
+{
+    // If row capacity of synapse group is growable, add dynamic field which is updated whenever rows are reallocated
+    // **NOTE** growability is included in hash digests so archetype is representative
+    if(getSynapseGroupFn(env.getGroup().getArchetype()).isRowCapacityGrowable()) {
+        env.addField(type, "_row_stride", Type::Uint32, "rowStride", 
+                     [getSynapseGroupFn](auto &runtime, const auto &g, size_t)
+                     {
+                         const auto &sg = getSynapseGroupFn(g);
+                         return std::make_pair(Type::NumericValue((uint64_t)runtime.getSynapticMatrixRowStride(sg)), 
+                                               std::ref(runtime.getMergedParamDestinations(sg, "rowStride")));
+                     },
+                     "", GroupMergedFieldType::DYNAMIC);
+    }
+    // Otherwise, add standard field
+    else {
+        env.addField(type, "_row_stride", Type::Uint32, "rowStride", 
+                     [&backend, getSynapseGroupFn](const auto &g, size_t) -> uint64_t
+                     {
+                         return backend.getSynapticMatrixRowStride(getSynapseGroupFn(g));
+                     });
+    }
+}
+//--------------------------------------------------------------------------
 template<typename G>
 void buildCustomUpdateWUSizeEnvironment(const BackendBase &backend, EnvironmentGroupMergedField<G> &env)
 {
@@ -47,12 +73,8 @@ void buildCustomUpdateWUSizeEnvironment(const BackendBase &backend, EnvironmentG
     env.addField(Type::Uint32.addConst(), "num_post",
                  Type::Uint32, "numTrgNeurons", 
                  [](const auto  &cg, size_t) { return cg.getSynapseGroup()->getTrgNeuronGroup()->getNumNeurons(); });
-    env.addField(Type::Uint32.addConst(), "_row_stride", 
-                 Type::Uint32, "rowStride", 
-                 [&backend](const auto &cg, size_t) -> uint64_t
-                 {
-                     return backend.getSynapticMatrixRowStride(*cg.getSynapseGroup());
-                 });
+    addRowStrideField(backend, env, Type::Uint32.addConst(),
+                      [](const auto &cg) -> const SynapseGroupInternal& { return *cg.getSynapseGroup(); });
 
     // If underlying synapse group has kernel connectivity
     const auto *sg = env.getGroup().getArchetype().getSynapseGroup();
@@ -88,9 +110,9 @@ void buildCustomUpdateWUSizeEnvironment(const BackendBase &backend, EnvironmentG
         // Connectivity fields
         if(sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
             env.addField(Type::Uint32.createPointer(), "_row_length", "rowLength",
-                         [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "rowLength"); });
+                         [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(cg.getSynapseGroup()->getFusedConnectivityTarget(), "rowLength"); });
             env.addField(sg->getSparseIndType().createPointer(), "_ind", "ind",
-                         [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "ind"); });
+                         [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(cg.getSynapseGroup()->getFusedConnectivityTarget(), "ind"); });
         }
 
         const auto indexType = backend.getSynapseIndexType(env.getGroup());
@@ -113,6 +135,12 @@ void buildStandardNeuronEnvironment(EnvironmentGroupMergedField<G> &env, unsigne
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "spkQuePtr"); });
     env.addField(Uint32.createPointer(), "_record_spk", "recordSpk",
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "recordSpk"); });
+    env.addField(Uint32.createPointer(), "_record_spk_cnt", "recordSpkCnt",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "recordSpkCnt"); });
+    env.addField(env.getGroup().getScalarType().createPointer(), "_spk_rate", "spkRate",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "spkRate"); });
+    env.addField(Uint32.createPointer(), "_isi_hist", "isiHist",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "isiHist"); });
     env.addField(env.getGroup().getTimeType().createPointer(), "_st", "sT",
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "sT"); });
     env.addField(env.getGroup().getTimeType().createPointer(), "_prev_st", "prevST", 
@@ -174,12 +202,8 @@ void buildStandardSynapseEnvironment(const BackendBase &backend, EnvironmentGrou
     env.addField(Uint32.addConst(), "num_post",
                  Uint32, "numTrgNeurons", 
                  [](const SynapseGroupInternal &sg, size_t) { return sg.getTrgNeuronGroup()->getNumNeurons(); });
-    env.addField(Uint32.addConst(), "_row_stride", 
-                 Type::Uint32, "rowStride", 
-                 [&backend](const SynapseGroupInternal &sg, size_t) -> uint64_t
-                 {
-                     return backend.getSynapticMatrixRowStride(sg);
-                 });
+    addRowStrideField(backend, env, Uint32.addConst(),
+                      [](const SynapseGroupInternal &sg) -> const SynapseGroupInternal& { return sg; });
     env.addField(Uint32.addConst(), "_col_stride", 
                  Type::Uint32, "colStride", 
                  [](const SynapseGroupInternal &sg, size_t) { return sg.getMaxSourceConnections(); });
@@ -191,7 +215,15 @@ void buildStandardSynapseEnvironment(const BackendBase &backend, EnvironmentGrou
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelay"); });
     env.addField(Uint32.createPointer(), "_den_delay_ptr", "denDelayPtr",
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelayPtr"); });
-                       
+    env.addField(Uint32.createPointer(), "_den_delay_wheel_count", "denDelayWheelCount",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelayWheelCount"); });
+    env.addField(Uint32.createPointer(), "_den_delay_wheel_target", "denDelayWheelTarget",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelayWheelTarget"); });
+    env.addField(env.getGroup().getScalarType().createPointer(), "_den_delay_wheel_weight", "denDelayWheelWeight",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelayWheelWeight"); });
+    env.addField(Uint32.createPointer(), "_den_delay_wheel_overflow", "denDelayWheelOverflow",
+                 [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPSTarget(), "denDelayWheelOverflow"); });
+
     // Presynaptic output fields
     env.addField(env.getGroup().getScalarType().createPointer(), "_out_pre", "outPre",
                  [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g.getFusedPreOutputTarget(), "outPre"); });
@@ -243,13 +275,15 @@ void buildStandardSynapseEnvironment(const BackendBase &backend, EnvironmentGrou
     }
     else if(env.getGroup().getArchetype().getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         env.addField(Uint32.createPointer(), "_row_length", "rowLength",
-                     [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg, "rowLength"); });
+                     [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg.getFusedConnectivityTarget(), "rowLength"); });
         env.addField(env.getGroup().getArchetype().getSparseIndType().createPointer(), "_ind", "ind",
-                     [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg, "ind"); });
+                     [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg.getFusedConnectivityTarget(), "ind"); });
         env.addField(Uint32.createPointer(), "_col_length", "colLength", 
                      [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg, "colLength"); });
         env.addField(Uint32.createPointer(), "_remap", "remap", 
                      [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg, "remap"); });
+        env.addField(Uint32.createPointer(), "_remap_valid", "remapValid", 
+                     [](const auto &runtime, const auto &sg, size_t) { return runtime.getArray(sg, "remapValid"); });
     }
     else if(env.getGroup().getArchetype().getMatrixType() & SynapseMatrixWeight::KERNEL) {
         // **TODO** automatic heterogeneity detection on all fields would make this much nicer
@@ -463,8 +497,8 @@ void buildStandardCustomConnectivityUpdateEnvironment(const BackendBase &backend
                      const SynapseGroupInternal *sgInternal = static_cast<const SynapseGroupInternal*>(cg.getSynapseGroup());
                      return sgInternal->getTrgNeuronGroup()->getNumNeurons();
                  });
-    env.addField(Type::Uint32, "_row_stride", "rowStride", 
-                 [&backend](const auto &cg, size_t) -> uint64_t { return backend.getSynapticMatrixRowStride(*cg.getSynapseGroup()); });
+    addRowStrideField(backend, env, Type::Uint32,
+                      [](const auto &cg) -> const SynapseGroupInternal& { return *cg.getSynapseGroup(); });
     env.addField(Type::Uint32, "_col_stride", "colStride", 
                  [](const auto &cg, size_t) { return cg.getSynapseGroup()->getMaxSourceConnections(); });
     
@@ -472,13 +506,21 @@ void buildStandardCustomConnectivityUpdateEnvironment(const BackendBase &backend
     auto *sg = env.getGroup().getArchetype().getSynapseGroup();
     if(sg->getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
         env.addField(Type::Uint32.createPointer(), "_row_length", "rowLength",
-                     [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "rowLength"); });
+                     [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(cg.getSynapseGroup()->getFusedConnectivityTarget(), "rowLength"); });
         env.addField(sg->getSparseIndType().createPointer(), "_ind", "ind",
-                     [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "ind"); });
+                     [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(cg.getSynapseGroup()->getFusedConnectivityTarget(), "ind"); });
         env.addField(Type::Uint32.createPointer(), "_col_length", "colLength", 
                      [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "colLength"); });
         env.addField(Type::Uint32.createPointer(), "_remap", "remap", 
                      [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "remap"); });
+        env.addField(Type::Uint32.createPointer(), "_remap_valid", "remapValid", 
+                     [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "remapValid"); });
+
+        // If row capacity is growable, add field to count synapses which couldn't be added to full rows
+        if(sg->isRowCapacityGrowable()) {
+            env.addField(Type::Uint32.createPointer(), "_row_overflow", "rowOverflow", 
+                         [](const auto &runtime, const auto &cg, size_t) { return runtime.getArray(*cg.getSynapseGroup(), "rowOverflow"); });
+        }
     }
 
     // If there are delays on presynaptic variable references
@@ -508,8 +550,10 @@ Type::ResolvedType getSynapseIndexType(const BackendBase &backend, const GroupMe
     if(std::any_of(m.getGroups().cbegin(), m.getGroups().cend(),
                    [getSynapseGroupFn, &backend](const auto &g)
                    {
+                       // **NOTE** if row capacity is growable, rows can grow to the size of the target population
                        const auto &sg = getSynapseGroupFn(g.get());
-                       const size_t numSynapses = (size_t)sg.getSrcNeuronGroup()->getNumNeurons() * backend.getSynapticMatrixRowStride(sg);
+                       const size_t maxRowStride = sg.isRowCapacityGrowable() ? sg.getTrgNeuronGroup()->getNumNeurons() : backend.getSynapticMatrixRowStride(sg);
+                       const size_t numSynapses = (size_t)sg.getSrcNeuronGroup()->getNumNeurons() * maxRowStride;
                        return (numSynapses > std::numeric_limits<uint32_t>::max());
                    }))
     {
@@ -1072,6 +1072,7 @@ void BackendCUDAHIP::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerge
     os << std::endl;
     os << "// Standard C includes" << std::endl;
     //os << "#include <cassert>" << std::endl;
+    os << "#include <cmath>" << std::endl;
     os << "#include <cstdint>" << std::endl;
 
     genDefinitionsPreambleInternal(os, modelMerged);
@@ -1083,6 +1084,9 @@ void BackendCUDAHIP::genDefinitionsPreamble(CodeStream &os, const ModelSpecMerge
     os << "#include <cassert>" << std::endl;
     os << std::endl;
 
+    // Generate definitions of samplers used by host RNG functions
+    StandardLibrary::genHostRNGFunctions(os);
+
     os << "struct XORWowStateInternal" << std::endl;
     {
         CodeStream::Scope b(os);
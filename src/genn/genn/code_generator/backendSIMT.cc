@@ -434,6 +434,37 @@ void BackendSIMT::genNeuronUpdateKernel(EnvironmentExternalBase &env, ModelSpecM
         genRecordingSharedMemInit(env.getStream(), "", 1);
     }
 
+    if(modelMerged.getModel().isApproximateMathsEnabled()) {
+        throw std::runtime_error("Approximate maths functions are not supported by SIMT backends");
+    }
+
+    // Activity probes are only supported by the CPU backend
+    for(const auto &n : modelMerged.getModel().getNeuronGroups()) {
+        if(n.second.isSpikeCountRecordingEnabled() || n.second.isSpikeRateEstimationEnabled() 
+           || n.second.isISIHistogramEnabled()) 
+        {
+            throw std::runtime_error("Neuron group '" + n.first + "' uses activity probes which are not supported by SIMT backends");
+        }
+
+        if(!n.second.getVarTraces().empty()) {
+            throw std::runtime_error("Neuron group '" + n.first + "' uses variable trace recording which is not supported by SIMT backends");
+        }
+
+        if(n.second.isApproximateMathsEnabled()) {
+            throw std::runtime_error("Neuron group '" + n.first + "' uses approximate maths functions which are not supported by SIMT backends");
+        }
+    }
+    for(const auto &c : modelMerged.getModel().getLocalCurrentSources()) {
+        if(!c.second.getVarTraces().empty()) {
+            throw std::runtime_error("Current source '" + c.first + "' uses variable trace recording which is not supported by SIMT backends");
+        }
+    }
+    for(const auto &s : modelMerged.getModel().getSynapseGroups()) {
+        if(!s.second.getPSVarTraces().empty()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' uses variable trace recording which is not supported by SIMT backends");
+        }
+    }
+
     // If there are any neuron update groups
     if(!modelMerged.getMergedNeuronUpdateGroups().empty()) {
         // Loop through merged neuron update groups
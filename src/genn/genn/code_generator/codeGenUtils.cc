@@ -1,8 +1,5 @@
 #include "code_generator/codeGenUtils.h"
 
-// Standard C++ library
-#include <regex>
-
 // Standard C includes
 #include <cstring>
 
@@ -12,6 +9,7 @@
 // GeNN code generator includes
 #include "code_generator/environment.h"
 #include "code_generator/groupMerged.h"
+#include "code_generator/substitutionTemplate.h"
 
 // GeNN transpiler includes
 #include "transpiler/errorHandler.h"
@@ -23,6 +21,23 @@
 //----------------------------------------------------------------------------
 namespace GeNN::CodeGenerator
 {
+std::tuple<uint32_t, uint32_t, uint32_t> getFastDivide(uint32_t divisor)
+{
+    // **NOTE** groups with a row stride of zero have no synapses so nothing is ever divided by it
+    if(divisor == 0) {
+        return std::make_tuple(0, 0, 0);
+    }
+
+    // Calculate ceil(log2(divisor))
+    uint32_t l = 0;
+    while((l < 32) && ((uint64_t{1} << l) < divisor)) {
+        l++;
+    }
+
+    const uint32_t mul = static_cast<uint32_t>(((uint64_t{1} << 32) * ((uint64_t{1} << l) - divisor)) / divisor) + 1;
+    return std::make_tuple(mul, std::min(l, 1u), (l > 0) ? (l - 1) : 0);
+}
+//--------------------------------------------------------------------------
 void genTypeRange(CodeStream &os, const Type::ResolvedType &type, const std::string &prefix)
 {
     const auto &numeric = type.getNumeric();
@@ -104,39 +119,32 @@ void prettyPrintStatements(const std::vector<Transpiler::Token> &tokens, const T
 //--------------------------------------------------------------------------
 std::string printSubs(const std::string &format, Transpiler::PrettyPrinter::EnvironmentBase &env)
 {
-    // Create regex iterator to iterate over $(XXX) style varibles in format string
+    // Find first $(XXX) style variable in format string
     // **NOTE** this doesn't match function argument $(0)
-    std::regex regex("\\$\\(([a-zA-Z_][\\w]*)\\)");
-    std::sregex_iterator matchesBegin(format.cbegin(), format.cend(), regex);
-    std::sregex_iterator matchesEnd;
-    
+    size_t nameBegin;
+    size_t nameEnd;
+    size_t pos = SubstitutionTemplate::findNext(format, 0, nameBegin, nameEnd);
+
     // If there are no matches, leave format unmodified and return
-    if(matchesBegin == matchesEnd) {
+    if(pos == std::string::npos) {
         return format;
     }
     // Otherwise
     else {
-        // Loop through matches to build lazy string payload
+        // Loop through matches, copying preceding literal text and 
+        // environment value of $(XXX) to output
         std::string output;
-        for(std::sregex_iterator m = matchesBegin;;) {
-            // Copy the non-matched subsequence (m->prefix()) onto output
-            std::copy(m->prefix().first, m->prefix().second, std::back_inserter(output));
-
-            // Add environment value of $(XXX) to output
-            output += env[(*m)[1]];
-    
-            // If there are no subsequent matches, add the remaining 
-            // non-matched characters onto output and return
-            if(std::next(m) == matchesEnd) {
-                 // Copy the non-matched subsequence (m->prefix()) onto output
-                 std::copy(m->suffix().first, m->suffix().second, std::back_inserter(output));
-                 return output;
-            }
-            // Otherwise go onto next match
-            else {
-                m++;
-            }
-        }
+        size_t literalBegin = 0;
+        do {
+            output.append(format, literalBegin, pos - literalBegin);
+            output += env[format.substr(nameBegin, nameEnd - nameBegin)];
+            literalBegin = nameEnd + 1;
+            pos = SubstitutionTemplate::findNext(format, literalBegin, nameBegin, nameEnd);
+        } while(pos != std::string::npos);
+
+        // Add the remaining non-matched characters onto output
+        output.append(format, literalBegin);
+        return output;
     }
 }
 }   // namespace GeNN::CodeGenerator
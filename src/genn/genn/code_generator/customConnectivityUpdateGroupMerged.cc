@@ -164,20 +164,52 @@ void CustomConnectivityUpdateGroupMerged::generateUpdate(const BackendBase &back
     std::vector<Type::ResolvedType> addSynapseTypes{Type::Uint32};
     addSynapseTypes.reserve(1 + ccuVars.size() + ccuVarRefs.size());
 
+    // If backend updates postsynaptic remap incrementally, synapse group has growable row capacity and postsynaptic 
+    // learning, synapses need adding to and removing from columns of remap (if it's been built)
+    const auto *sg = getArchetype().getSynapseGroup();
+    const bool incrementalRemap = (backend.isPostsynapticRemapIncremental() && sg->isRowCapacityGrowable()
+                                   && (sg->isPostSpikeRequired() || sg->isPostSpikeEventRequired()));
+
     // Generate code to add a synapse to this row
     std::stringstream addSynapseStream;
     CodeStream addSynapse(addSynapseStream);
+
+    // If row capacity is growable, the runtime chooses the row stride so, if row is full, 
+    // drop synapse and count it so Runtime::customUpdate can report the overflow
+    if(sg->isRowCapacityGrowable()) {
+        addSynapse << "if($(_row_length)[$(id_pre)] >= $(_row_stride))";
+        {
+            CodeStream::Scope b(addSynapse);
+            addSynapse << "$(_row_overflow)[0]++;" << std::endl;
+        }
+        addSynapse << "else";
+    }
+
+    // **NOTE** if row capacity is growable, this scope forms the else branch of the overflow check
     {
         CodeStream::Scope b(addSynapse);
 
-        // Assert that there is space to add synapse
-        backend.genAssert(addSynapse, "$(_row_length)[$(id_pre)] < $(_row_stride)");
+        // Otherwise, row stride is the maximum connections specified by the user so assert that there is space to add synapse
+        if(!sg->isRowCapacityGrowable()) {
+            backend.genAssert(addSynapse, "$(_row_length)[$(id_pre)] < $(_row_stride)");
+        }
 
         // Calculate index to insert synapse
         addSynapse << "const unsigned newIdx = $(_row_start_idx) + $(_row_length)[$(id_pre)];" << std::endl;
 
         // Set postsynaptic target to parameter 0
         addSynapse << "$(_ind)[newIdx] = $(0);" << std::endl;
+
+        // Add new synapse to end of postsynaptic target's column of remap
+        if(incrementalRemap) {
+            addSynapse << "if(*$(_remap_valid))";
+            {
+                CodeStream::Scope b(addSynapse);
+                addSynapse << "const unsigned int postIdx = $(_ind)[newIdx];" << std::endl;
+                backend.genAssert(addSynapse, "$(_col_length)[postIdx] < $(_col_stride)");
+                addSynapse << "$(_remap)[(postIdx * $(_col_stride)) + $(_col_length)[postIdx]++] = newIdx;" << std::endl;
+            }
+        }
  
         // Use subsequent parameters to initialise new synapse's custom connectivity update model variables
         for (size_t i = 0; i < ccuVars.size(); i++) {
@@ -240,6 +272,28 @@ void CustomConnectivityUpdateGroupMerged::generateUpdate(const BackendBase &back
         // Calculate index we want to copy synapse from
         removeSynapse << "const unsigned lastIdx = $(_row_start_idx) + $(_row_length)[$(id_pre)] - 1;" << std::endl;
 
+        // Update columns of remap affected by removing synapse
+        if(incrementalRemap) {
+            removeSynapse << "if(*$(_remap_valid))";
+            {
+                CodeStream::Scope b(removeSynapse);
+
+                // Replace synapse in its column with last synapse in column
+                removeSynapse << "unsigned int *removedCol = &$(_remap)[$(_ind)[$(id_syn)] * $(_col_stride)];" << std::endl;
+                removeSynapse << "unsigned int &removedColLength = $(_col_length)[$(_ind)[$(id_syn)]];" << std::endl;
+                removeSynapse << "*std::find(removedCol, removedCol + removedColLength, $(id_syn)) = removedCol[removedColLength - 1];" << std::endl;
+                removeSynapse << "removedColLength--;" << std::endl;
+
+                // If synapse from end of row is going to be moved, update its entry in its column
+                removeSynapse << "if(lastIdx != $(id_syn))";
+                {
+                    CodeStream::Scope b(removeSynapse);
+                    removeSynapse << "unsigned int *movedCol = &$(_remap)[$(_ind)[lastIdx] * $(_col_stride)];" << std::endl;
+                    removeSynapse << "*std::find(movedCol, movedCol + $(_col_length)[$(_ind)[lastIdx]], lastIdx) = $(id_syn);" << std::endl;
+                }
+            }
+        }
+
         // Copy postsynaptic target from end of row over synapse to be deleted
         removeSynapse << "$(_ind)[$(id_syn)] = $(_ind)[lastIdx];" << std::endl;
 
@@ -256,9 +310,9 @@ void CustomConnectivityUpdateGroupMerged::generateUpdate(const BackendBase &back
                 // Loop through all batches and copy custom connectivity update variable references from end of row over synapse to be deleted
                 removeSynapse << "for(int b = 0; b < " << batchSize << "; b++)";
                 {
-                    CodeStream::Scope b(addSynapse);
+                    CodeStream::Scope b(removeSynapse);
                     removeSynapse << "$(_" << ccuVarRefs[i].name << ")[(b * $(_syn_stride)) + $(id_syn)] = ";
-                    removeSynapse << "$(_" << ccuVarRefs[i].name << ")[(b * $(_syn_stride)) + $(id_syn)];" << std::endl;
+                    removeSynapse << "$(_" << ccuVarRefs[i].name << ")[(b * $(_syn_stride)) + lastIdx];" << std::endl;
                 }
             }
             // Otherwise, copy custom connectivity update variable references from end of row over synapse to be deleted
@@ -395,13 +449,27 @@ void CustomConnectivityHostUpdateGroupMerged::generateUpdate(const BackendBase &
                               return sgInternal->getSrcNeuronGroup()->getNumNeurons();
                           });
 
-        // Expose row stride        
-        groupEnv.addField(Type::Uint32.addConst(), "row_stride",
-                          Type::Uint32, "rowStride", 
-                          [&backend](const auto &cg, size_t) -> uint64_t 
-                          {
-                              return backend.getSynapticMatrixRowStride(*cg.getSynapseGroup()); 
-                          });
+        // Expose row stride
+        // **NOTE** if row capacity is growable, this is updated whenever rows are reallocated
+        if(getArchetype().getSynapseGroup()->isRowCapacityGrowable()) {
+            groupEnv.addField(Type::Uint32.addConst(), "row_stride",
+                              Type::Uint32, "rowStride", 
+                              [](auto &runtime, const auto &cg, size_t)
+                              {
+                                  const auto &sg = *cg.getSynapseGroup();
+                                  return std::make_pair(Type::NumericValue((uint64_t)runtime.getSynapticMatrixRowStride(sg)), 
+                                                        std::ref(runtime.getMergedParamDestinations(sg, "rowStride")));
+                              },
+                              "", GroupMergedFieldType::DYNAMIC);
+        }
+        else {
+            groupEnv.addField(Type::Uint32.addConst(), "row_stride",
+                              Type::Uint32, "rowStride", 
+                              [&backend](const auto &cg, size_t) -> uint64_t 
+                              {
+                                  return backend.getSynapticMatrixRowStride(*cg.getSynapseGroup()); 
+                              });
+        }
 
         // If synapse group connectivity is accessible from the host
         // **TODO** variable locations probably need hashing in host update group hash
@@ -274,7 +274,7 @@ void generateInit(std::ostream &stream, ModelSpecMerged &modelMerged, const Back
             // Generate stream with neuron update code
             std::ostringstream initStream;
             CodeStream init(initStream);
-            init << "void initializeHost()";
+            init << "void initializeHost(" << (backend.isInstanceContextEnabled() ? "GeNNContext *context" : "") << ")";
             {
                 CodeStream::Scope b(init);
                 modelMerged.genMergedSynapseConnectivityHostInitGroups(
@@ -7,6 +7,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // GeNN includes
 #include "gennUtils.h"
@@ -85,6 +86,13 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
     CodeStream runnerStepTimeFinalise(runnerStepTimeFinaliseStream);
     CodeStream definitionsVar(definitionsVarStream);
     CodeStream definitionsFunc(definitionsFuncStream);
+
+    // If instance context is enabled, create additional codestream to
+    // generate members of context structure rather than global variables
+    const bool instanceContext = backend.isInstanceContextEnabled();
+    std::stringstream contextVarStream;
+    CodeStream contextVar(contextVarStream);
+    std::vector<std::string> contextVarNames;
     
     // Create a teestream to allow simultaneous writing to all streams
     TeeStream allVarStreams(definitionsVar, runnerVarDecl, runnerVarAlloc, runnerVarFree);
@@ -104,19 +112,30 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
     
     // If backend required a global host RNG to simulate (or initialize) this model, generate a standard Mersenne Twister
     if(backend.isGlobalHostRNGRequired(model)) {
-        // Define standard RNG
-        definitionsVar << "extern " << "std::mt19937 hostRNG;" << std::endl;
-        runnerVarDecl << "std::mt19937 hostRNG;" << std::endl;
-
-        // Define standard host distributions as recreating them each call is slow
-        definitionsVar << "extern " << "std::uniform_real_distribution<" << model.getPrecision().getName() << "> standardUniformDistribution;" << std::endl;
-        definitionsVar << "extern " << "std::normal_distribution<" << model.getPrecision().getName() << "> standardNormalDistribution;" << std::endl;
-        definitionsVar << "extern " << "std::exponential_distribution<" << model.getPrecision().getName() << "> standardExponentialDistribution;" << std::endl;
-        definitionsVar << std::endl;
-        runnerVarDecl << "std::uniform_real_distribution<" << model.getPrecision().getName() << "> standardUniformDistribution(" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
-        runnerVarDecl << "std::normal_distribution<" << model.getPrecision().getName() << "> standardNormalDistribution(" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
-        runnerVarDecl << "std::exponential_distribution<" << model.getPrecision().getName() << "> standardExponentialDistribution(" << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
-        runnerVarDecl << std::endl;
+        // If instance context is enabled, add RNG and standard host distributions to context
+        if(instanceContext) {
+            contextVar << "std::mt19937 hostRNG;" << std::endl;
+            contextVar << "std::uniform_real_distribution<" << model.getPrecision().getName() << "> standardUniformDistribution{" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << "};" << std::endl;
+            contextVar << "std::normal_distribution<" << model.getPrecision().getName() << "> standardNormalDistribution{" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << "};" << std::endl;
+            contextVar << "std::exponential_distribution<" << model.getPrecision().getName() << "> standardExponentialDistribution{" << Type::writeNumeric(1.0, model.getPrecision()) << "};" << std::endl;
+            contextVarNames.insert(contextVarNames.end(), {"hostRNG", "standardUniformDistribution", 
+                                                           "standardNormalDistribution", "standardExponentialDistribution"});
+        }
+        else {
+            // Define standard RNG
+            definitionsVar << "extern " << "std::mt19937 hostRNG;" << std::endl;
+            runnerVarDecl << "std::mt19937 hostRNG;" << std::endl;
+
+            // Define standard host distributions as recreating them each call is slow
+            definitionsVar << "extern " << "std::uniform_real_distribution<" << model.getPrecision().getName() << "> standardUniformDistribution;" << std::endl;
+            definitionsVar << "extern " << "std::normal_distribution<" << model.getPrecision().getName() << "> standardNormalDistribution;" << std::endl;
+            definitionsVar << "extern " << "std::exponential_distribution<" << model.getPrecision().getName() << "> standardExponentialDistribution;" << std::endl;
+            definitionsVar << std::endl;
+            runnerVarDecl << "std::uniform_real_distribution<" << model.getPrecision().getName() << "> standardUniformDistribution(" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
+            runnerVarDecl << "std::normal_distribution<" << model.getPrecision().getName() << "> standardNormalDistribution(" << Type::writeNumeric(0.0, model.getPrecision()) << ", " << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
+            runnerVarDecl << "std::exponential_distribution<" << model.getPrecision().getName() << "> standardExponentialDistribution(" << Type::writeNumeric(1.0, model.getPrecision()) << ");" << std::endl;
+            runnerVarDecl << std::endl;
+        }
 
         // If no seed is specified, use system randomness to generate seed sequence
         CodeStream::Scope b(runnerVarAlloc);
@@ -161,20 +180,34 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
                    std::inserter(customUpdateGroups, customUpdateGroups.end()),
                    [](const ModelSpec::CustomConnectivityUpdateValueType &v) { return v.second.getUpdateGroupName(); });
 
+    // Generate host scalar, either as global variable or context member
+    const auto genContextHostScalar =
+        [instanceContext, &definitionsVar, &runnerVarDecl, &contextVar, &contextVarNames]
+        (const Type::ResolvedType &type, const std::string &name, const std::string &value)
+        {
+            if(instanceContext) {
+                contextVar << type.getValue().name << " " << name << " = " << value << ";" << std::endl;
+                contextVarNames.push_back(name);
+            }
+            else {
+                genHostScalar(definitionsVar, runnerVarDecl, type, name, value);
+            }
+        };
+
     // Generate variables to store total elapsed time
     // **NOTE** we ALWAYS generate these so usercode doesn't require #ifdefs around timing code
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "initTime", "0.0");
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "initSparseTime", "0.0");
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "neuronUpdateTime", "0.0");
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "presynapticUpdateTime", "0.0");
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "postsynapticUpdateTime", "0.0");
-    genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "synapseDynamicsTime", "0.0");
+    genContextHostScalar(Type::Double, "initTime", "0.0");
+    genContextHostScalar(Type::Double, "initSparseTime", "0.0");
+    genContextHostScalar(Type::Double, "neuronUpdateTime", "0.0");
+    genContextHostScalar(Type::Double, "presynapticUpdateTime", "0.0");
+    genContextHostScalar(Type::Double, "postsynapticUpdateTime", "0.0");
+    genContextHostScalar(Type::Double, "synapseDynamicsTime", "0.0");
 
     // Generate variables to store total elapsed time for each custom update group
     for(const auto &g : customUpdateGroups) {
-        genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "customUpdate" + g + "Time", "0.0");
-        genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "customUpdate" + g + "TransposeTime", "0.0");
-        genHostScalar(definitionsVar, runnerVarDecl, Type::Double, "customUpdate" + g + "RemapTime", "0.0");
+        genContextHostScalar(Type::Double, "customUpdate" + g + "Time", "0.0");
+        genContextHostScalar(Type::Double, "customUpdate" + g + "TransposeTime", "0.0");
+        genContextHostScalar(Type::Double, "customUpdate" + g + "RemapTime", "0.0");
     }
     
     // If timing is actually enabled
@@ -224,6 +257,93 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
         allVarStreams << std::endl;
     }
 
+    // If profiling is enabled
+    if(model.isProfilingEnabled()) {
+        definitionsVar << "// ------------------------------------------------------------------------" << std::endl;
+        definitionsVar << "// profiling counters" << std::endl;
+        definitionsVar << "// ------------------------------------------------------------------------" << std::endl;
+        runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+        runnerVarDecl << "// profiling counters" << std::endl;
+        runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
+
+        // Define structure used to hold counters for each population
+        // **NOTE** layout must match Runtime::Runtime::ProfileCounters
+        definitionsVar << "struct GeNNProfileCounters";
+        {
+            CodeStream::Scope b(definitionsVar);
+            definitionsVar << "double time;" << std::endl;
+            definitionsVar << "unsigned long long calls;" << std::endl;
+            definitionsVar << "unsigned long long neurons;" << std::endl;
+            definitionsVar << "unsigned long long spikes;" << std::endl;
+            definitionsVar << "unsigned long long synapses;" << std::endl;
+        }
+        definitionsVar << ";" << std::endl;
+
+        // Generate array of counters, indexed by population, for each merged update group
+        const auto genProfileCounters =
+            [instanceContext, &definitionsVar, &runnerVarDecl, &contextVar, &contextVarNames](const auto &mergedGroups)
+            {
+                for(const auto &m : mergedGroups) {
+                    const std::string name = "profile" + m.name + "Group" + std::to_string(m.getIndex());
+                    if(instanceContext) {
+                        contextVar << "GeNNProfileCounters " << name << "[" << m.getGroups().size() << "] = {};" << std::endl;
+                        contextVarNames.push_back(name);
+                    }
+                    else {
+                        definitionsVar << "EXPORT_VAR GeNNProfileCounters " << name << "[" << m.getGroups().size() << "];" << std::endl;
+                        runnerVarDecl << "GeNNProfileCounters " << name << "[" << m.getGroups().size() << "] = {};" << std::endl;
+                    }
+                }
+            };
+        genProfileCounters(modelMerged.getMergedNeuronUpdateGroups());
+        genProfileCounters(modelMerged.getMergedPresynapticUpdateGroups());
+        genProfileCounters(modelMerged.getMergedPostsynapticUpdateGroups());
+        genProfileCounters(modelMerged.getMergedSynapseDynamicsGroups());
+        genProfileCounters(modelMerged.getMergedCustomUpdateGroups());
+        genProfileCounters(modelMerged.getMergedCustomUpdateWUGroups());
+        genProfileCounters(modelMerged.getMergedCustomUpdateTransposeWUGroups());
+        genProfileCounters(modelMerged.getMergedCustomConnectivityUpdateGroups());
+        allVarStreams << std::endl;
+    }
+
+    // If instance context is enabled, add flag used by instances sharing another's connectivity to skip initialising it
+    if(instanceContext) {
+        contextVar << "bool skipConnectivityInit;" << std::endl;
+        contextVarNames.push_back("skipConnectivityInit");
+    }
+
+    // If instance context is enabled
+    if(instanceContext) {
+        definitionsVar << "// ------------------------------------------------------------------------" << std::endl;
+        definitionsVar << "// instance context" << std::endl;
+        definitionsVar << "// ------------------------------------------------------------------------" << std::endl;
+        
+        // Forward declare context structures defined by each module
+        definitionsVar << "struct NeuronUpdateContext;" << std::endl;
+        definitionsVar << "struct SynapseUpdateContext;" << std::endl;
+        definitionsVar << "struct CustomUpdateContext;" << std::endl;
+        definitionsVar << "struct InitContext;" << std::endl;
+
+        // Define structure to hold all state previously held in global variables
+        definitionsVar << "struct GeNNContext";
+        {
+            CodeStream::Scope b(definitionsVar);
+            definitionsVar << contextVarStream.str();
+            definitionsVar << "NeuronUpdateContext *neuronUpdate;" << std::endl;
+            definitionsVar << "SynapseUpdateContext *synapseUpdate;" << std::endl;
+            definitionsVar << "CustomUpdateContext *customUpdate;" << std::endl;
+            definitionsVar << "InitContext *init;" << std::endl;
+        }
+        definitionsVar << ";" << std::endl;
+
+        // Define macros so generated code can access context members using their global variable names
+        // **NOTE** as macros are not expanded recursively, these are just accessed via context pointer
+        for(const auto &n : contextVarNames) {
+            definitionsVar << "#define " << n << " (context->" << n << ")" << std::endl;
+        }
+        definitionsVar << std::endl;
+    }
+
     runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
     runnerVarDecl << "// merged group arrays" << std::endl;
     runnerVarDecl << "// ------------------------------------------------------------------------" << std::endl;
@@ -238,49 +358,137 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
     runner << runnerVarDeclStream.str();
 
    
-    // ---------------------------------------------------------------------
-    // Function for setting the device and the host's global variables.
-    // Also estimates memory usage on device ...
-    runner << "void allocateMem()";
-    {
-        CodeStream::Scope b(runner);
-
-        // Generate preamble - this is the first bit of generated code called by user simulations
-        // so global initialisation is often performed here
-        backend.genAllocateMemPreamble(runner, modelMerged);
+    // If instance context is enabled, context is passed to all entry points
+    const std::string contextParam = instanceContext ? "GeNNContext *context" : "";
+    const std::string contextParamPrefix = instanceContext ? "GeNNContext *context, " : "";
+    const std::string contextArg = instanceContext ? "context, " : "";
+    if(instanceContext) {
+        // ---------------------------------------------------------------------
+        // Function to allocate context and everything within it
+        runner << "GeNNContext *allocateContext()";
+        {
+            CodeStream::Scope b(runner);
+            runner << "GeNNContext *context = new GeNNContext;" << std::endl;
+            runner << "skipConnectivityInit = false;" << std::endl;
+
+            // Generate preamble
+            backend.genAllocateMemPreamble(runner, modelMerged);
+
+            // Write variable allocations to runner
+            runner << runnerVarAllocStream.str();
+
+            // Allocate merged group arrays for each module
+            runner << "allocateNeuronUpdateContext(context);" << std::endl;
+            runner << "allocateSynapseUpdateContext(context);" << std::endl;
+            runner << "allocateCustomUpdateContext(context);" << std::endl;
+            runner << "allocateInitContext(context);" << std::endl;
+            runner << "return context;" << std::endl;
+        }
+        runner << std::endl;
+
+        // ------------------------------------------------------------------------
+        // Function to free context and everything within it
+        runner << "void freeContext(GeNNContext *context)";
+        {
+            CodeStream::Scope b(runner);
+
+            // Generate backend-specific preamble
+            backend.genFreeMemPreamble(runner, modelMerged);
+
+            // Write variable frees to runner
+            runner << runnerVarFreeStream.str();
+
+            // Free merged group arrays for each module
+            runner << "freeNeuronUpdateContext(context);" << std::endl;
+            runner << "freeSynapseUpdateContext(context);" << std::endl;
+            runner << "freeCustomUpdateContext(context);" << std::endl;
+            runner << "freeInitContext(context);" << std::endl;
+            runner << "delete context;" << std::endl;
+        }
+        runner << std::endl;
 
-        // Write variable allocations to runner
-        runner << runnerVarAllocStream.str();
-    }
-    runner << std::endl;
+        // ------------------------------------------------------------------------
+        // Function to reseed host RNG so each context can have its own random stream
+        if(backend.isGlobalHostRNGRequired(model)) {
+            runner << "void seedContext(GeNNContext *context, unsigned int seed)";
+            {
+                CodeStream::Scope b(runner);
+                runner << "std::seed_seq seeds{seed};" << std::endl;
+                runner << "hostRNG.seed(seeds);" << std::endl;
+                runner << "standardUniformDistribution.reset();" << std::endl;
+                runner << "standardNormalDistribution.reset();" << std::endl;
+                runner << "standardExponentialDistribution.reset();" << std::endl;
+            }
+        }
+        else {
+            runner << "void seedContext(GeNNContext*, unsigned int)";
+            {
+                CodeStream::Scope b(runner);
+            }
+        }
+        runner << std::endl;
+
+        // ------------------------------------------------------------------------
+        // Function to get pointer to context member by name, replacing dynamic symbol lookup
+        runner << "void *getContextSymbol(GeNNContext *context, const char *name)";
+        {
+            CodeStream::Scope b(runner);
+            for(const auto &n : contextVarNames) {
+                runner << "if(strcmp(name, \"" << n << "\") == 0)";
+                {
+                    CodeStream::Scope b(runner);
+                    runner << "return &" << n << ";" << std::endl;
+                }
+            }
+            runner << "return nullptr;" << std::endl;
+        }
+        runner << std::endl;
+    }
+    else {
+        // ---------------------------------------------------------------------
+        // Function for setting the device and the host's global variables.
+        // Also estimates memory usage on device ...
+        runner << "void allocateMem()";
+        {
+            CodeStream::Scope b(runner);
+
+            // Generate preamble - this is the first bit of generated code called by user simulations
+            // so global initialisation is often performed here
+            backend.genAllocateMemPreamble(runner, modelMerged);
+
+            // Write variable allocations to runner
+            runner << runnerVarAllocStream.str();
+        }
+        runner << std::endl;
 
-    // ------------------------------------------------------------------------
-    // Function to free all global memory structures
-    runner << "void freeMem()";
-    {
-        CodeStream::Scope b(runner);
+        // ------------------------------------------------------------------------
+        // Function to free all global memory structures
+        runner << "void freeMem()";
+        {
+            CodeStream::Scope b(runner);
 
-        // Generate backend-specific preamble
-        backend.genFreeMemPreamble(runner, modelMerged);
+            // Generate backend-specific preamble
+            backend.genFreeMemPreamble(runner, modelMerged);
 
-        // Write variable frees to runner
-        runner << runnerVarFreeStream.str();
+            // Write variable frees to runner
+            runner << runnerVarFreeStream.str();
+        }
+        runner << std::endl;
     }
-    runner << std::endl;
 
     // ------------------------------------------------------------------------
     // Function to free all global memory structures
-    runner << "void stepTime(unsigned long long timestep, unsigned long long numRecordingTimesteps)";
+    runner << "void stepTime(" << contextParamPrefix << "unsigned long long timestep, unsigned long long numRecordingTimesteps)";
     {
         CodeStream::Scope b(runner);
 
         runner << "const " << model.getTimePrecision().getName() << " t = timestep * " << Type::writeNumeric(model.getDT(), model.getTimePrecision()) << ";" << std::endl;
 
         // Update synaptic state
-        runner << "updateSynapses(t);" << std::endl;
+        runner << "updateSynapses(" << contextArg << "t);" << std::endl;
 
         // Update neuronal state
-        runner << "updateNeurons(t";
+        runner << "updateNeurons(" << contextArg << "t";
         if(model.isRecordingInUse()) {
             runner << ", (unsigned int)(timestep % numRecordingTimesteps)";
         }
@@ -298,27 +506,44 @@ void GeNN::CodeGenerator::generateRunner(const filesystem::path &outputPath, Mod
     // ---------------------------------------------------------------------
     // Function definitions
     definitions << "// Runner functions" << std::endl;
-    definitions << "EXPORT_FUNC void allocateMem();" << std::endl;
-    definitions << "EXPORT_FUNC void freeMem();" << std::endl;
-    definitions << "EXPORT_FUNC void stepTime(unsigned long long timestep, unsigned long long numRecordingTimesteps);" << std::endl;
+    if(instanceContext) {
+        definitions << "EXPORT_FUNC GeNNContext *allocateContext();" << std::endl;
+        definitions << "EXPORT_FUNC void freeContext(GeNNContext *context);" << std::endl;
+        definitions << "EXPORT_FUNC void seedContext(GeNNContext *context, unsigned int seed);" << std::endl;
+        definitions << "EXPORT_FUNC void *getContextSymbol(GeNNContext *context, const char *name);" << std::endl;
+    }
+    else {
+        definitions << "EXPORT_FUNC void allocateMem();" << std::endl;
+        definitions << "EXPORT_FUNC void freeMem();" << std::endl;
+    }
+    definitions << "EXPORT_FUNC void stepTime(" << contextParamPrefix << "unsigned long long timestep, unsigned long long numRecordingTimesteps);" << std::endl;
     definitions << std::endl;
     definitions << "// Functions generated by backend" << std::endl;
-    definitions << "EXPORT_FUNC void updateNeurons(" << modelMerged.getModel().getTimePrecision().getName() << " t";
+    definitions << "EXPORT_FUNC void updateNeurons(" << contextParamPrefix << modelMerged.getModel().getTimePrecision().getName() << " t";
     if(model.isRecordingInUse()) {
         definitions << ", unsigned int recordingTimestep";
     }
     definitions << "); " << std::endl;
-    definitions << "EXPORT_FUNC void updateSynapses(" << modelMerged.getModel().getTimePrecision().getName() << " t);" << std::endl;
-    definitions << "EXPORT_FUNC void initialize();" << std::endl;
-    definitions << "EXPORT_FUNC void initializeSparse();" << std::endl;
-    definitions << "EXPORT_FUNC void initializeHost();" << std::endl;
+    definitions << "EXPORT_FUNC void updateSynapses(" << contextParamPrefix << modelMerged.getModel().getTimePrecision().getName() << " t);" << std::endl;
+    definitions << "EXPORT_FUNC void initialize(" << contextParam << ");" << std::endl;
+    definitions << "EXPORT_FUNC void initializeSparse(" << contextParam << ");" << std::endl;
+    definitions << "EXPORT_FUNC void initializeHost(" << contextParam << ");" << std::endl;
     
     // Generate function definitions for each custom update
     for(const auto &g : customUpdateGroups) {
-        definitions << "EXPORT_FUNC void update" << g << "(unsigned long long timestep);" << std::endl;
+        definitions << "EXPORT_FUNC void update" << g << "(" << contextParamPrefix << "unsigned long long timestep);" << std::endl;
     }
     definitions << std::endl;
 
+    // If instance context is enabled, generate function definitions to allocate and free each module's context
+    if(instanceContext) {
+        for(const char *module : {"NeuronUpdate", "SynapseUpdate", "CustomUpdate", "Init"}) {
+            definitions << "EXPORT_FUNC void allocate" << module << "Context(GeNNContext *context);" << std::endl;
+            definitions << "EXPORT_FUNC void free" << module << "Context(GeNNContext *context);" << std::endl;
+        }
+        definitions << std::endl;
+    }
+
     // Loop through merged synapse connectivity host initialisation groups
     definitions << "// Merged group upload functions" << std::endl;
     for(const auto &m : modelMerged.getMergedSynapseConnectivityHostInitGroups()) {
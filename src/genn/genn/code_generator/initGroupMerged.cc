@@ -334,16 +334,37 @@ void NeuronInitGroupMerged::InSynPSM::generate(const BackendBase &backend, Envir
 
     // If dendritic delays are required
     if(getArchetype().isDendriticOutputDelayRequired()) {
-        // Add field for dendritic delay buffer and zero
-        groupEnv.addField(getScalarType().createPointer(), "_den_delay", "denDelay" + fieldSuffix,
-                          [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "denDelay"); });
-        backend.genVariableInit(groupEnv, "num_neurons", "id",
-            [batchSize, this](EnvironmentExternalBase &varEnv)
-            {
-                genVariableFill(varEnv, "_den_delay", Type::writeNumeric(0.0, getScalarType()),
-                                "id", "$(num_neurons)", VarAccessDim::BATCH | VarAccessDim::ELEMENT, 
-                                batchSize, getArchetype().getMaxDendriticDelayTimesteps());
-            });
+        // If dendritic delays are implemented using a timing wheel, add field for bucket counts and zero
+        // **NOTE** bucket entries beyond count are never read so don't need initialising
+        if(getArchetype().isDendriticDelayWheelEnabled()) {
+            groupEnv.addField(Type::Uint32.createPointer(), "_den_delay_wheel_count", "denDelayWheelCount" + fieldSuffix,
+                              [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "denDelayWheelCount"); });
+            groupEnv.addField(Type::Uint32.createPointer(), "_den_delay_wheel_overflow", "denDelayWheelOverflow" + fieldSuffix,
+                              [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "denDelayWheelOverflow"); });
+            backend.genPopVariableInit(groupEnv,
+                [batchSize, this](EnvironmentExternalBase &varEnv)
+                {
+                    const size_t numBuckets = (size_t)getArchetype().getMaxDendriticDelayTimesteps() * batchSize;
+                    varEnv.getStream() << "for(unsigned int d = 0; d < " << numBuckets << "; d++)";
+                    {
+                        CodeStream::Scope b(varEnv.getStream());
+                        varEnv.printLine("$(_den_delay_wheel_count)[d] = 0;");
+                    }
+                    varEnv.printLine("$(_den_delay_wheel_overflow)[0] = 0;");
+                });
+        }
+        // Otherwise, add field for dendritic delay buffer and zero
+        else {
+            groupEnv.addField(getScalarType().createPointer(), "_den_delay", "denDelay" + fieldSuffix,
+                              [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "denDelay"); });
+            backend.genVariableInit(groupEnv, "num_neurons", "id",
+                [batchSize, this](EnvironmentExternalBase &varEnv)
+                {
+                    genVariableFill(varEnv, "_den_delay", Type::writeNumeric(0.0, getScalarType()),
+                                    "id", "$(num_neurons)", VarAccessDim::BATCH | VarAccessDim::ELEMENT, 
+                                    batchSize, getArchetype().getMaxDendriticDelayTimesteps());
+                });
+        }
 
         // Add field for dendritic delay pointer and zero
         groupEnv.addField(Type::Uint32.createPointer(), "_den_delay_ptr", "denDelayPtr" + fieldSuffix,
@@ -508,6 +529,30 @@ void NeuronInitGroupMerged::generateInit(const BackendBase &backend, Environment
                          getArchetype().isSpikeDelayRequired(), batchSize);
     }
 
+    // Zero firing rate estimates
+    if(getArchetype().isSpikeRateEstimationEnabled()) {
+        backend.genVariableInit(groupEnv, "num_neurons", "id",
+            [batchSize] (EnvironmentExternalBase &varEnv)
+            {
+                genVariableFill(varEnv, "_spk_rate", "0.0", "id", "$(num_neurons)", 
+                                VarAccessDim::BATCH | VarAccessDim::ELEMENT, batchSize);
+            });
+    }
+
+    // Zero inter-spike interval histogram
+    if(getArchetype().isISIHistogramEnabled()) {
+        const unsigned int numHistogramBins = batchSize * getArchetype().getISIHistogramNumBins();
+        backend.genPopVariableInit(groupEnv,
+            [numHistogramBins](EnvironmentExternalBase &varEnv)
+            {
+                varEnv.getStream() << "for(unsigned int b = 0; b < " << numHistogramBins << "; b++)";
+                {
+                    CodeStream::Scope b(varEnv.getStream());
+                    varEnv.printLine("$(_isi_hist)[b] = 0;");
+                }
+            });
+    }
+
     // Initialise neuron variables
     genInitNeuronVarCode<NeuronVarAdapter>(backend, groupEnv, *this, "", 
                                            "num_neurons", batchSize);
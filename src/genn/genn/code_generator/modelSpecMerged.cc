@@ -15,14 +15,25 @@ using namespace GeNN::CodeGenerator;
 // GeNN::CodeGenerator::ModelSpecMerged
 //----------------------------------------------------------------------------
  ModelSpecMerged::ModelSpecMerged(const BackendBase &backend, const ModelSpecInternal &model)
-:   m_Model(model)
+:   m_Model(model), m_MaxSpecialisedGroups(backend.getPreferences().maxSpecialisedGroups)
 {
+    // If profiling is enabled, check backend supports it
+    if(getModel().isProfilingEnabled() && !backend.isProfilingSupported()) {
+        throw std::runtime_error("Model has profiling enabled which this backend does not support");
+    }
+
     createMergedGroups(getModel().getNeuronGroups(), m_MergedNeuronUpdateGroups,
                        [](const NeuronGroupInternal&){ return true; },
                        &NeuronGroupInternal::getHashDigest);
 
+    // **NOTE** if backend supports it, presynaptic spikes of synapse groups sharing connectivity 
+    // are processed within the presynaptic update of the synapse group whose connectivity they share
     createMergedGroups(getModel().getSynapseGroups(), m_MergedPresynapticUpdateGroups,
-                       [](const SynapseGroupInternal &sg) { return (sg.isPreSpikeEventRequired() || sg.isPreSpikeRequired()); },
+                       [&backend](const SynapseGroupInternal &sg)
+                       {
+                           return ((sg.isPreSpikeEventRequired() || sg.isPreSpikeRequired())
+                                   && !(backend.isSharedConnectivityPreSpikeFusionSupported() && sg.isSharedConnectivityPreSpikeFused()));
+                       },
                        &SynapseGroupInternal::getWUHashDigest);
 
     createMergedGroups(getModel().getSynapseGroups(), m_MergedPostsynapticUpdateGroups,
@@ -63,14 +74,23 @@ using namespace GeNN::CodeGenerator;
                        [](const CustomConnectivityUpdateInternal &cg) { return !Utils::areTokensEmpty(cg.getHostUpdateCodeTokens()); },
                        &CustomConnectivityUpdateInternal::getHashDigest);
 
-    // If the current backend requires postsynaptic
+    // If synapse groups have growable row capacity, check backend supports this
+    for(const auto &s : getModel().getSynapseGroups()) {
+        if(s.second.isRowCapacityGrowable() && !backend.isRowCapacityGrowthSupported()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' has growable row capacity which this backend does not support");
+        }
+    }
+
+    // If the current backend requires postsynaptic remap
     if (backend.isPostsynapticRemapRequired()) {
         // Build map of (arbitrary) custom connectivity updates associated with name of each 
         // synapse group which requires postsynaptic remap in each custom update group!
+        // **NOTE** remaps of groups with growable row capacity may be updated incrementally instead
         std::map<std::pair<std::string, std::string>, std::reference_wrapper<const CustomConnectivityUpdateInternal>> customConnectUpdateMap;
         for (const auto& c : getModel().getCustomConnectivityUpdates()) {
             const auto* sg = c.second.getSynapseGroup();
-            if (c.second.canModifyConnectivity() && (sg->isPostSpikeRequired() || sg->isPostSpikeEventRequired())) {
+            if (c.second.canModifyConnectivity() && (sg->isPostSpikeRequired() || sg->isPostSpikeEventRequired())
+                && !(sg->isRowCapacityGrowable() && backend.isPostsynapticRemapIncremental())) {
                 customConnectUpdateMap.emplace(std::piecewise_construct,
                                                std::forward_as_tuple(c.second.getUpdateGroupName(), sg->getName()), 
                                                std::forward_as_tuple(c.second));
@@ -99,6 +119,9 @@ using namespace GeNN::CodeGenerator;
     for(const auto &n : getModel().getNeuronGroups()) {
         for(const auto *sg : n.second.getFusedPSMInSyn()) {
             if(sg->isDendriticOutputDelayRequired()) {
+                if(sg->isDendriticDelayWheelEnabled() && !backend.isDendriticDelayWheelSupported()) {
+                    throw std::runtime_error("Synapse group '" + sg->getName() + "' implements dendritic delays using a sparse timing wheel which this backend does not support");
+                }
                 synapseGroupsWithDendriticDelay.push_back(std::cref(*sg));
             }
         }
@@ -177,7 +200,8 @@ using namespace GeNN::CodeGenerator;
     createMergedGroups(getModel().getSynapseGroups(), m_MergedSynapseConnectivityHostInitGroups,
                        [](const SynapseGroupInternal &sg)
                        { 
-                           return !Utils::areTokensEmpty(sg.getSparseConnectivityInitialiser().getHostInitCodeTokens());
+                           return (sg.getSharedConnectivityTarget() == nullptr
+                                   && !Utils::areTokensEmpty(sg.getSparseConnectivityInitialiser().getHostInitCodeTokens()));
                        },
                        &SynapseGroupInternal::getConnectivityHostInitHashDigest);
 }
@@ -14,6 +14,62 @@ using namespace GeNN;
 using namespace GeNN::CodeGenerator;
 using namespace GeNN::Transpiler;
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+template<typename A, typename G, typename F>
+void genVarTraces(EnvironmentGroupMergedField<G, F> &env, const NeuronUpdateGroupMerged &ng, 
+                  const std::map<std::string, VarTrace> &traces, const std::string &fieldSuffix, 
+                  unsigned int batchSize)
+{
+    A archetypeAdapter(env.getGroup().getArchetype());
+    for(const auto &var : archetypeAdapter.getDefs()) {
+        const auto t = traces.find(var.name);
+        if(t == traces.cend()) {
+            continue;
+        }
+
+        // Add fields for variable, recording buffer and indices of traced neurons
+        const auto resolvedType = var.type.resolve(env.getGroup().getTypeContext());
+        env.addField(resolvedType.createPointer(), "_trace_" + var.name, var.name + fieldSuffix,
+                     [var](const auto &runtime, const auto &g, size_t) { return runtime.getArray(A(g).getTarget(), var.name); });
+        env.addField(resolvedType.createPointer(), "_record_trace_" + var.name, "recordTrace" + var.name + fieldSuffix,
+                     [var](const auto &runtime, const auto &g, size_t) { return runtime.getArray(A(g).getTarget(), "recordTrace" + var.name); });
+        env.addField(Type::Uint32.createPointer(), "_trace_idx_" + var.name, "traceIdx" + var.name + fieldSuffix,
+                     [var](const auto &runtime, const auto &g, size_t) { return runtime.getArray(A(g).getTarget(), "traceIdx" + var.name); });
+
+        // If variable isn't sampled every timestep, only sample on multiples of interval
+        const unsigned int interval = t->second.interval;
+        env.getStream() << "// trace " << var.name << std::endl;
+        if(interval > 1) {
+            env.getStream() << "if((recordingTimestep % " << interval << ") == 0)";
+        }
+        {
+            CodeStream::Scope b(env.getStream());
+
+            // Calculate offset of this sample in recording buffer
+            const size_t numTraced = t->second.neuronIDs.size();
+            const std::string sample = (interval > 1) ? "(recordingTimestep / " + std::to_string(interval) + ")" : "recordingTimestep";
+            const std::string batchSample = (batchSize > 1) ? "((" + sample + " * " + std::to_string(batchSize) + ") + $(batch))" : sample;
+            env.printLine("const unsigned int traceOffset = " + batchSample + " * " + std::to_string(numTraced) + ";");
+
+            // Copy values from traced neurons into recording buffer
+            // **NOTE** this runs after neuron update so values are read from slot written this timestep
+            const bool delayed = archetypeAdapter.getNumVarDelaySlots(var.name).has_value();
+            const std::string index = ng.getWriteVarIndex(delayed, batchSize, archetypeAdapter.getVarDims(var), 
+                                                          "$(_trace_idx_" + var.name + ")[j]");
+            env.getStream() << "for(unsigned int j = 0; j < " << numTraced << "; j++)";
+            {
+                CodeStream::Scope b(env.getStream());
+                env.printLine("$(_record_trace_" + var.name + ")[traceOffset + j] = $(_trace_" + var.name + ")[" + index + "];");
+            }
+        }
+    }
+}
+}   // Anonymous namespace
+
 //----------------------------------------------------------------------------
 // GeNN::CodeGenerator::NeuronUpdateGroupMerged::CurrentSource
 //----------------------------------------------------------------------------
@@ -37,6 +93,9 @@ void NeuronUpdateGroupMerged::CurrentSource::generate(EnvironmentExternalBase &e
     // Add neuron variable references
     csEnv.addLocalVarRefs<CurrentSourceNeuronVarRefAdapter>(true);
 
+    // Add variables demoted to constants
+    csEnv.addDemotedVars<CurrentSourceVarAdapter>(fieldSuffix);
+
     // Define inject current function
     csEnv.add(Type::ResolvedType::createFunction(Type::Void, {getScalarType()}),
               "injectCurrent", "$(_" + getArchetype().getTargetVar() + ") += $(0)");
@@ -54,10 +113,19 @@ void NeuronUpdateGroupMerged::CurrentSource::generate(EnvironmentExternalBase &e
     prettyPrintStatements(getArchetype().getInjectionCodeTokens(), getTypeContext(), varEnv, errorHandler);
 }
 //----------------------------------------------------------------------------
+void NeuronUpdateGroupMerged::CurrentSource::generateVarTraces(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng,
+                                                               unsigned int batchSize)
+{
+    EnvironmentGroupMergedField<CurrentSource, NeuronUpdateGroupMerged> csEnv(env, *this, ng);
+    genVarTraces<CurrentSourceVarAdapter>(csEnv, ng, getArchetype().getVarTraces(), 
+                                          "CS" + std::to_string(getIndex()), batchSize);
+}
+//----------------------------------------------------------------------------
 void NeuronUpdateGroupMerged::CurrentSource::updateHash(boost::uuids::detail::sha1 &hash) const
 {
     updateParamHash([](const CurrentSourceInternal &g) { return g.getParams(); }, hash);
     updateParamHash([](const CurrentSourceInternal &g) { return g.getDerivedParams(); }, hash);
+    updateDemotedVarHash<CurrentSourceVarAdapter>(hash);
 }
 
 //----------------------------------------------------------------------------
@@ -81,8 +149,9 @@ void NeuronUpdateGroupMerged::InSynPSM::generate(const BackendBase &backend, Env
     psmEnv.getStream() << "// postsynaptic model " << getIndex() << std::endl;
     psmEnv.printLine(getScalarType().getName() + " linSyn = $(_out_post)[" + idx + "];");
 
-    // If dendritic delay is required
-    if (getArchetype().isDendriticOutputDelayRequired()) {
+    // If dendritic delay is required and it is implemented using a ring buffer
+    // **NOTE** dendritic delay timing wheels are drained directly into outPost
+    if (getArchetype().isDendriticOutputDelayRequired() && !getArchetype().isDendriticDelayWheelEnabled()) {
         // Add dendritic delay buffer and pointer into it
         psmEnv.addField(getScalarType().createPointer(), "_den_delay", "denDelay" + fieldSuffix,
                         [](const auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "denDelay");});
@@ -109,6 +178,9 @@ void NeuronUpdateGroupMerged::InSynPSM::generate(const BackendBase &backend, Env
     // Add neuron variable references
     psmEnv.addLocalVarRefs<SynapsePSMNeuronVarRefAdapter>(true);
 
+    // Add variables demoted to constants
+    psmEnv.addDemotedVars<SynapsePSMVarAdapter>(fieldSuffix);
+
     // **TODO** naming convention
     psmEnv.add(getScalarType(), "inSyn", "linSyn");
     
@@ -136,10 +208,19 @@ void NeuronUpdateGroupMerged::InSynPSM::generate(const BackendBase &backend, Env
     varEnv.printLine("$(_out_post)[" + ng.getVarIndex(batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id)") + "] = linSyn;");
 }
 //----------------------------------------------------------------------------
+void NeuronUpdateGroupMerged::InSynPSM::generateVarTraces(EnvironmentExternalBase &env, NeuronUpdateGroupMerged &ng,
+                                                          unsigned int batchSize)
+{
+    EnvironmentGroupMergedField<InSynPSM, NeuronUpdateGroupMerged> psmEnv(env, *this, ng);
+    genVarTraces<SynapsePSMVarAdapter>(psmEnv, ng, getArchetype().getPSVarTraces(), 
+                                       "InSyn" + std::to_string(getIndex()), batchSize);
+}
+//----------------------------------------------------------------------------
 void NeuronUpdateGroupMerged::InSynPSM::updateHash(boost::uuids::detail::sha1 &hash) const
 {
     updateParamHash([](const SynapseGroupInternal &g) { return g.getPSInitialiser().getParams(); }, hash);
     updateParamHash([](const SynapseGroupInternal &g) { return g.getPSInitialiser().getDerivedParams(); }, hash);
+    updateDemotedVarHash<SynapsePSMVarAdapter>(hash);
 }
 
 //----------------------------------------------------------------------------
@@ -528,6 +609,7 @@ boost::uuids::detail::sha1::digest_type NeuronUpdateGroupMerged::getHashDigest()
     // Update hash with each group's parameters and derived parameters
     updateHash([](const NeuronGroupInternal &g) { return g.getParams(); }, hash);
     updateHash([](const NeuronGroupInternal &g) { return g.getDerivedParams(); }, hash);
+    updateDemotedVarHash<NeuronVarAdapter>(hash);
     
     // Update hash with child groups
     for (const auto &cs : getMergedCurrentSourceGroups()) {
@@ -613,11 +695,13 @@ void NeuronUpdateGroupMerged::generateNeuronUpdate(const BackendBase &backend, E
 
     // Expose neuron variables
     neuronEnv.addVarExposeAliases<NeuronVarAdapter>();
+    neuronEnv.addDemotedVars<NeuronVarAdapter>();
 
     // Substitute parameter and derived parameter names
     neuronEnv.addParams(nm->getParams(), "", &NeuronGroupInternal::getParams,
                         &NeuronGroupInternal::isParamDynamic);
     neuronEnv.addDerivedParams(nm->getDerivedParams(), "", &NeuronGroupInternal::getDerivedParams);
+    neuronEnv.addDerivedParams(nm->getLinearDynamicsDerivedParams(), "", &NeuronGroupInternal::getDerivedParams);
     neuronEnv.addExtraGlobalParams(nm->getExtraGlobalParams());
     
     // Substitute spike time
@@ -803,6 +887,20 @@ void NeuronUpdateGroupMerged::generateWUVarUpdate(EnvironmentExternalBase &env,
     }
 }
 //--------------------------------------------------------------------------
+void NeuronUpdateGroupMerged::generateVarTraces(EnvironmentExternalBase &env, unsigned int batchSize)
+{
+    EnvironmentGroupMergedField<NeuronUpdateGroupMerged> neuronEnv(env, *this);
+    genVarTraces<NeuronVarAdapter>(neuronEnv, *this, getArchetype().getVarTraces(), "", batchSize);
+
+    // Loop through incoming synapse groups and current sources
+    for(auto &sg : m_MergedInSynPSMGroups) {
+        sg.generateVarTraces(neuronEnv, *this, batchSize);
+    }
+    for(auto &cs : m_MergedCurrentSourceGroups) {
+        cs.generateVarTraces(neuronEnv, *this, batchSize);
+    }
+}
+//--------------------------------------------------------------------------
 std::string NeuronUpdateGroupMerged::getVarIndex(unsigned int batchSize, VarAccessDim varDims, 
                                                  const std::string &index) const
 {
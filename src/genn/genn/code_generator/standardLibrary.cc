@@ -3,6 +3,7 @@
 // Standard C++ library
 #include <algorithm>
 #include <iterator>
+#include <numeric>
 
 // GeNN includes
 #include "type.h"
@@ -127,6 +128,78 @@ const auto libraryTypes = initLibraryTypes(
 
     // Assert
     std::make_pair("assert", std::make_pair(Type::ResolvedType::createFunction(Type::Void, {Type::Bool}), "assert($(0))")));
+
+//! Maths functions with approximate versions substituted 
+//! **NOTE** sigmoid isn't a standard maths function so it is only added alongside the 
+//! approximations, where it can't shadow identifiers in models which don't opt in
+const auto approximateLibraryTypes = 
+    []()
+    {
+        auto library = libraryTypes;
+        const std::pair<std::string, std::string> approximations[] = {
+            {"exp", "gennApproxExp"}, {"expm1", "gennApproxExpm1"}, {"log", "gennApproxLog"}, 
+            {"sigmoid", "gennApproxSigmoid"}, {"tanh", "gennApproxTanh"}};
+        for(const auto &a : approximations) {
+            library.erase(a.first);
+            library.emplace(a.first, std::make_pair(Type::ResolvedType::createFunction(Type::Float, {Type::Float}), a.second + "($(0))"));
+            library.emplace(a.first, std::make_pair(Type::ResolvedType::createFunction(Type::Double, {Type::Double}), a.second + "($(0))"));
+        }
+        return library;
+    }();
+
+//! Parameters used to generate approximate maths functions at one precision
+struct ApproximatePrecision
+{
+    Type::ResolvedType type;
+    Type::ResolvedType intType;
+    unsigned int mantissaBits;
+    int exponentBias;
+
+    //! Bit pattern of sqrt(0.5) used to split log argument into exponent and mantissa
+    std::string sqrtHalfBits;
+
+    //! Range to which exp argument is clamped to keep result normal
+    double expMin;
+    double expMax;
+
+    //! Cody-Waite splitting of ln(2) into high part with trailing zeros and low part
+    double ln2High;
+    double ln2Low;
+
+    //! Degrees of Taylor polynomials used for exp and expm1 and number of odd terms used for log
+    unsigned int expDegree;
+    unsigned int expm1Degree;
+    unsigned int logTerms;
+
+    //! Magnitude of tanh argument beyond which result rounds to +-1
+    double tanhMax;
+};
+
+const ApproximatePrecision approximatePrecisions[] = {
+    {Type::Float, Type::Int32, 23, 127, "0x3f3504f3", -87.0, 88.0, 
+     0.693145751953125, 1.428606765330187045e-06, 6, 8, 5, 10.0},
+    {Type::Double, Type::Int64, 52, 1023, "0x3fe6a09e667f3bcdll", -708.0, 709.0, 
+     0.693147180369123816490, 1.90821492927058770002e-10, 11, 14, 10, 20.0}};
+
+//! Write polynomial sum_i coefficients[i] * x^i in Horner form
+std::string writeHorner(const std::vector<double> &coefficients, const std::string &x, const Type::ResolvedType &type)
+{
+    std::string horner = Type::writeNumeric(coefficients.back(), type);
+    for(auto c = std::next(coefficients.crbegin()); c != coefficients.crend(); c++) {
+        horner = Type::writeNumeric(*c, type) + " + (" + x + " * (" + horner + "))";
+    }
+    return horner;
+}
+
+//! Get 1/i! for i in [0, degree]
+std::vector<double> getTaylorExpCoefficients(unsigned int degree)
+{
+    std::vector<double> coefficients{1.0};
+    for(unsigned int i = 1; i <= degree; i++) {
+        coefficients.push_back(coefficients.back() / i);
+    }
+    return coefficients;
+}
 }
 
 const EnvironmentLibrary::Library floatRandomFunctions = {
@@ -137,6 +210,7 @@ const EnvironmentLibrary::Library floatRandomFunctions = {
     {"gennrand_log_normal", {Type::ResolvedType::createFunction(Type::Float, {Type::Float, Type::Float}), "std::lognormal_distribution<float>($(0), $(1))(hostRNG)"}},
     {"gennrand_gamma", {Type::ResolvedType::createFunction(Type::Float, {Type::Float}), "std::gamma_distribution<float>($(0), 1.0f)(hostRNG)"}},
     {"gennrand_binomial", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Uint32, Type::Float}), "std::binomial_distribution<unsigned int>($(0), $(1))(hostRNG)"}},
+    {"gennrand_poisson", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Float}), "gennPoisson(hostRNG, standardUniformDistribution, (float)($(0)))"}},
 };
 
 const EnvironmentLibrary::Library doubleRandomFunctions = {
@@ -147,6 +221,7 @@ const EnvironmentLibrary::Library doubleRandomFunctions = {
     {"gennrand_log_normal", {Type::ResolvedType::createFunction(Type::Double, {Type::Double, Type::Double}), "std::lognormal_distribution<double>($(0), $(1))(hostRNG)"}},
     {"gennrand_gamma", {Type::ResolvedType::createFunction(Type::Double, {Type::Double}), "std::gamma_distribution<double>($(0), 1.0)(hostRNG)"}},
     {"gennrand_binomial", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Uint32, Type::Double}), "std::binomial_distribution<unsigned int>($(0), $(1))(hostRNG)"}},
+    {"gennrand_poisson", {Type::ResolvedType::createFunction(Type::Uint32, {Type::Double}), "gennPoisson(hostRNG, standardUniformDistribution, (double)($(0)))"}},
 };
 
 //---------------------------------------------------------------------------
@@ -159,6 +234,164 @@ const EnvironmentLibrary::Library &getMathsFunctions()
     return libraryTypes;
 }
 
+const EnvironmentLibrary::Library &getApproximateMathsFunctions()
+{
+    return approximateLibraryTypes;
+}
+
+void genApproximateMathsFunctions(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Approximate maths functions" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    for(const auto &p : approximatePrecisions) {
+        const std::string &t = p.type.getName();
+        const std::string &i = p.intType.getName();
+        const auto one = Type::writeNumeric(1.0, p.type);
+
+        // exp(x) = 2^n * exp(r) where n = round(x / ln(2)) and |r| <= ln(2) / 2
+        os << "inline " << t << " gennApproxExp(" << t << " x)";
+        {
+            CodeStream::Scope b(os);
+            os << "x = (x < " << Type::writeNumeric(p.expMin, p.type) << ") ? " << Type::writeNumeric(p.expMin, p.type) << " : ((x > " << Type::writeNumeric(p.expMax, p.type) << ") ? " << Type::writeNumeric(p.expMax, p.type) << " : x);" << std::endl;
+
+            // **NOTE** after clamping, adding bias makes argument positive so truncation rounds down.
+            // 32-bit exponents are used at both precisions as 64-bit integer conversions can't be vectorised with AVX2
+            os << "const int32_t n = (int32_t)((x * " << Type::writeNumeric(1.4426950408889634, p.type) << ") + " << Type::writeNumeric(p.exponentBias + 0.5, p.type) << ") - " << p.exponentBias << ";" << std::endl;
+            os << "const " << t << " r = (x - (n * " << Type::writeNumeric(p.ln2High, p.type) << ")) - (n * " << Type::writeNumeric(p.ln2Low, p.type) << ");" << std::endl;
+            os << "const " << i << " bits = (" << i << ")(n + " << p.exponentBias << ") << " << p.mantissaBits << ";" << std::endl;
+            os << t << " scale;" << std::endl;
+            os << "memcpy(&scale, &bits, sizeof(" << t << "));" << std::endl;
+            os << "return scale * (" << writeHorner(getTaylorExpCoefficients(p.expDegree), "r", p.type) << ");" << std::endl;
+        }
+        os << std::endl;
+
+        // exp(x) - 1 using Taylor series around zero, where subtraction would lose precision
+        os << "inline " << t << " gennApproxExpm1(" << t << " x)";
+        {
+            CodeStream::Scope b(os);
+            auto coefficients = getTaylorExpCoefficients(p.expm1Degree);
+            coefficients.erase(coefficients.begin());
+            os << "const " << t << " small = x * (" << writeHorner(coefficients, "x", p.type) << ");" << std::endl;
+            os << "return (fabs(x) < " << Type::writeNumeric(0.5, p.type) << ") ? small : (gennApproxExp(x) - " << one << ");" << std::endl;
+        }
+        os << std::endl;
+
+        // log(x) = e * ln(2) + log(m) where x = m * 2^e, sqrt(0.5) <= m < sqrt(2)
+        // and log(m) = 2 * atanh(s) where s = (m - 1) / (m + 1)
+        os << "inline " << t << " gennApproxLog(" << t << " x)";
+        {
+            CodeStream::Scope b(os);
+            os << i << " bits;" << std::endl;
+            os << "memcpy(&bits, &x, sizeof(" << t << "));" << std::endl;
+            os << "const int32_t e = (int32_t)((bits - " << p.sqrtHalfBits << ") >> " << p.mantissaBits << ");" << std::endl;
+            os << "bits -= ((" << i << ")e << " << p.mantissaBits << ");" << std::endl;
+            os << t << " m;" << std::endl;
+            os << "memcpy(&m, &bits, sizeof(" << t << "));" << std::endl;
+            os << "const " << t << " s = (m - " << one << ") / (m + " << one << ");" << std::endl;
+            os << "const " << t << " s2 = s * s;" << std::endl;
+
+            std::vector<double> coefficients(p.logTerms);
+            std::iota(coefficients.begin(), coefficients.end(), 0.0);
+            std::transform(coefficients.cbegin(), coefficients.cend(), coefficients.begin(),
+                           [](double n){ return 2.0 / ((2.0 * n) + 1.0); });
+            os << "return (e * " << Type::writeNumeric(0.6931471805599453, p.type) << ") + (s * (" << writeHorner(coefficients, "s2", p.type) << "));" << std::endl;
+        }
+        os << std::endl;
+
+        // tanh(x) = (exp(2x) - 1) / (exp(2x) + 1)
+        os << "inline " << t << " gennApproxTanh(" << t << " x)";
+        {
+            CodeStream::Scope b(os);
+            os << "x = (x < " << Type::writeNumeric(-p.tanhMax, p.type) << ") ? " << Type::writeNumeric(-p.tanhMax, p.type) << " : ((x > " << Type::writeNumeric(p.tanhMax, p.type) << ") ? " << Type::writeNumeric(p.tanhMax, p.type) << " : x);" << std::endl;
+            os << "const " << t << " e = gennApproxExpm1(" << Type::writeNumeric(2.0, p.type) << " * x);" << std::endl;
+            os << "return e / (e + " << Type::writeNumeric(2.0, p.type) << ");" << std::endl;
+        }
+        os << std::endl;
+
+        os << "inline " << t << " gennApproxSigmoid(" << t << " x)";
+        {
+            CodeStream::Scope b(os);
+            os << "return " << one << " / (" << one << " + gennApproxExp(-x));" << std::endl;
+        }
+        os << std::endl;
+    }
+}
+
+void genHostRNGFunctions(CodeStream &os)
+{
+    os << "// ------------------------------------------------------------------------" << std::endl;
+    os << "// Host RNG functions" << std::endl;
+    os << "// ------------------------------------------------------------------------" << std::endl;
+
+    // Inversion by sequential search, starting from P(0) = exp(-lambda)
+    // **NOTE** search stops if probabilities underflow before cumulative sum reaches u due to rounding
+    os << "template<typename RNG, typename Uniform, typename T>" << std::endl;
+    os << "inline unsigned int gennPoissonInversion(RNG &rng, Uniform &uniform, T lambda, T expMinusLambda)";
+    {
+        CodeStream::Scope b(os);
+        os << "const T u = (T)uniform(rng);" << std::endl;
+        os << "unsigned int x = 0;" << std::endl;
+        os << "T p = expMinusLambda;" << std::endl;
+        os << "T cdf = p;" << std::endl;
+        os << "while(u > cdf && p > (T)0)";
+        {
+            CodeStream::Scope b(os);
+            os << "x++;" << std::endl;
+            os << "p *= lambda / (T)x;" << std::endl;
+            os << "cdf += p;" << std::endl;
+        }
+        os << "return x;" << std::endl;
+    }
+    os << std::endl;
+
+    // Transformed rejection with squeeze (PTRS), Hormann (1993), for large means
+    os << "template<typename RNG, typename Uniform, typename T>" << std::endl;
+    os << "inline unsigned int gennPoissonPTRS(RNG &rng, Uniform &uniform, T lambda)";
+    {
+        CodeStream::Scope b(os);
+        os << "const T logLambda = std::log(lambda);" << std::endl;
+        os << "const T b = (T)0.931 + ((T)2.53 * std::sqrt(lambda));" << std::endl;
+        os << "const T a = (T)-0.059 + ((T)0.02483 * b);" << std::endl;
+        os << "const T logInvAlpha = std::log((T)1.1239 + ((T)1.1328 / (b - (T)3.4)));" << std::endl;
+        os << "const T vr = (T)0.9277 - ((T)3.6224 / (b - (T)2.0));" << std::endl;
+        os << "while(true)";
+        {
+            CodeStream::Scope b(os);
+            os << "const T u = (T)uniform(rng) - (T)0.5;" << std::endl;
+            os << "const T v = (T)uniform(rng);" << std::endl;
+            os << "const T us = (T)0.5 - std::fabs(u);" << std::endl;
+            os << "const T k = std::floor(((((T)2.0 * a) / us) + b) * u + lambda + (T)0.43);" << std::endl;
+            os << "if(us >= (T)0.07 && v <= vr)";
+            {
+                CodeStream::Scope b(os);
+                os << "return (unsigned int)k;" << std::endl;
+            }
+            os << "if(k < (T)0 || (us < (T)0.013 && v > us))";
+            {
+                CodeStream::Scope b(os);
+                os << "continue;" << std::endl;
+            }
+            os << "if((std::log(v) + logInvAlpha - std::log((a / (us * us)) + b)) <= (-lambda + (k * logLambda) - std::lgamma(k + (T)1)))";
+            {
+                CodeStream::Scope b(os);
+                os << "return (unsigned int)k;" << std::endl;
+            }
+        }
+    }
+    os << std::endl;
+
+    // Use inversion for small means, where it requires few iterations, and PTRS otherwise
+    // **NOTE** gennrand_poisson casts lambda to the model precision so T is never deduced as an integer type
+    os << "template<typename RNG, typename Uniform, typename T>" << std::endl;
+    os << "inline unsigned int gennPoisson(RNG &rng, Uniform &uniform, T lambda)";
+    {
+        CodeStream::Scope b(os);
+        os << "return (lambda < (T)10) ? gennPoissonInversion(rng, uniform, lambda, std::exp(-lambda)) : gennPoissonPTRS(rng, uniform, lambda);" << std::endl;
+    }
+    os << std::endl;
+}
+
 const EnvironmentLibrary::Library &getHostRNGFunctions(const Type::ResolvedType &precision)
 {
     if(precision == Type::Float) {
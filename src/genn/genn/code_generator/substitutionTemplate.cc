@@ -0,0 +1,66 @@
+#include "code_generator/substitutionTemplate.h"
+
+using namespace GeNN::CodeGenerator;
+
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+bool isIdentifierStart(char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_');
+}
+//----------------------------------------------------------------------------
+bool isIdentifierBody(char c)
+{
+    return (isIdentifierStart(c) || (c >= '0' && c <= '9'));
+}
+}   // Anonymous namespace
+
+//----------------------------------------------------------------------------
+// GeNN::CodeGenerator::SubstitutionTemplate
+//----------------------------------------------------------------------------
+SubstitutionTemplate::SubstitutionTemplate(const std::string &format)
+{
+    // Loop through $(XX) references
+    size_t literalBegin = 0;
+    size_t nameBegin;
+    size_t nameEnd;
+    for(size_t pos = findNext(format, 0, nameBegin, nameEnd); pos != std::string::npos;
+        pos = findNext(format, literalBegin, nameBegin, nameEnd))
+    {
+        // Add preceding literal text and name
+        m_Literals.emplace_back(format, literalBegin, pos - literalBegin);
+        m_Names.emplace_back(format, nameBegin, nameEnd - nameBegin);
+
+        // Continue after closing bracket
+        literalBegin = nameEnd + 1;
+    }
+
+    // Add remaining literal text
+    m_Literals.emplace_back(format, literalBegin);
+}
+//----------------------------------------------------------------------------
+size_t SubstitutionTemplate::findNext(const std::string &format, size_t pos, size_t &nameBegin, size_t &nameEnd)
+{
+    const size_t size = format.size();
+    for(pos = format.find('$', pos); pos != std::string::npos; pos = format.find('$', pos + 1)) {
+        // If '$' is followed by '(' and the start of an identifier
+        if((pos + 2) < size && format[pos + 1] == '(' && isIdentifierStart(format[pos + 2])) {
+            // Scan to end of identifier
+            size_t end = pos + 3;
+            while(end < size && isIdentifierBody(format[end])) {
+                end++;
+            }
+
+            // If identifier is terminated by ')', we've found a reference
+            if(end < size && format[end] == ')') {
+                nameBegin = pos + 2;
+                nameEnd = end;
+                return pos;
+            }
+        }
+    }
+    return std::string::npos;
+}
@@ -1,5 +1,8 @@
 #include "code_generator/synapseUpdateGroupMerged.h"
 
+// Standard C++ includes
+#include <algorithm>
+
 // GeNN code generator includes
 #include "code_generator/modelSpecMerged.h"
 
@@ -14,9 +17,10 @@ using namespace GeNN::CodeGenerator;
 //--------------------------------------------------------------------------
 namespace
 {
-template<typename A, typename G>
-void addHeterogeneousDelayPostVarRefs(EnvironmentGroupMergedField<G> &env, const std::vector<Transpiler::Token> &tokens,
-                                      G &sg, unsigned int batchSize)
+template<typename A, typename G, typename F>
+void addHeterogeneousDelayPostVarRefs(EnvironmentGroupMergedField<G, F> &env, const std::vector<Transpiler::Token> &tokens,
+                                      const G &sg, const SynapseGroupMergedBase &indexGroup, unsigned int batchSize,
+                                      const std::string &fieldSuffix)
 {
     // Loop through variable references
     const A archetypeAdaptor(sg.getArchetype());
@@ -26,58 +30,61 @@ void addHeterogeneousDelayPostVarRefs(EnvironmentGroupMergedField<G> &env, const
         const Models::VarReference &archetypeVarRef = archetypeAdaptor.getInitialisers().at(v.name);
         if(Utils::isIdentifierDelayed(v.name, tokens)) {
             env.addField(Type::getArraySubscript(resolvedType.addConst()), v.name,
-                         resolvedType.createPointer(), v.name,
+                         resolvedType.createPointer(), v.name + fieldSuffix,
                          [v](auto &runtime, const auto &g, size_t) 
                          { 
                              return A(g).getInitialisers().at(v.name).getTargetArray(runtime); 
                          },
-                         sg.getPostVarHetDelayIndex(batchSize, archetypeVarRef.getVarDims(), "$(id_post)"));
+                         indexGroup.getPostVarHetDelayIndex(batchSize, archetypeVarRef.getVarDims(), "$(id_post)"));
         }
         else {
             env.addField(resolvedType.addConst(), v.name,
-                         resolvedType.createPointer(), v.name,
+                         resolvedType.createPointer(), v.name + fieldSuffix,
                          [v](auto &runtime, const auto &g, size_t) 
                          { 
                              return A(g).getInitialisers().at(v.name).getTargetArray(runtime); 
                          },
-                         sg.getPostVarIndex(archetypeVarRef.getDelayNeuronGroup() != nullptr, batchSize,
-                                            archetypeVarRef.getVarDims(), "$(id_post)"));
+                         indexGroup.getPostVarIndex(archetypeVarRef.getDelayNeuronGroup() != nullptr, batchSize,
+                                                    archetypeVarRef.getVarDims(), "$(id_post)"));
         }
     }
 }
 //--------------------------------------------------------------------------
-template<typename G>
+//! Substitute weight update model state into synapse code and pretty print it
+/*! Fields are added to group F which, if synapse code is being generated for synapse groups processed 
+    within the traversal of another's connectivity, is the merged group of the traversed synapse groups */
+template<typename G, typename F>
 void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBase &env, const std::vector<Transpiler::Token> &tokens, const std::string &errorContext,
-                               G &sg, unsigned int batchSize, double dt)
+                               G &sg, F &fieldGroup, unsigned int batchSize, double dt, const std::string &fieldSuffix = "")
 {
     const auto *wu = sg.getArchetype().getWUInitialiser().getSnippet();
 
-    EnvironmentGroupMergedField<G> synEnv(env, sg);
+    EnvironmentGroupMergedField<G, F> synEnv(env, sg, fieldGroup);
 
     // Substitute parameter and derived parameter names
-    synEnv.addInitialiserParams("", &SynapseGroupInternal::getWUInitialiser, &SynapseGroupInternal::isWUParamDynamic);
-    synEnv.addInitialiserDerivedParams("", &SynapseGroupInternal::getWUInitialiser);
-    synEnv.addExtraGlobalParams(wu->getExtraGlobalParams());
+    synEnv.addInitialiserParams(fieldSuffix, &SynapseGroupInternal::getWUInitialiser, &SynapseGroupInternal::isWUParamDynamic);
+    synEnv.addInitialiserDerivedParams(fieldSuffix, &SynapseGroupInternal::getWUInitialiser);
+    synEnv.addExtraGlobalParams(wu->getExtraGlobalParams(), "", fieldSuffix);
 
     // Add referenced presynaptic neuron variables
     synEnv.template addVarRefs<SynapseWUPreNeuronVarRefAdapter>(
-        [&sg, batchSize](VarAccessMode, const Models::VarReference &v)
+        [&fieldGroup, batchSize](VarAccessMode, const Models::VarReference &v)
         {
-            return sg.getPreVarIndex(v.getDelayNeuronGroup() != nullptr, batchSize, 
-                                     v.getVarDims(), "$(id_pre)");
+            return fieldGroup.getPreVarIndex(v.getDelayNeuronGroup() != nullptr, batchSize, 
+                                             v.getVarDims(), "$(id_pre)");
         }, 
-        "", true);
+        fieldSuffix, true);
 
     // Add, potentially heterogeneously-delayed, references to postsynaptic model and neuron variables
-    addHeterogeneousDelayPostVarRefs<SynapseWUPostNeuronVarRefAdapter>(synEnv, tokens, sg, batchSize);
-    addHeterogeneousDelayPostVarRefs<SynapseWUPSMVarRefAdapter>(synEnv, tokens, sg, batchSize);
+    addHeterogeneousDelayPostVarRefs<SynapseWUPostNeuronVarRefAdapter>(synEnv, tokens, sg, fieldGroup, batchSize, fieldSuffix);
+    addHeterogeneousDelayPostVarRefs<SynapseWUPSMVarRefAdapter>(synEnv, tokens, sg, fieldGroup, batchSize, fieldSuffix);
 
     // Substitute names of preynaptic weight update variables
     synEnv.template addVars<SynapseWUPreVarAdapter>(
-        [&sg, batchSize](VarAccess a, const std::string&) 
+        [&sg, &fieldGroup, batchSize](VarAccess a, const std::string&) 
         { 
-            return sg.getPreVarIndex(sg.getArchetype().getAxonalDelaySteps() != 0, batchSize, getVarAccessDim(a), "$(id_pre)");
-        }, "", true);
+            return fieldGroup.getPreVarIndex(sg.getArchetype().getAxonalDelaySteps() != 0, batchSize, getVarAccessDim(a), "$(id_pre)");
+        }, fieldSuffix, true);
 
     // Loop through postsynaptic weight update variables
     for(const auto &v : sg.getArchetype().getWUInitialiser().getSnippet()->getPostVars()) {
@@ -85,23 +92,23 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
         const auto resolvedType = v.type.resolve(sg.getTypeContext());
         if(Utils::isIdentifierDelayed(v.name, tokens)) {
             synEnv.addField(Type::getArraySubscript(resolvedType.addConst()), v.name,
-                            resolvedType.createPointer(), v.name,
+                            resolvedType.createPointer(), v.name + fieldSuffix,
                             [v](auto &runtime, const auto &g, size_t) 
                             { 
                                 return runtime.getArray(g.getFusedWUPostTarget(), v.name);
                             },
-                            sg.getPostVarHetDelayIndex(batchSize, getVarAccessDim(v.access), "$(id_post)"));
+                            fieldGroup.getPostVarHetDelayIndex(batchSize, getVarAccessDim(v.access), "$(id_post)"));
         }
         else {
             const bool delayed = (sg.getArchetype().getBackPropDelaySteps() != 0
                                   || sg.getArchetype().isWUPostVarHeterogeneouslyDelayed(v.name));
             synEnv.addField(resolvedType.addConst(), v.name,
-                            resolvedType.createPointer(), v.name,
+                            resolvedType.createPointer(), v.name + fieldSuffix,
                             [v](auto &runtime, const auto &g, size_t) 
                             { 
                                 return runtime.getArray(g.getFusedWUPostTarget(), v.name);
                             },
-                            sg.getPostVarIndex(delayed, batchSize, getVarAccessDim(v.access), "$(id_post)"));
+                            fieldGroup.getPostVarIndex(delayed, batchSize, getVarAccessDim(v.access), "$(id_post)"));
         }
     }
     
@@ -117,10 +124,10 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
     const std::string axonalDelayMs = Type::writeNumeric(dt * (double)(sg.getArchetype().getAxonalDelaySteps() + 1u), sg.getTimeType());
     const bool preSpikeDelay = sg.getArchetype().getSrcNeuronGroup()->isSpikeDelayRequired();
     const bool preSpikeEventDelay = sg.getArchetype().getSrcNeuronGroup()->isSpikeEventDelayRequired();
-    const std::string preSTIndex = sg.getPreVarIndex(preSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
-    const std::string preSETIndex = sg.getPreVarIndex(preSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
-    const std::string prevPreSTIndex = sg.getPrePrevSpikeTimeIndex(preSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
-    const std::string prevPreSETIndex = sg.getPrePrevSpikeTimeIndex(preSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
+    const std::string preSTIndex = fieldGroup.getPreVarIndex(preSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
+    const std::string preSETIndex = fieldGroup.getPreVarIndex(preSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
+    const std::string prevPreSTIndex = fieldGroup.getPrePrevSpikeTimeIndex(preSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
+    const std::string prevPreSETIndex = fieldGroup.getPrePrevSpikeTimeIndex(preSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_pre)");
     synEnv.add(sg.getTimeType().addConst(), "st_pre", "stPre",
                {synEnv.addInitialiser("const " + timeStr + " stPre = " + axonalDelayMs + " + $(_src_st)[" + preSTIndex + "];")});
     synEnv.add(sg.getTimeType().addConst(), "prev_st_pre", "prevSTPre",
@@ -134,10 +141,10 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
     const std::string backPropDelayMs = Type::writeNumeric(dt * (double)(sg.getArchetype().getBackPropDelaySteps() + 1u), sg.getTimeType());
     const bool postSpikeDelay = sg.getArchetype().getTrgNeuronGroup()->isSpikeDelayRequired();
     const bool postSpikeEventDelay = sg.getArchetype().getTrgNeuronGroup()->isSpikeEventDelayRequired();
-    const std::string postSTIndex = sg.getPostVarIndex(postSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
-    const std::string postSETIndex = sg.getPostVarIndex(postSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
-    const std::string prevPostSTIndex = sg.getPostPrevSpikeTimeIndex(postSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
-    const std::string prevPostSETIndex = sg.getPostPrevSpikeTimeIndex(postSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
+    const std::string postSTIndex = fieldGroup.getPostVarIndex(postSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
+    const std::string postSETIndex = fieldGroup.getPostVarIndex(postSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
+    const std::string prevPostSTIndex = fieldGroup.getPostPrevSpikeTimeIndex(postSpikeDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
+    const std::string prevPostSETIndex = fieldGroup.getPostPrevSpikeTimeIndex(postSpikeEventDelay, batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_post)");
     synEnv.add(sg.getTimeType().addConst(), "st_post", "stPost",
                {synEnv.addInitialiser("const " + timeStr + " stPost = " + backPropDelayMs + " + $(_trg_st)[" + postSTIndex + "];")});
     synEnv.add(sg.getTimeType().addConst(), "prev_st_post", "prevSTPost",
@@ -150,10 +157,24 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
     // If weights are individual, substitute variables for values stored in global memory
     if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) {
         synEnv.template addVars<SynapseWUVarAdapter>(
-            [&sg, batchSize](VarAccess a, const std::string&) 
+            [&fieldGroup, batchSize](VarAccess a, const std::string&) 
             { 
-                return sg.getSynVarIndex(batchSize, getVarAccessDim(a), "$(id_syn)");
-            });
+                return fieldGroup.getSynVarIndex(batchSize, getVarAccessDim(a), "$(id_syn)");
+            }, fieldSuffix);
+
+        // If there are any lazily-decayed variables, decay them in closed form from when synapse was last updated
+        const auto lazyDecayVars = wu->getLazyDecayVars();
+        if(!lazyDecayVars.empty()) {
+            synEnv.addField(sg.getTimeType().createPointer(), "_lazy_decay_time", "lazyDecayTime" + fieldSuffix,
+                            [](auto &runtime, const auto &g, size_t) { return runtime.getArray(g, "lazyDecayTime"); });
+
+            const std::string lazyDecayTimeIndex = fieldGroup.getSynVarIndex(batchSize, VarAccessDim::BATCH | VarAccessDim::ELEMENT, "$(id_syn)");
+            synEnv.printLine("const " + timeStr + " lazyDecayElapsed = $(t) - $(_lazy_decay_time)[" + lazyDecayTimeIndex + "];");
+            for(const auto &l : lazyDecayVars) {
+                synEnv.printLine("$(" + l.first + ") *= exp(-lazyDecayElapsed / $(" + l.second + "));");
+            }
+            synEnv.printLine("$(_lazy_decay_time)[" + lazyDecayTimeIndex + "] = $(t);");
+        }
     }
     // Otherwise, if weights are procedual
     else if (sg.getArchetype().getMatrixType() & SynapseMatrixWeight::PROCEDURAL) {
@@ -169,10 +190,10 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
 
                     // Substitute in parameters and derived parameters for initialising variables
                     // **THINK** synEnv has quite a lot of unwanted stuff at t
-                    EnvironmentGroupMergedField<G> varInitEnv(synEnv, sg);
-                    varInitEnv.template addVarInitParams<SynapseWUVarAdapter>(var.name);
-                    varInitEnv.template addVarInitDerivedParams<SynapseWUVarAdapter>(var.name);
-                    varInitEnv.addExtraGlobalParams(varInit.getSnippet()->getExtraGlobalParams(), var.name);
+                    EnvironmentGroupMergedField<G, F> varInitEnv(synEnv, sg, fieldGroup);
+                    varInitEnv.template addVarInitParams<SynapseWUVarAdapter>(var.name, fieldSuffix);
+                    varInitEnv.template addVarInitDerivedParams<SynapseWUVarAdapter>(var.name, fieldSuffix);
+                    varInitEnv.addExtraGlobalParams(varInit.getSnippet()->getExtraGlobalParams(), var.name, fieldSuffix);
 
                     // Add read-write environment entry for variable
                     varInitEnv.add(resolvedType, "value", "_l" + var.name);
@@ -192,7 +213,7 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
         assert(!sg.getArchetype().getKernelSize().empty());
 
         // Add hidden fields with pointers to weight update model variables
-        synEnv.template addVarPointers<SynapseWUVarAdapter>("", true);
+        synEnv.template addVarPointers<SynapseWUVarAdapter>(fieldSuffix, true);
 
         // Loop through weight update model variables
         for(const auto &v : sg.getArchetype().getWUInitialiser().getSnippet()->getVars()) {
@@ -200,7 +221,7 @@ void applySynapseSubstitutions(const BackendBase &backend, EnvironmentExternalBa
             const auto resolvedType = v.type.resolve(sg.getTypeContext());
             
             // Add read-only accessors to de-reference pointers
-            const std::string var = "$(_" + v.name + ")[" + sg.getKernelVarIndex(batchSize, getVarAccessDim(v.access), "$(id_kernel)") + "]";
+            const std::string var = "$(_" + v.name + ")[" + fieldGroup.getKernelVarIndex(batchSize, getVarAccessDim(v.access), "$(id_kernel)") + "]";
             synEnv.add(resolvedType.addConst(), v.name, var);
 
             // If variable is read-write, also add function to add to it atomically
@@ -249,6 +270,25 @@ std::string SynapseGroupMergedBase::getPostDenDelayIndex(unsigned int batchSize,
 
     return "(((*$(_den_delay_ptr) + " + offset + ") % " + std::to_string(getArchetype().getMaxDendriticDelayTimesteps()) + ") * $(num_post)) + " + batchID;
 }
+//----------------------------------------------------------------------------
+std::string SynapseGroupMergedBase::getPostDenDelayWheelPush(const std::string &index) const
+{
+    const std::string maxEvents = std::to_string(getArchetype().getMaxDendriticDelayEvents());
+    const std::string bucket = "((*$(_den_delay_ptr) + $(1)) % " + std::to_string(getArchetype().getMaxDendriticDelayTimesteps()) + ")";
+    const std::string count = "$(_den_delay_wheel_count)[" + bucket + "]";
+    const std::string entry = "(" + bucket + " * " + maxEvents + ") + " + count;
+
+    // If bucket isn't full, write target and weight to next free entry and then increment count
+    // **NOTE** the comma operator sequences the increment after both writes
+    const std::string push = "($(_den_delay_wheel_target)[" + entry + "] = " + index + ", "
+                             "$(_den_delay_wheel_weight)[" + entry + "] = $(0), "
+                             + count + "++)";
+
+    // **NOTE** the current timestep's bucket has already been drained so undelayed events are added directly to outPost
+    // **NOTE** if bucket is full, event is dropped and counted in overflow counter so it can be reported by Runtime
+    return "((($(1)) == 0) ? ($(_out_post)[" + index + "] += $(0)) : "
+           "((" + count + " < " + maxEvents + ") ? " + push + " : $(_den_delay_wheel_overflow)[0]++))";
+}
 //--------------------------------------------------------------------------
 std::string SynapseGroupMergedBase::getPrePrevSpikeTimeIndex(bool delay, unsigned int batchSize, VarAccessDim varDims, const std::string &index) const
 {
@@ -387,23 +427,106 @@ boost::uuids::detail::sha1::digest_type SynapseGroupMergedBase::getHashDigest()
     return hash.get_digest();
 }
 
+//----------------------------------------------------------------------------
+// GeNN::CodeGenerator::PresynapticUpdateGroupMerged::SharedConnectivity
+//----------------------------------------------------------------------------
+void PresynapticUpdateGroupMerged::SharedConnectivity::generateSpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
+                                                                           PresynapticUpdateGroupMerged &sg, unsigned int batchSize, double dt)
+{
+    const std::string fieldSuffix = "SharedConn" + std::to_string(getIndex());
+
+    // Create new environment to add output fields to presynaptic update group
+    EnvironmentGroupMergedField<SharedConnectivity, PresynapticUpdateGroupMerged> outEnv(env, *this, sg);
+
+    // Add output buffer and redefine addToPost to target it rather than that of the traversed synapse group
+    outEnv.addField(getScalarType().createPointer(), "_out_post", "outPost" + fieldSuffix,
+                    [](auto &runtime, const auto &g, size_t){ return runtime.getArray(g.getFusedPSTarget(), "outPost"); });
+    outEnv.add(Type::getAddToPrePost(getScalarType()), "addToPost", 
+               backend.getAtomicOperation("&$(_out_post)[" + sg.getPostISynIndex(batchSize, "$(id_post)") + "]", "$(0)", getScalarType()));
+
+    outEnv.getStream() << "// shared connectivity synapse group " << getIndex() << std::endl;
+    applySynapseSubstitutions(backend, outEnv, getArchetype().getWUInitialiser().getPreSpikeSynCodeTokens(),
+                              "sim code", *this, sg, batchSize, dt, fieldSuffix);
+}
+//----------------------------------------------------------------------------
+void PresynapticUpdateGroupMerged::SharedConnectivity::updateHash(boost::uuids::detail::sha1 &hash) const
+{
+    updateParamHash([](const SynapseGroupInternal &g) { return g.getWUInitialiser().getParams(); }, hash);
+    updateParamHash([](const SynapseGroupInternal &g) { return g.getWUInitialiser().getDerivedParams(); }, hash);
+}
+
 //----------------------------------------------------------------------------
 // GeNN::CodeGenerator::PresynapticUpdateGroupMerged
 //----------------------------------------------------------------------------
 const std::string PresynapticUpdateGroupMerged::name = "PresynapticUpdate";
 //----------------------------------------------------------------------------
+PresynapticUpdateGroupMerged::PresynapticUpdateGroupMerged(size_t index, const Type::TypeContext &typeContext, 
+                                                           const std::vector<std::reference_wrapper<const SynapseGroupInternal>> &groups)
+:   SynapseGroupMergedBase(index, typeContext, groups)
+{
+    // Build vector of vectors containing each group's fused shared connectivity 
+    // synapse groups, sorted by digest so they match those of the archetype group
+    const size_t numShared = getArchetype().getFusedSharedConnectivitySyn().size();
+    std::vector<std::vector<std::reference_wrapper<const SynapseGroupInternal>>> sortedShared(numShared);
+    for(const auto &g : getGroups()) {
+        const auto &groupShared = g.get().getFusedSharedConnectivitySyn();
+        assert(groupShared.size() == numShared);
+
+        std::vector<std::pair<boost::uuids::detail::sha1::digest_type, const SynapseGroupInternal*>> sharedDigests;
+        std::transform(groupShared.cbegin(), groupShared.cend(), std::back_inserter(sharedDigests),
+                       [](const SynapseGroupInternal *s){ return std::make_pair(s->getWUHashDigest(), s); });
+        std::sort(sharedDigests.begin(), sharedDigests.end(),
+                  [](const auto &a, const auto &b) { return (a.first < b.first); });
+
+        for(size_t i = 0; i < numShared; i++) {
+            sortedShared[i].emplace_back(*sharedDigests[i].second);
+        }
+    }
+
+    // Create merged child groups
+    m_MergedSharedConnectivityGroups.reserve(numShared);
+    for(size_t i = 0; i < numShared; i++) {
+        m_MergedSharedConnectivityGroups.emplace_back(i, typeContext, sortedShared[i]);
+    }
+}
+//----------------------------------------------------------------------------
+boost::uuids::detail::sha1::digest_type PresynapticUpdateGroupMerged::getHashDigest() const
+{
+    boost::uuids::detail::sha1 hash;
+
+    // Update hash with base hash digest
+    Utils::updateHash(SynapseGroupMergedBase::getHashDigest(), hash);
+
+    // Update hash with child groups
+    for(const auto &s : getMergedSharedConnectivityGroups()) {
+        s.updateHash(hash);
+    }
+
+    return hash.get_digest();
+}
+//----------------------------------------------------------------------------
 void PresynapticUpdateGroupMerged::generateSpikeEventUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
                                                             unsigned int batchSize, double dt)
 {
     applySynapseSubstitutions(backend, env, getArchetype().getWUInitialiser().getPreEventSynCodeTokens(), 
-                              "presynaptic event code", *this, batchSize, dt);
+                              "presynaptic event code", *this, *this, batchSize, dt);
 }
 //----------------------------------------------------------------------------
 void PresynapticUpdateGroupMerged::generateSpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
                                                        unsigned int batchSize, double dt)
 {
     applySynapseSubstitutions(backend, env, getArchetype().getWUInitialiser().getPreSpikeSynCodeTokens(),
-                              "sim code", *this, batchSize, dt);
+                              "sim code", *this, *this, batchSize, dt);
+}
+//----------------------------------------------------------------------------
+void PresynapticUpdateGroupMerged::generateSharedConnectivitySpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
+                                                                         unsigned int batchSize, double dt)
+{
+    // Generate spike update for each child group in seperate scope so their local variables don't clash
+    for(auto &s : m_MergedSharedConnectivityGroups) {
+        CodeStream::Scope b(env.getStream());
+        s.generateSpikeUpdate(backend, env, *this, batchSize, dt);
+    }
 }
 //----------------------------------------------------------------------------
 void PresynapticUpdateGroupMerged::generateProceduralConnectivity(EnvironmentExternalBase &env)
@@ -449,14 +572,14 @@ void PostsynapticUpdateGroupMerged::generateSpikeEventUpdate(const BackendBase &
                                                              unsigned int batchSize, double dt)
 {
     applySynapseSubstitutions(backend, env, getArchetype().getWUInitialiser().getPostEventSynCodeTokens(),
-                              "postsynaptic event code", *this, batchSize, dt);
+                              "postsynaptic event code", *this, *this, batchSize, dt);
 }
 //----------------------------------------------------------------------------
 void PostsynapticUpdateGroupMerged::generateSpikeUpdate(const BackendBase &backend, EnvironmentExternalBase &env, 
                                                         unsigned int batchSize, double dt)
 {
     applySynapseSubstitutions(backend, env, getArchetype().getWUInitialiser().getPostSpikeSynCodeTokens(), 
-                              "learn post code", *this, batchSize, dt);
+                              "learn post code", *this, *this, batchSize, dt);
 }
 
 //----------------------------------------------------------------------------
@@ -468,7 +591,7 @@ void SynapseDynamicsGroupMerged::generateSynapseUpdate(const BackendBase &backen
                                                        unsigned int batchSize, double dt)
 {
     applySynapseSubstitutions(backend, env, getArchetype().getWUInitialiser().getSynapseDynamicsCodeTokens(), 
-                              "synapse dynamics", *this, batchSize, dt);
+                              "synapse dynamics", *this, *this, batchSize, dt);
 }
 
 
@@ -480,4 +603,19 @@ const std::string SynapseDendriticDelayUpdateGroupMerged::name = "SynapseDendrit
 void SynapseDendriticDelayUpdateGroupMerged::generateSynapseUpdate(EnvironmentExternalBase &env)
 {
     env.printLine("*$(_den_delay_ptr) = (*$(_den_delay_ptr) + 1) % " + std::to_string(getArchetype().getMaxDendriticDelayTimesteps()) + ";");
+
+    // If dendritic delays are implemented using a timing wheel, 
+    // drain events from this timestep's bucket into outPost
+    if(getArchetype().isDendriticDelayWheelEnabled()) {
+        const std::string maxEvents = std::to_string(getArchetype().getMaxDendriticDelayEvents());
+        env.printLine("const unsigned int denDelayBucket = *$(_den_delay_ptr);");
+        env.printLine("const unsigned int denDelayBucketStart = denDelayBucket * " + maxEvents + ";");
+        env.printLine("const unsigned int denDelayBucketEnd = denDelayBucketStart + $(_den_delay_wheel_count)[denDelayBucket];");
+        env.getStream() << "for(unsigned int i = denDelayBucketStart; i < denDelayBucketEnd; i++)";
+        {
+            CodeStream::Scope b(env.getStream());
+            env.printLine("$(_out_post)[$(_den_delay_wheel_target)[i]] += $(_den_delay_wheel_weight)[i];");
+        }
+        env.printLine("$(_den_delay_wheel_count)[denDelayBucket] = 0;");
+    }
 }
\ No newline at end of file
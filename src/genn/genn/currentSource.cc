@@ -52,6 +52,18 @@ void CurrentSource::setTargetVar(const std::string &varName)
     }
 }
 //----------------------------------------------------------------------------
+void CurrentSource::setVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval)
+{
+    const auto var = getModel()->getVar(varName);
+    if(!var) {
+        throw std::runtime_error("Unknown current source model variable '" + varName + "'");
+    }
+    if(!(getVarAccessDim(var->access) & VarAccessDim::ELEMENT)) {
+        throw std::runtime_error("Cannot record trace of shared current source model variable '" + varName + "'");
+    }
+    m_VarTraces.set(varName, neuronIDs, interval, getTrgNeuronGroup()->getNumNeurons());
+}
+//----------------------------------------------------------------------------
 CurrentSource::CurrentSource(const std::string &name, const CurrentSourceModels::Base *model,
                              const std::map<std::string, Type::NumericValue> &params, const std::map<std::string, InitVarSnippet::Init> &varInitialisers,
                              const std::map<std::string, std::variant<std::string, Models::VarReference>> &neuronVarReferences, 
@@ -97,6 +109,16 @@ void CurrentSource::finalise(double dt)
     }
 }
 //----------------------------------------------------------------------------
+void CurrentSource::demoteConstantReadOnlyVars()
+{
+    // **NOTE** variables which are referenced or traced need arrays
+    std::set<std::string> excludedVars(m_ReferencedVars);
+    for(const auto &t : getVarTraces()) {
+        excludedVars.insert(t.first);
+    }
+    m_DemotedVars = Models::getConstantReadOnlyVars(getModel()->getVars(), getVarInitialisers(), excludedVars);
+}
+//----------------------------------------------------------------------------
 bool CurrentSource::isZeroCopyEnabled() const
 {
     // If there are any variables implemented in zero-copy mode return true
@@ -120,6 +142,12 @@ boost::uuids::detail::sha1::digest_type CurrentSource::getHashDigest(const Neuro
     Utils::updateHash(getModel()->getHashDigest(), hash);
     Utils::updateHash(getTargetVar(), hash);
     m_DynamicParams.updateHash(hash);
+    m_VarTraces.updateHash(hash);
+
+    // **NOTE** so the hashes of current sources without demoted variables are unchanged, only hash if there are any
+    if(!m_DemotedVars.empty()) {
+        Utils::updateHash(m_DemotedVars, hash);
+    }
 
     // Loop through neuron variable references and update hash with 
     // name of target variable. These must be the same across merged group
@@ -136,6 +164,9 @@ boost::uuids::detail::sha1::digest_type CurrentSource::getInitHashDigest(const N
 
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getModel()->getVars(), hash);
+    if(!m_DemotedVars.empty()) {
+        Utils::updateHash(m_DemotedVars, hash);
+    }
 
     // Include variable initialiser hashes
     for(const auto &w : getVarInitialisers()) {
@@ -11,6 +11,7 @@ namespace GeNN::CurrentSourceModels
 IMPLEMENT_SNIPPET(DC);
 IMPLEMENT_SNIPPET(GaussianNoise);
 IMPLEMENT_SNIPPET(PoissonExp);
+IMPLEMENT_SNIPPET(AggregatedPoissonExp);
 
 //----------------------------------------------------------------------------
 // GeNN::CurrentSourceModels::Base
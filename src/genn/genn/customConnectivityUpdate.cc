@@ -134,10 +134,19 @@ CustomConnectivityUpdate::CustomConnectivityUpdate(const std::string &name, cons
                                              "Custom connectivity update '" + getName() + "' host update code");
 
     // Give error if synapse group has unsupported connectivity type
+    // **NOTE** AUTO matrix types are only resolved when model is finalised
+    if(getSynapseGroup()->getMatrixType() == SynapseMatrixType::AUTO) {
+        throw std::runtime_error("Custom connectivity updates cannot be attached to synapse groups with AUTO matrix type.");
+    }
     if (!(getSynapseGroup()->getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
         throw std::runtime_error("Custom connectivity updates can only be attached to synapse groups with SPARSE connectivity.");
     }
 
+    // Give error if synapse group has lazily-decayed variables as their update times would not be moved with synapses
+    if(!getSynapseGroup()->getWUInitialiser().getSnippet()->getLazyDecayVars().empty()) {
+        throw std::runtime_error("Custom connectivity updates cannot be attached to synapse groups whose weight update model has lazily-decayed variables.");
+    }
+
     // Check variable reference types
     Models::checkVarReferenceTypes(m_VarReferences, getModel()->getVarRefs());
     Models::checkVarReferenceTypes(m_PreVarReferences, getModel()->getPreVarRefs());
@@ -297,6 +306,8 @@ boost::uuids::detail::sha1::digest_type CustomConnectivityUpdate::getHashDigest(
 
     Utils::updateHash(getSynapseMatrixConnectivity(getSynapseGroup()->getMatrixType()), hash);
     Type::updateHash(getSynapseGroup()->getSparseIndType(), hash);
+    Utils::updateHash(getSynapseGroup()->isRowCapacityGrowable(), hash);
+    Utils::updateHash(getSynapseGroup()->isPostSpikeRequired() || getSynapseGroup()->isPostSpikeEventRequired(), hash);
     m_DynamicParams.updateHash(hash);
 
     // Because it adds and removes synapses, connectivity update has to update 
@@ -343,6 +354,7 @@ boost::uuids::detail::sha1::digest_type CustomConnectivityUpdate::getRemapHashDi
 
     Utils::updateHash(getSynapseMatrixConnectivity(getSynapseGroup()->getMatrixType()), hash);
     Type::updateHash(getSynapseGroup()->getSparseIndType(), hash);
+    Utils::updateHash(getSynapseGroup()->isRowCapacityGrowable(), hash);
     
 
     return hash.get_digest();
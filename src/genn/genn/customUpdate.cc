@@ -370,6 +370,7 @@ boost::uuids::detail::sha1::digest_type CustomUpdateWU::getHashDigest() const
 
     Utils::updateHash(getSynapseMatrixConnectivity(getSynapseGroup()->getMatrixType()), hash);
     Type::updateHash(getSynapseGroup()->getSparseIndType(), hash);
+    Utils::updateHash(getSynapseGroup()->isRowCapacityGrowable(), hash);
 
     // Loop through variable references
     for(const auto &v : getVarReferences()) {
@@ -391,6 +392,7 @@ boost::uuids::detail::sha1::digest_type CustomUpdateWU::getInitHashDigest() cons
 
     Utils::updateHash(getSynapseMatrixConnectivity(getSynapseGroup()->getMatrixType()), hash);
     Type::updateHash(getSynapseGroup()->getSparseIndType(), hash);
+    Utils::updateHash(getSynapseGroup()->isRowCapacityGrowable(), hash);
     return hash.get_digest();
 }
 }   // namespace GeNN
@@ -29,7 +29,8 @@ const std::unordered_set<std::string> randomFuncs{
     "gennrand_exponential",
     "gennrand_log_normal",
     "gennrand_gamma",
-    "gennrand_binomial"};
+    "gennrand_binomial",
+    "gennrand_poisson"};
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
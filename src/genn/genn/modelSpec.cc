@@ -14,6 +14,7 @@
 --------------------------------------------------------------------------*/
 // Standard C++ includes
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <typeinfo>
 
@@ -102,10 +103,11 @@ std::vector<G*> getSortedCustomUpdates(std::map<std::string, G> &customUpdates)
 namespace GeNN
 {
 ModelSpec::ModelSpec()
-:   m_Precision(Type::Float), m_TimePrecision(std::nullopt), m_DT(0.5), m_TimingEnabled(false), m_Seed(0),
+:   m_Precision(Type::Float), m_TimePrecision(std::nullopt), m_DT(0.5), m_TimingEnabled(false), m_ProfilingEnabled(false), m_ApproximateMathsEnabled(false), m_Seed(0),
     m_DefaultVarLocation(VarLocation::HOST_DEVICE), m_DefaultExtraGlobalParamLocation(VarLocation::HOST_DEVICE),
     m_DefaultSparseConnectivityLocation(VarLocation::HOST_DEVICE), m_DefaultNarrowSparseIndEnabled(false),
-    m_FusePostsynapticModels(false), m_FusePrePostWeightUpdateModels(false), m_BatchSize(1)
+    m_FusePostsynapticModels(false), m_FusePrePostWeightUpdateModels(false), m_DemoteConstantReadOnlyVars(false), m_BatchSize(1),
+    m_AutoMatrixMemoryBudget(std::numeric_limits<size_t>::max())
 {
 }
 // ---------------------------------------------------------------------------
@@ -319,7 +321,7 @@ CustomUpdateWU *ModelSpec::addCustomUpdate(const std::string &name, const std::s
     }
 }
 // ---------------------------------------------------------------------------
-void ModelSpec::finalise()
+void ModelSpec::finalise(const std::function<bool(SynapseMatrixType)> &isMatrixTypeSupported)
 {
     // Build type context
     m_TypeContext = {{"scalar", getPrecision()}, {"timepoint", getTimePrecision()}};
@@ -339,6 +341,15 @@ void ModelSpec::finalise()
         LOGD_GENN << "\t" << c->getName();
     }
 
+    // Resolve matrix types of synapse groups with AUTO matrix types
+    // **NOTE** needs to be first as so much depends on matrix type
+    size_t autoMatrixMemoryBudget = m_AutoMatrixMemoryBudget;
+    for(auto &s : m_LocalSynapseGroups) {
+        if(s.second.getMatrixType() == SynapseMatrixType::AUTO) {
+            s.second.resolveAutoMatrixType(m_TypeContext, isMatrixTypeSupported, autoMatrixMemoryBudget);
+        }
+    }
+
     // Finalise neuron groups
     for(auto &n : m_LocalNeuronGroups) {
         n.second.finalise(m_DT);
@@ -346,7 +357,7 @@ void ModelSpec::finalise()
 
     // Finalise synapse groups
     for(auto &s : m_LocalSynapseGroups) {
-        s.second.finalise(m_DT);
+        s.second.finalise(m_DT, m_BatchSize);
     }
 
     // Finalise current sources
@@ -374,6 +385,46 @@ void ModelSpec::finalise()
         c.second.finalise(m_DT, m_BatchSize);
     }
 
+    // Validate synapse groups which share connectivity and register those whose
+    // presynaptic spike processing can be fused with the synapse group they share it with
+    // **NOTE** needs to be after custom connectivity updates are finalised so references to synapse groups are known
+    for(auto &s : m_LocalSynapseGroups) {
+        const auto *sharedTarget = s.second.getSharedConnectivityTarget();
+        if(sharedTarget == nullptr) {
+            continue;
+        }
+
+        auto &target = m_LocalSynapseGroups.at(sharedTarget->getName());
+        if(target.getSharedConnectivityTarget() != nullptr) {
+            throw std::runtime_error("Synapse group '" + s.first + "' shares connectivity with synapse group '"
+                                     + target.getName() + "' which itself shares connectivity with another synapse group");
+        }
+        if(!s.second.getCustomConnectivityUpdateReferences().empty() || !target.getCustomConnectivityUpdateReferences().empty()) {
+            throw std::runtime_error("Synapse group '" + s.first + "' shares connectivity so neither it nor synapse group '"
+                                     + target.getName() + "' can be referenced by custom connectivity updates");
+        }
+
+        if(s.second.isSharedConnectivityPreSpikeFused()) {
+            target.addFusedSharedConnectivitySyn(&s.second);
+        }
+    }
+
+    // If enabled, demote constant read-only variables to constants
+    // **NOTE** needs to be after everything else is finalised so all variable 
+    // references are known and which variables are delayed has been established
+    // and before postsynaptic models are fused so demoted variables are included in fuse hashes
+    if(m_DemoteConstantReadOnlyVars) {
+        for(auto &n : m_LocalNeuronGroups) {
+            n.second.demoteConstantReadOnlyVars();
+        }
+        for(auto &s : m_LocalSynapseGroups) {
+            s.second.demoteConstantReadOnlyPSVars();
+        }
+        for(auto &cs : m_LocalCurrentSources) {
+            cs.second.demoteConstantReadOnlyVars();
+        }
+    }
+
     // Merge incoming postsynaptic models
     for(auto &n : m_LocalNeuronGroups) {
         n.second.fusePrePostSynapses(m_FusePostsynapticModels, m_FusePrePostWeightUpdateModels);
@@ -442,6 +493,8 @@ boost::uuids::detail::sha1::digest_type ModelSpec::getHashDigest() const
     Type::updateHash(getTimePrecision(), hash);
     Utils::updateHash(getDT(), hash);
     Utils::updateHash(isTimingEnabled(), hash);
+    Utils::updateHash(isProfilingEnabled(), hash);
+    Utils::updateHash(isApproximateMathsEnabled(), hash);
     Utils::updateHash(getBatchSize(), hash);
     Utils::updateHash(getSeed(), hash);
 
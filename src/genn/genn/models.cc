@@ -1,5 +1,8 @@
 #include "models.h"
 
+// Standard C++ includes
+#include <algorithm>
+
 // GeNN includes
 #include "customConnectivityUpdateInternal.h"
 #include "customUpdateInternal.h"
@@ -13,6 +16,22 @@
 // GeNN runtime includes
 #include "runtime/runtime.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+void checkNotLazilyDecayed(const GeNN::WeightUpdateModels::Base *wum, const std::string &varName)
+{
+    const auto lazyDecayVars = wum->getLazyDecayVars();
+    if(std::any_of(lazyDecayVars.cbegin(), lazyDecayVars.cend(), 
+                   [&varName](const auto &l){ return l.first == varName; }))
+    {
+        throw std::runtime_error("Lazily-decayed variable '" + varName + "' cannot be referenced");
+    }
+}
+}   // Anonymous namespace
+
 //----------------------------------------------------------------------------
 // GeNN::Models::Base::EGPRef
 //----------------------------------------------------------------------------
@@ -239,7 +258,11 @@ VarReference VarReference::createVarRef(NeuronGroup *ng, const std::string &varN
 {
     const auto *nm = ng->getModel();
     try {
-        return VarReference(NGRef{static_cast<NeuronGroupInternal*>(ng), nm->getVar(varName).value()});
+        auto ref = VarReference(NGRef{static_cast<NeuronGroupInternal*>(ng), nm->getVar(varName).value()});
+
+        // Mark variable as referenced so it can't be demoted to a constant
+        static_cast<NeuronGroupInternal*>(ng)->setVarReferenced(varName);
+        return ref;
     }
     catch(std::bad_optional_access&) {
         throw std::runtime_error("Variable '" + varName + "' not found");
@@ -250,7 +273,11 @@ VarReference VarReference::createVarRef(CurrentSource *cs, const std::string &va
 {
     const auto *csm = cs->getModel();
     try {
-        return VarReference(CSRef{static_cast<CurrentSourceInternal*>(cs), csm->getVar(varName).value()});
+        auto ref = VarReference(CSRef{static_cast<CurrentSourceInternal*>(cs), csm->getVar(varName).value()});
+
+        // Mark variable as referenced so it can't be demoted to a constant
+        static_cast<CurrentSourceInternal*>(cs)->setVarReferenced(varName);
+        return ref;
     }
     catch(std::bad_optional_access&) {
         throw std::runtime_error("Variable '" + varName + "' not found");
@@ -294,7 +321,11 @@ VarReference VarReference::createPSMVarRef(SynapseGroup *sg, const std::string &
 {
     const auto *psm = sg->getPSInitialiser().getSnippet();
     try {
-        return VarReference(PSMRef{static_cast<SynapseGroupInternal*>(sg), psm->getVar(varName).value()});
+        auto ref = VarReference(PSMRef{static_cast<SynapseGroupInternal*>(sg), psm->getVar(varName).value()});
+
+        // Mark variable as referenced so it can't be demoted to a constant
+        static_cast<SynapseGroupInternal*>(sg)->setPSVarReferenced(varName);
+        return ref;
     }
     catch(std::bad_optional_access&) {
         throw std::runtime_error("Variable '" + varName + "' not found");
@@ -333,6 +364,9 @@ VarReference VarReference::createDenDelayVarRef(SynapseGroup *sg)
 {
     auto *sgInternal = static_cast<SynapseGroupInternal*>(sg);
     if(sgInternal->isDendriticOutputDelayRequired()) {
+        if(sgInternal->isDendriticDelayWheelEnabled()) {
+            throw std::runtime_error("Dendritic delays of synapse group '" + sg->getName() + "' are implemented using a sparse timing wheel which cannot be referenced");
+        }
         return VarReference(InternalSGRef{sgInternal, InternalSGRef::Type::DEN_DELAY});
     }
     else {
@@ -511,8 +545,12 @@ WUVarReference WUVarReference::createWUVarReference(SynapseGroup *sg, const std:
     
     const auto var = wum->getVar(varName);
     if(var) {
+        // Lazily-decayed variables are only correct at the time each synapse was last updated so can't be referenced
+        checkNotLazilyDecayed(wum, varName);
+
         if(transposeSG) {
             const auto *transposeWUM = transposeSG->getWUInitialiser().getSnippet();
+            checkNotLazilyDecayed(transposeWUM, transposeVarName);
             try {
                 return WUVarReference(WURef{sgInternal, static_cast<SynapseGroupInternal*>(transposeSG),
                                             var.value(), transposeWUM->getVar(transposeVarName).value()});
@@ -556,7 +594,11 @@ WUVarReference::WUVarReference(const DetailType &detail)
 :   m_Detail(detail)
 {
     // Check matrix types
+    // **NOTE** AUTO matrix types are only resolved when model is finalised
     auto *sg = getSynapseGroupInternal();
+    if(sg->getMatrixType() == SynapseMatrixType::AUTO) {
+        throw std::runtime_error("Weight update variables of synapse groups with AUTO matrix type cannot be referenced.");
+    }
     if(!(sg->getMatrixType() & SynapseMatrixWeight::INDIVIDUAL) && !(sg->getMatrixType() & SynapseMatrixWeight::KERNEL)) {
         throw std::runtime_error("Only INDIVIDUAL or KERNEL weight update variables can be referenced.");
     }
@@ -807,4 +849,19 @@ void checkEGPReferenceTypes(const std::map<std::string, EGPReference> &egpRefs,
         }
     }
 }
+//----------------------------------------------------------------------------
+std::set<std::string> getConstantReadOnlyVars(const std::vector<Base::Var> &vars,
+                                              const std::map<std::string, InitVarSnippet::Init> &varInitialisers,
+                                              const std::set<std::string> &excludedVars)
+{
+    std::set<std::string> constantVars;
+    for(const auto &v : vars) {
+        if((getVarAccessMode(v.access) == VarAccessMode::READ_ONLY) && (excludedVars.count(v.name) == 0)
+           && (varInitialisers.at(v.name).getSnippet() == InitVarSnippet::Constant::getInstance()))
+        {
+            constantVars.insert(v.name);
+        }
+    }
+    return constantVars;
+}
 }   // namespace GeNN::Models
@@ -126,8 +126,42 @@ void NeuronGroup::setParamDynamic(const std::string &paramName, bool dynamic)
     m_DynamicParams.set(paramName, dynamic); 
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::setSpikeRateTau(double tau)
+{
+    if(tau < 0.0) {
+        throw std::runtime_error("Spike rate time constant for neuron group '" + getName() + "' must be positive");
+    }
+    m_SpikeRateTau = tau;
+}
+//----------------------------------------------------------------------------
+void NeuronGroup::setISIHistogram(unsigned int numBins, double binWidth)
+{
+    if(binWidth <= 0.0) {
+        throw std::runtime_error("ISI histogram bin width for neuron group '" + getName() + "' must be positive");
+    }
+    m_ISIHistogramNumBins = numBins;
+    m_ISIHistogramBinWidth = binWidth;
+}
+//----------------------------------------------------------------------------
+void NeuronGroup::setVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval)
+{
+    const auto var = getModel()->getVar(varName);
+    if(!var) {
+        throw std::runtime_error("Unknown neuron model variable '" + varName + "'");
+    }
+    if(!(getVarAccessDim(var->access) & VarAccessDim::ELEMENT)) {
+        throw std::runtime_error("Cannot record trace of shared neuron model variable '" + varName + "'");
+    }
+    m_VarTraces.set(varName, neuronIDs, interval, getNumNeurons());
+}
+//----------------------------------------------------------------------------
 bool NeuronGroup::isSpikeTimeRequired() const
 {
+    // If inter-spike interval histogram is enabled, return true
+    if(isISIHistogramEnabled()) {
+        return true;
+    }
+
     // If spike time is referenced in neuron code strings, return true
     if(Utils::isIdentifierReferenced("st", getSimCodeTokens())
        || Utils::isIdentifierReferenced("st", getThresholdConditionCodeTokens())
@@ -265,6 +299,21 @@ bool NeuronGroup::isRecordingEnabled() const
     if(m_SpikeEventRecordingEnabled) {
         return true;
     }
+
+    // Return true if spike count recording is enabled
+    if(m_SpikeCountRecordingEnabled) {
+        return true;
+    }
+
+    // Return true if any neuron, current source or postsynaptic model variables are being traced
+    if(!m_VarTraces.empty()
+       || std::any_of(getCurrentSources().cbegin(), getCurrentSources().cend(),
+                      [](const CurrentSourceInternal *cs){ return !cs->getVarTraces().empty(); })
+       || std::any_of(getInSyn().cbegin(), getInSyn().cend(),
+                      [](const SynapseGroupInternal *sg){ return !sg->getPSVarTraces().empty(); }))
+    {
+        return true;
+    }
     else {
         return false;
     }
@@ -390,14 +439,16 @@ NeuronGroup::NeuronGroup(const std::string &name, int numNeurons, const NeuronMo
     m_NumDelaySlots(1), m_SpikeQueueRequired(false), m_SpikeEventQueueRequired(false), m_RecordingZeroCopyEnabled(false),
     m_SpikeLocation(defaultVarLocation), m_SpikeEventLocation(defaultVarLocation), m_SpikeTimeLocation(defaultVarLocation), 
     m_PrevSpikeTimeLocation(defaultVarLocation), m_SpikeEventTimeLocation(defaultVarLocation), m_PrevSpikeEventTimeLocation(defaultVarLocation), 
-    m_VarLocation(defaultVarLocation), m_ExtraGlobalParamLocation(defaultExtraGlobalParamLocation), m_SpikeRecordingEnabled(false), m_SpikeEventRecordingEnabled(false)
+    m_VarLocation(defaultVarLocation), m_ExtraGlobalParamLocation(defaultExtraGlobalParamLocation), m_SpikeRecordingEnabled(false), m_SpikeEventRecordingEnabled(false),
+    m_SpikeCountRecordingEnabled(false), m_SpikeRateTau(0.0), m_ISIHistogramNumBins(0), m_ISIHistogramBinWidth(1.0), m_ApproximateMathsEnabled(false)
 {
     // Validate names
     Utils::validatePopName(name, "Neuron group");
     getModel()->validate(getParams(), getVarInitialisers(), "Neuron group " + getName());
 
      // Scan neuron model code strings
-    m_SimCodeTokens = Utils::scanCode(getModel()->getSimCode(), 
+    // **NOTE** code to integrate any dynamics declared by the model is prepended to the sim code
+    m_SimCodeTokens = Utils::scanCode(getModel()->getDynamicsCode() + getModel()->getSimCode(), 
                                       "Neuron group '" + getName() + "' sim code");
     m_ThresholdConditionCodeTokens = Utils::scanCode(getModel()->getThresholdConditionCode(),
                                                      "Neuron group '" + getName() + "' threshold condition code");
@@ -421,12 +472,28 @@ void NeuronGroup::finalise(double dt)
         m_DerivedParams.emplace(d.name, d.func(m_Params, dt));
     }
 
+    // Calculate propagators of any linear dynamics
+    for(const auto &d : getModel()->getLinearDynamicsDerivedParams()) {
+        m_DerivedParams.emplace(d.name, d.func(m_Params, dt));
+    }
+
     // Finalise variable initialisers
     for(auto &v : m_VarInitialisers) {
         v.second.finalise(dt);
     }
 }
 //----------------------------------------------------------------------------
+void NeuronGroup::demoteConstantReadOnlyVars()
+{
+    // **NOTE** variables which are referenced, delayed or traced need arrays
+    std::set<std::string> excludedVars(m_ReferencedVars);
+    excludedVars.insert(m_VarQueueRequired.cbegin(), m_VarQueueRequired.cend());
+    for(const auto &t : getVarTraces()) {
+        excludedVars.insert(t.first);
+    }
+    m_DemotedVars = Models::getConstantReadOnlyVars(getModel()->getVars(), getVarInitialisers(), excludedVars);
+}
+//----------------------------------------------------------------------------
 void NeuronGroup::fusePrePostSynapses(bool fusePSM, bool fusePrePostWUM)
 {
     // If there are any incoming synapse groups
@@ -569,12 +636,27 @@ boost::uuids::detail::sha1::digest_type NeuronGroup::getHashDigest() const
     Utils::updateHash(isTrueSpikeRequired(), hash);
     Utils::updateHash(isSpikeRecordingEnabled(), hash);
     Utils::updateHash(isSpikeEventRecordingEnabled(), hash);
+    Utils::updateHash(isSpikeCountRecordingEnabled(), hash);
+    Utils::updateHash(getSpikeRateTau(), hash);
+    Utils::updateHash(getISIHistogramNumBins(), hash);
+    Utils::updateHash(getISIHistogramBinWidth(), hash);
+    m_VarTraces.updateHash(hash);
+
+    // **NOTE** so the hashes of groups not using approximate maths are unchanged, only hash if enabled
+    if(isApproximateMathsEnabled()) {
+        Utils::updateHash(true, hash);
+    }
     Utils::updateHash(getNumDelaySlots(), hash);
     Utils::updateHash(m_VarQueueRequired, hash);
     Utils::updateHash(isSpikeQueueRequired(), hash);
     Utils::updateHash(isSpikeEventQueueRequired(), hash);
     m_DynamicParams.updateHash(hash);
 
+    // **NOTE** so the hashes of groups without demoted variables are unchanged, only hash if there are any
+    if(!m_DemotedVars.empty()) {
+        Utils::updateHash(m_DemotedVars, hash);
+    }
+
     // Update hash with number of fused spike conditions
     // **NOTE** nothing else is required as logic of each update only depends on number of delay slots
     Utils::updateHash(getFusedSpike().size(), hash);
@@ -610,11 +692,16 @@ boost::uuids::detail::sha1::digest_type NeuronGroup::getInitHashDigest() const
     Utils::updateHash(isSpikeEventRequired(), hash);
     Utils::updateHash(isTrueSpikeRequired(), hash);
     Utils::updateHash(isSimRNGRequired(), hash);
+    Utils::updateHash(isSpikeRateEstimationEnabled(), hash);
+    Utils::updateHash(getISIHistogramNumBins(), hash);
     Utils::updateHash(getNumDelaySlots(), hash);
     Utils::updateHash(m_VarQueueRequired, hash);
     Utils::updateHash(isSpikeQueueRequired(), hash);
     Utils::updateHash(isSpikeEventQueueRequired(), hash);
     Utils::updateHash(getModel()->getVars(), hash);
+    if(!m_DemotedVars.empty()) {
+        Utils::updateHash(m_DemotedVars, hash);
+    }
 
     // Include variable initialiser hashes
     for(const auto &n : getVarInitialisers()) {
@@ -1,10 +1,100 @@
 #include "neuronModels.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <sstream>
+
 // GeNN includes
 #include "gennUtils.h"
 
 using namespace GeNN;
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+// Calculate exponential of dense, row-major n*n matrix using scaling and squaring
+std::vector<double> calcMatrixExponential(std::vector<double> m, size_t n)
+{
+    // Calculate infinity norm of matrix
+    double norm = 0.0;
+    for(size_t i = 0; i < n; i++) {
+        double rowSum = 0.0;
+        for(size_t j = 0; j < n; j++) {
+            rowSum += std::abs(m[(i * n) + j]);
+        }
+        norm = std::max(norm, rowSum);
+    }
+
+    // Scale matrix so its norm is below 0.5, where Taylor series converges rapidly
+    const int numSquarings = (norm > 0.5) ? static_cast<int>(std::ceil(std::log2(norm / 0.5))) : 0;
+    const double scale = std::ldexp(1.0, -numSquarings);
+    for(auto &v : m) {
+        v *= scale;
+    }
+
+    // Helper to multiply two matrices
+    auto multiply = 
+        [n](const std::vector<double> &a, const std::vector<double> &b)
+        {
+            std::vector<double> c(n * n, 0.0);
+            for(size_t i = 0; i < n; i++) {
+                for(size_t k = 0; k < n; k++) {
+                    for(size_t j = 0; j < n; j++) {
+                        c[(i * n) + j] += a[(i * n) + k] * b[(k * n) + j];
+                    }
+                }
+            }
+            return c;
+        };
+
+    // Sum Taylor series, starting from identity
+    std::vector<double> result(n * n, 0.0);
+    for(size_t i = 0; i < n; i++) {
+        result[(i * n) + i] = 1.0;
+    }
+    std::vector<double> term = result;
+    for(int k = 1; k <= 20; k++) {
+        term = multiply(term, m);
+        for(size_t i = 0; i < (n * n); i++) {
+            term[i] /= k;
+            result[i] += term[i];
+        }
+    }
+
+    // Undo scaling by repeatedly squaring
+    for(int s = 0; s < numSquarings; s++) {
+        result = multiply(result, result);
+    }
+    return result;
+}
+//----------------------------------------------------------------------------
+// Calculate propagators of linear dynamics
+/*! The augmented matrix [[A, I], [0, 0]] * dt is exponentiated giving [[P, Q], [0, I]] where 
+    P = exp(A * dt) advances the state and Q = integral of exp(A * s) from 0 to dt applies inputs */
+std::vector<double> calcLinearPropagators(const NeuronModels::Base::LinearDynamics &linearDynamics,
+                                          const ParamValues &params, double dt)
+{
+    const size_t n = linearDynamics.vars.size();
+    const auto coefficients = linearDynamics.coefficients(params, dt);
+    if(coefficients.size() != (n * n)) {
+        throw std::runtime_error("Linear dynamics coefficient function returned " + std::to_string(coefficients.size()) 
+                                 + " coefficients but " + std::to_string(n * n) + " are required");
+    }
+
+    // Build augmented matrix
+    std::vector<double> augmented(4 * n * n, 0.0);
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            augmented[(i * 2 * n) + j] = coefficients[(i * n) + j] * dt;
+        }
+        augmented[(i * 2 * n) + n + i] = dt;
+    }
+    return calcMatrixExponential(augmented, 2 * n);
+}
+}   // Anonymous namespace
+
 namespace GeNN::NeuronModels
 {
 // Implement models
@@ -30,9 +120,134 @@ boost::uuids::detail::sha1::digest_type Base::getHashDigest() const
     Utils::updateHash(getResetCode(), hash);
     Utils::updateHash(isAutoRefractoryRequired(), hash);
     Utils::updateHash(getAdditionalInputVars(), hash);
+
+    // **NOTE** coefficient function can't be hashed but propagators are derived parameters
+    const auto linearDynamics = getLinearDynamics();
+    Utils::updateHash(linearDynamics.vars, hash);
+    Utils::updateHash(linearDynamics.inputs, hash);
+
+    for(const auto &o : getNonlinearDynamics()) {
+        Utils::updateHash(o.var, hash);
+        Utils::updateHash(o.derivative, hash);
+    }
+    Utils::updateHash(getNumNonlinearDynamicsSubsteps(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
+Snippet::Base::DerivedParamVec Base::getLinearDynamicsDerivedParams() const
+{
+    // Add derived parameters for each element of P and for 
+    // the elements of Q corresponding to non-empty inputs
+    const auto linearDynamics = getLinearDynamics();
+    const size_t n = linearDynamics.vars.size();
+    DerivedParamVec derivedParams;
+    for(size_t i = 0; i < n; i++) {
+        for(size_t j = 0; j < n; j++) {
+            derivedParams.emplace_back("linP" + std::to_string(i) + "_" + std::to_string(j),
+                                       [linearDynamics, n, i, j](const ParamValues &pars, double dt)
+                                       {
+                                           return calcLinearPropagators(linearDynamics, pars, dt).at((i * 2 * n) + j);
+                                       });
+            if(!linearDynamics.inputs.at(j).empty()) {
+                derivedParams.emplace_back("linQ" + std::to_string(i) + "_" + std::to_string(j),
+                                           [linearDynamics, n, i, j](const ParamValues &pars, double dt)
+                                           {
+                                               return calcLinearPropagators(linearDynamics, pars, dt).at((i * 2 * n) + n + j);
+                                           });
+            }
+        }
+    }
+    return derivedParams;
+}
+//----------------------------------------------------------------------------
+std::string Base::getDynamicsCode() const
+{
+    // **NOTE** code is generated on a single line so line numbers in errors still match sim code
+    std::ostringstream code;
+
+    // If there are any linear dynamics
+    const auto linearDynamics = getLinearDynamics();
+    const size_t n = linearDynamics.vars.size();
+    if(n > 0) {
+        code << "{ ";
+
+        // Evaluate inputs
+        for(size_t j = 0; j < n; j++) {
+            if(!linearDynamics.inputs[j].empty()) {
+                code << "const scalar linB" << j << " = " << linearDynamics.inputs[j] << "; ";
+            }
+        }
+
+        // Apply propagators to state and inputs
+        for(size_t i = 0; i < n; i++) {
+            code << "const scalar linX" << i << " = ";
+            for(size_t j = 0; j < n; j++) {
+                code << ((j == 0) ? "" : " + ") << "(linP" << i << "_" << j << " * " << linearDynamics.vars[j] << ")";
+                if(!linearDynamics.inputs[j].empty()) {
+                    code << " + (linQ" << i << "_" << j << " * linB" << j << ")";
+                }
+            }
+            code << "; ";
+        }
+
+        // Write back state
+        for(size_t i = 0; i < n; i++) {
+            code << linearDynamics.vars[i] << " = linX" << i << "; ";
+        }
+        code << "} ";
+    }
+
+    // If there are any nonlinear dynamics
+    const auto nonlinearDynamics = getNonlinearDynamics();
+    if(!nonlinearDynamics.empty()) {
+        const unsigned int numSubsteps = getNumNonlinearDynamicsSubsteps();
+        code << "{ const scalar rkH = dt / " << numSubsteps << ".0; ";
+        if(numSubsteps > 1) {
+            code << "for(int rkStep = 0; rkStep < " << numSubsteps << "; rkStep++) { ";
+        }
+
+        // Loop through Runge-Kutta stages
+        const std::array<const char*, 3> stageScale{"0.5", "0.5", "1.0"};
+        for(size_t s = 0; s < 4; s++) {
+            // Evaluate derivatives for this stage in a scope where each variable 
+            // is shadowed by its intermediate value (apart from in the first stage)
+            for(size_t i = 0; i < nonlinearDynamics.size(); i++) {
+                code << "scalar rkK" << s << "_" << i << "; ";
+            }
+            code << "{ ";
+            if(s > 0) {
+                for(size_t i = 0; i < nonlinearDynamics.size(); i++) {
+                    code << "const scalar " << nonlinearDynamics[i].var << " = rkY" << s << "_" << i << "; ";
+                }
+            }
+            for(size_t i = 0; i < nonlinearDynamics.size(); i++) {
+                code << "rkK" << s << "_" << i << " = " << nonlinearDynamics[i].derivative << "; ";
+            }
+            code << "} ";
+
+            // Calculate intermediate values for next stage
+            if(s < 3) {
+                for(size_t i = 0; i < nonlinearDynamics.size(); i++) {
+                    code << "const scalar rkY" << (s + 1) << "_" << i << " = " << nonlinearDynamics[i].var;
+                    code << " + (" << stageScale[s] << " * rkH * rkK" << s << "_" << i << "); ";
+                }
+            }
+        }
+
+        // Combine stages to update variables
+        for(size_t i = 0; i < nonlinearDynamics.size(); i++) {
+            code << nonlinearDynamics[i].var << " += (rkH / 6.0) * (rkK0_" << i << " + (2.0 * rkK1_" << i;
+            code << ") + (2.0 * rkK2_" << i << ") + rkK3_" << i << "); ";
+        }
+
+        if(numSubsteps > 1) {
+            code << "} ";
+        }
+        code << "} ";
+    }
+    return code.str();
+}
+//----------------------------------------------------------------------------
 void Base::validate(const std::map<std::string, Type::NumericValue> &paramValues, 
                     const std::map<std::string, InitVarSnippet::Init> &varValues,
                     const std::string &description) const
@@ -48,5 +263,38 @@ void Base::validate(const std::map<std::string, Type::NumericValue> &paramValues
 
     // Validate variable initialisers
     Utils::validateInitialisers(vars, varValues, "variable", description);
+
+    // Helper to check variables integrated by dynamics exist and are writable
+    auto validateDynamicsVar = 
+        [&vars, &description](const std::string &varName)
+        {
+            const auto var = getNamed(varName, vars);
+            if(!var) {
+                throw std::runtime_error(description + ": dynamics refer to undefined variable '" + varName + "'");
+            }
+            if(var->access & VarAccessModeAttribute::READ_ONLY) {
+                throw std::runtime_error(description + ": dynamics cannot integrate read-only variable '" + varName + "'");
+            }
+        };
+
+    // Validate linear dynamics
+    const auto linearDynamics = getLinearDynamics();
+    if(linearDynamics.inputs.size() != linearDynamics.vars.size()) {
+        throw std::runtime_error(description + ": linear dynamics require one (possibly empty) input per variable");
+    }
+    if(!linearDynamics.vars.empty() && !linearDynamics.coefficients) {
+        throw std::runtime_error(description + ": linear dynamics require coefficient function");
+    }
+    for(const auto &v : linearDynamics.vars) {
+        validateDynamicsVar(v);
+    }
+
+    // Validate nonlinear dynamics
+    for(const auto &o : getNonlinearDynamics()) {
+        validateDynamicsVar(o.var);
+    }
+    if(getNumNonlinearDynamicsSubsteps() == 0) {
+        throw std::runtime_error(description + ": nonlinear dynamics require at least one substep");
+    }
 }
 }   // namespace GeNN::NeuronModels
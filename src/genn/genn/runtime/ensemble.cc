@@ -0,0 +1,237 @@
+#include "runtime/ensemble.h"
+
+// Standard C++ includes
+#include <cstring>
+
+// PLOG includes
+#include <plog/Log.h>
+
+// GeNN code generator includes
+#include "code_generator/backendBase.h"
+#include "code_generator/modelSpecMerged.h"
+
+using namespace GeNN;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+void copyArray(const Runtime::ArrayBase *source, Runtime::ArrayBase *target)
+{
+    // If array is shared, there's nothing to copy
+    if(source == target) {
+        return;
+    }
+
+    std::memcpy(target->getHostPointer(), source->getHostPointer(), source->getSizeBytes());
+    target->pushToDevice();
+}
+
+void simulate(Runtime::Runtime &runtime, unsigned int numTimesteps)
+{
+    for(unsigned int t = 0; t < numTimesteps; t++) {
+        runtime.stepTime();
+    }
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// GeNN::Runtime::Ensemble
+//--------------------------------------------------------------------------
+namespace GeNN::Runtime
+{
+Ensemble::Ensemble(const filesystem::path &modelPath, const CodeGenerator::ModelSpecMerged &modelMerged,
+                   const CodeGenerator::BackendBase &backend, size_t numReplicas)
+:   m_ModelMerged(modelMerged), m_WorkerGeneration(0), m_WorkerNumTimesteps(0), 
+    m_NumWorkersRunning(0), m_StopWorkers(false)
+{
+    if(!backend.isInstanceContextEnabled()) {
+        throw std::runtime_error("Ensembles require a backend which generates code with an instance context");
+    }
+    if(numReplicas == 0) {
+        throw std::runtime_error("Ensembles require at least one replica");
+    }
+
+    // Create runtimes for each replica
+    // **NOTE** these all share the same library as state is held in their contexts
+    m_Replicas.reserve(numReplicas);
+    for(size_t i = 0; i < numReplicas; i++) {
+        m_Replicas.push_back(std::make_unique<Runtime>(modelPath, modelMerged, backend));
+    }
+}
+//----------------------------------------------------------------------------
+Ensemble::~Ensemble()
+{
+    // Shut down workers
+    {
+        std::lock_guard<std::mutex> lock(m_WorkerMutex);
+        m_StopWorkers = true;
+    }
+    m_WorkerStart.notify_all();
+    for(auto &w : m_Workers) {
+        w.join();
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::allocate(std::optional<size_t> numRecordingTimesteps, const std::vector<unsigned int> &seeds)
+{
+    if(!seeds.empty() && seeds.size() != m_Replicas.size()) {
+        throw std::runtime_error("Ensemble of " + std::to_string(m_Replicas.size())
+                                 + " replicas requires one seed per replica");
+    }
+
+    // Allocate replicas, sharing connectivity of first with others
+    const unsigned int modelSeed = m_ModelMerged.get().getModel().getSeed();
+    for(size_t i = 0; i < m_Replicas.size(); i++) {
+        m_Replicas[i]->allocate(numRecordingTimesteps, (i == 0) ? nullptr : m_Replicas.front().get());
+
+        // If seeds are specified, reseed replica
+        if(!seeds.empty()) {
+            m_Replicas[i]->seedHostRNG(seeds[i]);
+        }
+        // Otherwise, if model has a seed, offset by replica index so replicas get independent streams
+        // **NOTE** with no model seed, each replica is already seeded from system randomness
+        else if(modelSeed != 0) {
+            m_Replicas[i]->seedHostRNG(modelSeed + (unsigned int)i);
+        }
+    }
+
+    // Start worker threads to simulate all but the first replica
+    if(m_Workers.empty()) {
+        m_Workers.reserve(m_Replicas.size() - 1);
+        for(size_t i = 1; i < m_Replicas.size(); i++) {
+            m_Workers.emplace_back(&Ensemble::workerThread, this, std::ref(*m_Replicas[i]));
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::initialize()
+{
+    for(auto &r : m_Replicas) {
+        r->initialize();
+    }
+
+    // Loop through synapse groups whose connectivity is initialised on device
+    // **NOTE** connectivity built alongside kernel variables is initialised by each replica
+    const auto &first = *m_Replicas.front();
+    for(const auto &s : m_ModelMerged.get().getModel().getSynapseGroups()) {
+        if(!s.second.isSparseConnectivityInitRequired() || !s.second.getKernelSize().empty()) {
+            continue;
+        }
+
+        // Copy first replica's connectivity to any others which don't share it
+        LOGD_RUNTIME << "Copying connectivity of synapse group '" << s.first << "' to replicas which don't share it";
+        for(size_t i = 1; i < m_Replicas.size(); i++) {
+            if(s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
+                copyArray(first.getArray(s.second, "gp"), m_Replicas[i]->getArray(s.second, "gp"));
+            }
+            else {
+                copyArray(first.getArray(s.second, "rowLength"), m_Replicas[i]->getArray(s.second, "rowLength"));
+                copyArray(first.getArray(s.second, "ind"), m_Replicas[i]->getArray(s.second, "ind"));
+            }
+        }
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::initializeSparse()
+{
+    for(auto &r : m_Replicas) {
+        r->initializeSparse();
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::stepTime(unsigned int numTimesteps)
+{
+    if(m_Workers.size() != (m_Replicas.size() - 1)) {
+        throw std::runtime_error("Ensemble must be allocated before it can be simulated");
+    }
+
+    // Start workers simulating all but first replica
+    {
+        std::lock_guard<std::mutex> lock(m_WorkerMutex);
+        m_WorkerNumTimesteps = numTimesteps;
+        m_NumWorkersRunning = m_Workers.size();
+        m_WorkerException = nullptr;
+        m_WorkerGeneration++;
+    }
+    m_WorkerStart.notify_all();
+
+    // Simulate first replica on this thread
+    std::exception_ptr exception;
+    try {
+        simulate(*m_Replicas.front(), numTimesteps);
+    }
+    catch(...) {
+        exception = std::current_exception();
+    }
+
+    // Wait for workers to finish
+    {
+        std::unique_lock<std::mutex> lock(m_WorkerMutex);
+        m_WorkerFinish.wait(lock, [this](){ return (m_NumWorkersRunning == 0); });
+        if(!exception) {
+            exception = m_WorkerException;
+        }
+    }
+
+    // Rethrow any exception on this thread
+    if(exception) {
+        std::rethrow_exception(exception);
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::customUpdate(const std::string &name)
+{
+    for(auto &r : m_Replicas) {
+        r->customUpdate(name);
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::pullRecordingBuffersFromDevice() const
+{
+    for(const auto &r : m_Replicas) {
+        r->pullRecordingBuffersFromDevice();
+    }
+}
+//----------------------------------------------------------------------------
+void Ensemble::workerThread(Runtime &replica)
+{
+    unsigned long long generation = 0;
+    while(true) {
+        // Wait until workers are started or shut down
+        unsigned int numTimesteps;
+        {
+            std::unique_lock<std::mutex> lock(m_WorkerMutex);
+            m_WorkerStart.wait(lock, [this, generation](){ return (m_StopWorkers || m_WorkerGeneration != generation); });
+            if(m_StopWorkers) {
+                return;
+            }
+            generation = m_WorkerGeneration;
+            numTimesteps = m_WorkerNumTimesteps;
+        }
+
+        // Simulate replica, catching any exception so it can be rethrown on calling thread
+        std::exception_ptr exception;
+        try {
+            simulate(replica, numTimesteps);
+        }
+        catch(...) {
+            exception = std::current_exception();
+        }
+
+        // Record first exception and signal if this is the last worker to finish
+        bool finished;
+        {
+            std::lock_guard<std::mutex> lock(m_WorkerMutex);
+            if(exception && !m_WorkerException) {
+                m_WorkerException = exception;
+            }
+            finished = (--m_NumWorkersRunning == 0);
+        }
+        if(finished) {
+            m_WorkerFinish.notify_one();
+        }
+    }
+}
+}   // namespace GeNN::Runtime
@@ -39,6 +39,88 @@ size_t getNumSynapseVarElements(VarAccessDim varDims, const BackendBase &backend
         return 1;
     }
 }
+//--------------------------------------------------------------------------
+void reallocateRows(Runtime::ArrayBase *array, const uint32_t *rowLength, size_t numPre, 
+                    size_t oldRowStride, size_t newRowStride)
+{
+    // Take copy of array's current contents
+    // **NOTE** arrays are laid out as one padded row per presynaptic neuron and batch
+    array->pullFromDevice();
+    const size_t elementSize = array->getType().getValue().size;
+    const size_t numRows = array->getCount() / oldRowStride;
+    const std::vector<std::byte> oldData(array->getHostPointer(), array->getHostPointer() + array->getSizeBytes());
+
+    // Reallocate and zero array
+    array->free();
+    array->allocate(numRows * newRowStride);
+    array->memsetHostPointer(0);
+
+    // Copy occupied part of each row into new array
+    for(size_t r = 0; r < numRows; r++) {
+        std::copy_n(oldData.cbegin() + (r * oldRowStride * elementSize), rowLength[r % numPre] * elementSize,
+                    array->getHostPointer() + (r * newRowStride * elementSize));
+    }
+    array->pushToDevice();
+}
+//--------------------------------------------------------------------------
+template<typename I>
+void buildSparseConnectivity(const unsigned int *preInds, const unsigned int *postInds, size_t numSynapses,
+                             const std::vector<uint32_t> &rowCounts, size_t rowStride, I *ind, size_t *synapseOrder)
+{
+    // If synapse order is required
+    const size_t numPre = rowCounts.size();
+    if(synapseOrder) {
+        // Calculate where each row starts in unpadded synapse order
+        std::vector<size_t> rowStart(numPre + 1, 0);
+        for(size_t i = 0; i < numPre; i++) {
+            rowStart[i + 1] = rowStart[i] + rowCounts[i];
+        }
+
+        // Scatter synapse indices into rows, preserving their order within each row
+        std::vector<size_t> rowCursor(rowStart.cbegin(), rowStart.cend() - 1);
+        for(size_t s = 0; s < numSynapses; s++) {
+            synapseOrder[rowCursor[preInds[s]]++] = s;
+        }
+
+        // Loop through rows
+        for(size_t i = 0; i < numPre; i++) {
+            // Sort synapses within row by postsynaptic index
+            // **NOTE** stable sort so order matches np.lexsort
+            std::stable_sort(&synapseOrder[rowStart[i]], &synapseOrder[rowStart[i + 1]],
+                             [postInds](size_t a, size_t b){ return postInds[a] < postInds[b]; });
+
+            // Copy postsynaptic indices into padded row
+            I *rowInd = &ind[i * rowStride];
+            for(size_t s = rowStart[i]; s < rowStart[i + 1]; s++) {
+                *rowInd++ = static_cast<I>(postInds[synapseOrder[s]]);
+            }
+        }
+    }
+    // Otherwise
+    else {
+        // Scatter postsynaptic indices directly into padded rows
+        std::vector<uint32_t> rowCursor(numPre, 0);
+        for(size_t s = 0; s < numSynapses; s++) {
+            const unsigned int i = preInds[s];
+            ind[(i * rowStride) + rowCursor[i]++] = static_cast<I>(postInds[s]);
+        }
+
+        // Sort each row by postsynaptic index
+        for(size_t i = 0; i < numPre; i++) {
+            std::sort(&ind[i * rowStride], &ind[(i * rowStride) + rowCounts[i]]);
+        }
+    }
+}
+
+bool canConnectivityBeShared(const SynapseGroupInternal &sg)
+{
+    // Connectivity can only be shared with another instance if it's built by a snippet which 
+    // doesn't also initialise kernel variables and can't be reallocated or modified at runtime
+    const auto &ccuRefs = sg.getCustomConnectivityUpdateReferences();
+    return (sg.isSparseConnectivityInitRequired() && sg.getKernelSize().empty() && !sg.isRowCapacityGrowable()
+            && std::none_of(ccuRefs.cbegin(), ccuRefs.cend(), 
+                            [](const auto *c){ return c->canModifyConnectivity(); }));
+}
 }   // Anonymous namespace
 
 //--------------------------------------------------------------------------
@@ -69,8 +151,9 @@ void ArrayBase::serialiseHostPointer(std::vector<std::byte> &bytes, bool pointer
 //--------------------------------------------------------------------------
 Runtime::Runtime(const filesystem::path &modelPath, const CodeGenerator::ModelSpecMerged &modelMerged, 
                  const CodeGenerator::BackendBase &backend)
-:   m_Timestep(0), m_ModelMerged(modelMerged), m_Backend(backend), m_AllocateMem(nullptr), m_FreeMem(nullptr),
-    m_Initialize(nullptr), m_InitializeSparse(nullptr), m_InitializeHost(nullptr), m_StepTime(nullptr)
+:   m_Timestep(0), m_ModelMerged(modelMerged), m_Backend(backend), m_Context(nullptr), m_AllocateMem(nullptr), 
+    m_FreeMem(nullptr), m_Initialize(nullptr), m_InitializeSparse(nullptr), m_InitializeHost(nullptr), 
+    m_StepTime(nullptr), m_GetContextSymbol(nullptr), m_SeedContext(nullptr)
 {
 
     // Load library
@@ -86,14 +169,29 @@ Runtime::Runtime(const filesystem::path &modelPath, const CodeGenerator::ModelSp
 
     // If library was loaded successfully, look up basic functions in library
     if(m_Library != nullptr) {
-        m_AllocateMem = (VoidFunction)getSymbol("allocateMem");
-        m_FreeMem = (VoidFunction)getSymbol("freeMem");
+        // If backend generates re-entrant code, look up functions to allocate and free context
+        if(backend.isInstanceContextEnabled()) {
+            m_AllocateMem = getSymbol("allocateContext");
+            m_FreeMem = getSymbol("freeContext");
+            m_GetContextSymbol = (GetContextSymbolFunction)getSymbol("getContextSymbol");
+            m_SeedContext = (SeedContextFunction)getSymbol("seedContext");
+        }
+        else {
+            m_AllocateMem = getSymbol("allocateMem");
+            m_FreeMem = getSymbol("freeMem");
+        }
 
-        m_Initialize = (VoidFunction)getSymbol("initialize");
-        m_InitializeSparse = (VoidFunction)getSymbol("initializeSparse");
-        m_InitializeHost = (VoidFunction)getSymbol("initializeHost");
+        m_Initialize = getSymbol("initialize");
+        m_InitializeSparse = getSymbol("initializeSparse");
+        m_InitializeHost = getSymbol("initializeHost");
 
-        m_StepTime = (StepTimeFunction)getSymbol("stepTime");
+        m_StepTime = getSymbol("stepTime");
+
+        // If library contains versions of update code for multiple ISAs, log which was selected
+        const auto getTargetISA = (GetStringFunction)getSymbol("getTargetISA", true);
+        if(getTargetISA) {
+            LOGI_RUNTIME << "Using '" << getTargetISA() << "' ISA version of update code";
+        }
 
         /*m_NCCLGenerateUniqueID = (VoidFunction)getSymbol("ncclGenerateUniqueID", true);
         m_NCCLGetUniqueID = (UCharPtrFunction)getSymbol("ncclGetUniqueID", true);
@@ -117,7 +215,7 @@ Runtime::Runtime(const filesystem::path &modelPath, const CodeGenerator::ModelSp
                        std::inserter(m_CustomUpdateFunctions, m_CustomUpdateFunctions.end()),
                        [this](const auto &n)
                        { 
-                           return std::make_pair(n, (CustomUpdateFunction)getSymbol("update" + n)); 
+                           return std::make_pair(n, getSymbol("update" + n)); 
                        });
 
         // Create  state
@@ -135,7 +233,15 @@ Runtime::Runtime(const filesystem::path &modelPath, const CodeGenerator::ModelSp
 Runtime::~Runtime()
 {
     if(m_Library) {
-        m_FreeMem();
+        // If backend generates re-entrant code, free context if it was allocated
+        if(m_Backend.get().isInstanceContextEnabled()) {
+            if(m_Context) {
+                callEntryPoint(m_FreeMem);
+            }
+        }
+        else {
+            callEntryPoint(m_FreeMem);
+        }
 
 #ifdef _WIN32
         FreeLibrary(m_Library);
@@ -146,10 +252,23 @@ Runtime::~Runtime()
     }
 }
 //----------------------------------------------------------------------------
-void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
+void Runtime::allocate(std::optional<size_t> numRecordingTimesteps, const Runtime *connectivitySource)
 {
-    // Call allocate function in generated code
-    m_AllocateMem();
+    // Call allocate function in generated code, storing context if it returns one
+    if(m_Backend.get().isInstanceContextEnabled()) {
+        m_Context = ((AllocateContextFunction)m_AllocateMem)();
+    }
+    else {
+        callEntryPoint(m_AllocateMem);
+    }
+
+    // If connectivity is shared with another instance, tell generated code not to initialise it
+    if(connectivitySource) {
+        if(!m_Context) {
+            throw std::runtime_error("Connectivity can only be shared between instances of models with an instance context");
+        }
+        *static_cast<bool*>(getContextSymbol("skipConnectivityInit")) = true;
+    }
 
     // Store number of recording timesteps
     m_NumRecordingTimesteps = numRecordingTimesteps;
@@ -161,8 +280,8 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
         const size_t nonDelayedNeuronVarSize = batchSize * n.second.getNumNeurons();
         const size_t delayedNeuronVarSize = nonDelayedNeuronVarSize * n.second.getNumDelaySlots();
 
-        // If spike or spike-like event recording is enabled
-        if(n.second.isSpikeRecordingEnabled() || n.second.isSpikeEventRecordingEnabled()) {
+        // If spike, spike-like event or spike count recording is enabled
+        if(n.second.isRecordingEnabled()) {
             if(!numRecordingTimesteps) {
                 throw std::runtime_error("Cannot use recording system without specifying number of recording timesteps");
             }
@@ -172,6 +291,25 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
                 createArray(&n.second, "recordSpk", Type::Uint32, numRecordingWords,
                             n.second.isRecordingZeroCopyEnabled() ? VarLocation::HOST_DEVICE_ZERO_COPY : VarLocation::HOST_DEVICE);
             }
+
+            if(n.second.isSpikeCountRecordingEnabled()) {
+                createArray(&n.second, "recordSpkCnt", Type::Uint32, batchSize * numRecordingTimesteps.value(),
+                            n.second.isRecordingZeroCopyEnabled() ? VarLocation::HOST_DEVICE_ZERO_COPY : VarLocation::HOST_DEVICE);
+            }
+        }
+        const VarLocation recordingLocation = n.second.isRecordingZeroCopyEnabled() ? VarLocation::HOST_DEVICE_ZERO_COPY : VarLocation::HOST_DEVICE;
+
+        // Create recording buffers for traces of neuron variables
+        createVarTraceArrays<NeuronVarAdapter>(&n.second, n.second.getVarTraces(), batchSize, recordingLocation);
+
+        // If neuron group estimates firing rates, add per-neuron rate array
+        if(n.second.isSpikeRateEstimationEnabled()) {
+            createArray(&n.second, "spkRate", getModel().getPrecision(), nonDelayedNeuronVarSize, VarLocation::HOST_DEVICE);
+        }
+
+        // If neuron group builds inter-spike interval histogram, add histogram array
+        if(n.second.isISIHistogramEnabled()) {
+            createArray(&n.second, "isiHist", Type::Uint32, batchSize * n.second.getISIHistogramNumBins(), VarLocation::HOST_DEVICE);
         }
 
         // If neuron group has axonal or back-propagation delays, add delay queue pointer
@@ -223,6 +361,7 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
             createEGPArrays<CurrentSourceEGPAdapter>(cs);
             createDynamicParamDestinations<CurrentSourceInternal>(*cs, cs->getModel()->getParams(),
                                                                   &CurrentSourceInternal::isParamDynamic, 2);
+            createVarTraceArrays<CurrentSourceVarAdapter>(cs, cs->getVarTraces(), batchSize, recordingLocation, 2);
         }
 
         // Loop through fused postsynaptic model from incoming populations
@@ -233,14 +372,36 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
                         sg->getOutputLocation(), false, 2);
             
             if (sg->isDendriticOutputDelayRequired()) {
-                createArray(sg, "denDelay", getModel().getPrecision(), 
-                            (size_t)sg->getMaxDendriticDelayTimesteps() * (size_t)sg->getTrgNeuronGroup()->getNumNeurons() * batchSize,
-                            sg->getDendriticDelayLocation(), false, 2);
+                // If dendritic delays are implemented using a sparse timing wheel, 
+                // create count of events in each bucket and bucket entries
+                if(sg->isDendriticDelayWheelEnabled()) {
+                    const size_t numBucketEntries = (size_t)sg->getMaxDendriticDelayTimesteps() * (size_t)sg->getMaxDendriticDelayEvents() * batchSize;
+                    LOGD_RUNTIME << "\t\tDendritic delay timing wheel with " << sg->getMaxDendriticDelayEvents() << " entries per bucket";
+                    createArray(sg, "denDelayWheelCount", Type::Uint32, 
+                                (size_t)sg->getMaxDendriticDelayTimesteps() * batchSize,
+                                sg->getDendriticDelayLocation(), false, 2);
+                    createArray(sg, "denDelayWheelTarget", Type::Uint32, numBucketEntries,
+                                sg->getDendriticDelayLocation(), false, 2);
+                    createArray(sg, "denDelayWheelWeight", getModel().getPrecision(), numBucketEntries,
+                                sg->getDendriticDelayLocation(), false, 2);
+                    createArray(sg, "denDelayWheelOverflow", Type::Uint32, 1,
+                                sg->getDendriticDelayLocation(), false, 2);
+                }
+                // Otherwise, create dense ring buffer
+                else {
+                    createArray(sg, "denDelay", getModel().getPrecision(), 
+                                (size_t)sg->getMaxDendriticDelayTimesteps() * (size_t)sg->getTrgNeuronGroup()->getNumNeurons() * batchSize,
+                                sg->getDendriticDelayLocation(), false, 2);
+                }
                 createArray(sg, "denDelayPtr", Type::Uint32, 1, VarLocation::DEVICE, false, 2);
             }
 
             // Create arrays for postsynaptic model state variables
             createNeuronVarArrays<SynapsePSMVarAdapter>(sg, sg->getTrgNeuronGroup()->getNumNeurons(), batchSize, true);
+
+            // Create recording buffers for traces of postsynaptic model variables
+            // **NOTE** postsynaptic models with traces are never fused so these are always the target's own traces
+            createVarTraceArrays<SynapsePSMVarAdapter>(sg, sg->getPSVarTraces(), batchSize, recordingLocation, 2);
         }
 
         // Create arrays for fused pre-output variables
@@ -329,12 +490,27 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
                 });
         }
 
+        // If weight update model has lazily-decayed variables, create array to hold time each synapse was last updated
+        if(!s.second.getWUInitialiser().getSnippet()->getLazyDecayVars().empty()) {
+            createArray(&s.second, "lazyDecayTime", getModel().getTimePrecision(), 
+                        batchSize * getNumSynapseVarElements(VarAccessDim::ELEMENT, m_Backend.get(), s.second), 
+                        VarLocation::DEVICE);
+        }
+
         // Create destinations for any dynamic parameters
         createDynamicParamDestinations<SynapseGroupInternal>(s.second, s.second.getWUInitialiser().getSnippet()->getParams(),
                                                             &SynapseGroupInternal::isWUParamDynamic);
         createDynamicParamDestinations<SynapseGroupInternal>(s.second, s.second.getPSInitialiser().getSnippet()->getParams(),
                                                             &SynapseGroupInternal::isPSParamDynamic);
 
+        // If row capacity is growable, track current row stride and create destinations for it
+        // and counter for synapses which custom connectivity updates couldn't add to full rows
+        if(s.second.isRowCapacityGrowable()) {
+            m_GrowableRowStrides.emplace(&s.second, m_Backend.get().getSynapticMatrixRowStride(s.second));
+            createDynamicParamDestinations(&s.second, "rowStride", Type::Uint32);
+            createArray(&s.second, "rowOverflow", Type::Uint32, 1, VarLocation::HOST_DEVICE, false);
+        }
+
         // If connectivity is bitmask
         const size_t numPre = s.second.getSrcNeuronGroup()->getNumNeurons();
         const size_t rowStride = m_Backend.get().getSynapticMatrixRowStride(s.second);
@@ -342,45 +518,66 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
         const bool uninitialized = (Utils::areTokensEmpty(connectInit.getRowBuildCodeTokens()) 
                                     && Utils::areTokensEmpty(connectInit.getColBuildCodeTokens()));
 
+        // Determine whether connectivity should be shared with another instance of the model
+        const bool shareConnectivity = (connectivitySource && canConnectivityBeShared(s.second));
+
         if(s.second.getMatrixType() & SynapseMatrixConnectivity::BITMASK) {
-            const size_t gpSize = ceilDivide((size_t)numPre * rowStride, 32);
-            createArray(&s.second, "gp", Type::Uint32, gpSize,
-                        s.second.getSparseConnectivityLocation(), uninitialized);
-            
-            // If this isn't uninitialised i.e. it will be 
-            // initialised using initialization kernel, zero bitmask
-            if(!uninitialized) {
-                if(m_Backend.get().isArrayDeviceObjectRequired()) {
-                    getArray(s.second, "gp")->memsetDeviceObject(0);
-                }
-                else {
-                    getArray(s.second, "gp")->memsetHostPointer(0);
+            // If connectivity is shared with another instance, use its bitmask
+            if(shareConnectivity) {
+                shareArray(*connectivitySource, s.second, "gp");
+            }
+            else {
+                const size_t gpSize = ceilDivide((size_t)numPre * rowStride, 32);
+                createArray(&s.second, "gp", Type::Uint32, gpSize,
+                            s.second.getSparseConnectivityLocation(), uninitialized);
+                
+                // If this isn't uninitialised i.e. it will be 
+                // initialised using initialization kernel, zero bitmask
+                if(!uninitialized) {
+                    if(m_Backend.get().isArrayDeviceObjectRequired()) {
+                        getArray(s.second, "gp")->memsetDeviceObject(0);
+                    }
+                    else {
+                        getArray(s.second, "gp")->memsetHostPointer(0);
+                    }
                 }
             }
         }
         // Otherwise, if connectivity is sparse
         else if(s.second.getMatrixType() & SynapseMatrixConnectivity::SPARSE) {
-            // Row lengths
-            createArray(&s.second, "rowLength", Type::Uint32, numPre,
-                        s.second.getSparseConnectivityLocation(), uninitialized);
+            // If connectivity is shared with another synapse group, its row lengths and indices will be used instead
+            if(s.second.getSharedConnectivityTarget() != nullptr) {
+                LOGD_RUNTIME << "\tSharing connectivity of synapse group '" << s.second.getSharedConnectivityTarget()->getName() << "'";
+            }
+            // Otherwise, if connectivity is shared with another instance, use its row lengths and indices
+            else if(shareConnectivity) {
+                shareArray(*connectivitySource, s.second, "rowLength");
+                shareArray(*connectivitySource, s.second, "ind");
+            }
+            else {
+                // Row lengths
+                createArray(&s.second, "rowLength", Type::Uint32, numPre,
+                            s.second.getSparseConnectivityLocation(), uninitialized);
 
-            // Target indices
-            createArray(&s.second, "ind", s.second.getSparseIndType(), numPre * rowStride,
-                        s.second.getSparseConnectivityLocation(), uninitialized);
-            
-            // If this isn't uninitialised i.e. it will be 
-            // initialised using initialization kernel, zero row length
-            if(!uninitialized) {
-                LOGD_RUNTIME << "\tZeroing 'rowLength'";
-                if(m_Backend.get().isArrayDeviceObjectRequired()) {
-                    getArray(s.second, "rowLength")->memsetDeviceObject(0);
-                }
-                else {
-                    getArray(s.second, "rowLength")->memsetHostPointer(0);
+                // Target indices
+                createArray(&s.second, "ind", s.second.getSparseIndType(), numPre * rowStride,
+                            s.second.getSparseConnectivityLocation(), uninitialized);
+                
+                // If this isn't uninitialised i.e. it will be 
+                // initialised using initialization kernel, zero row length
+                if(!uninitialized) {
+                    LOGD_RUNTIME << "\tZeroing 'rowLength'";
+                    if(m_Backend.get().isArrayDeviceObjectRequired()) {
+                        getArray(s.second, "rowLength")->memsetDeviceObject(0);
+                    }
+                    else {
+                        getArray(s.second, "rowLength")->memsetHostPointer(0);
+                    }
                 }
             }
 
-            // **TODO** remap is not always required
+            // Remap is only required if there is postsynaptic learning
+            // **NOTE** purely presynaptic learning rules never access connectivity column-wise
             if(m_Backend.get().isPostsynapticRemapRequired() 
                && (s.second.isPostSpikeRequired() || s.second.isPostSpikeEventRequired())) 
             {
@@ -400,6 +597,19 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
                 else {
                     getArray(s.second, "colLength")->memsetHostPointer(0);
                 }
+
+                // If backend builds remap lazily, create and zero flag used to track whether it is up to date
+                if(m_Backend.get().isPostsynapticRemapLazy()) {
+                    createArray(&s.second, "remapValid", Type::Uint32, 1, VarLocation::DEVICE);
+
+                    LOGD_RUNTIME << "\tZeroing 'remapValid'";
+                    if(m_Backend.get().isArrayDeviceObjectRequired()) {
+                        getArray(s.second, "remapValid")->memsetDeviceObject(0);
+                    }
+                    else {
+                        getArray(s.second, "remapValid")->memsetHostPointer(0);
+                    }
+                }
             }
         }
 
@@ -502,170 +712,358 @@ void Runtime::allocate(std::optional<size_t> numRecordingTimesteps)
     }
 
     // Perform host initialisation
-    m_InitializeHost();
+    callEntryPoint(m_InitializeHost);
 
+    // Add dynamic arrays from all merged groups and push
+    pushMergedGroups(true);
+
+    // Loop through merged custom connectivity remap update groups and add 
+    // Column length arrays associated with each synapse group to map
+    for (const auto &m : m_ModelMerged.get().getMergedCustomConnectivityRemapUpdateGroups()) {
+        auto &colLengthArrays = m_CustomUpdateColLengthArrays[m.getArchetype().getUpdateGroupName()];
+        std::transform(m.getGroups().cbegin(), m.getGroups().cend(), std::back_inserter(colLengthArrays),
+                       [this](auto r){ return getArray(*r.get().getSynapseGroup(), "colLength"); });
+    }
+}
+//----------------------------------------------------------------------------
+void Runtime::pushMergedGroups(bool addArrays)
+{
     // Push merged neuron initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedNeuronInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged synapse init groups
     for(const auto &m : m_ModelMerged.get().getMergedSynapseInitGroups()) {
-         addMergedArrays(m);
-         pushMergedGroup(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
+        pushMergedGroup(m);
     }
 
     // Push merged synapse connectivity initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedSynapseConnectivityInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged sparse synapse init groups
     for(const auto &m : m_ModelMerged.get().getMergedSynapseSparseInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom update initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomUpdateInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom WU update initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomWUUpdateInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom sparse WU update initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomWUUpdateSparseInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom connectivity update presynaptic initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomConnectivityUpdatePreInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom connectivity update postsynaptic initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomConnectivityUpdatePostInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged custom connectivity update synaptic initialisation groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomConnectivityUpdateSparseInitGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged neuron update groups
     for(const auto &m : m_ModelMerged.get().getMergedNeuronUpdateGroups()) {        
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged presynaptic update groups
     for(const auto &m : m_ModelMerged.get().getMergedPresynapticUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push merged postsynaptic update groups
     for(const auto &m : m_ModelMerged.get().getMergedPostsynapticUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push synapse dynamics groups
     for(const auto &m : m_ModelMerged.get().getMergedSynapseDynamicsGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push neuron groups whose previous spike times need resetting
     for(const auto &m : m_ModelMerged.get().getMergedNeuronPrevSpikeTimeUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push neuron groups whose spike queues need resetting
     for(const auto &m : m_ModelMerged.get().getMergedNeuronSpikeQueueUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push synapse groups whose dendritic delay pointers need updating
     for(const auto &m : m_ModelMerged.get().getMergedSynapseDendriticDelayUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
     
     // Push custom variable update groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom WU variable update groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomUpdateWUGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom WU transpose variable update groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomUpdateTransposeWUGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom update host reduction groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomUpdateHostReductionGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom weight update host reduction groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomWUUpdateHostReductionGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom connectivity update groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomConnectivityUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom connectivity remap update groups
     for (const auto &m : m_ModelMerged.get().getMergedCustomConnectivityRemapUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
 
     // Push custom connectivity host update groups
     for(const auto &m : m_ModelMerged.get().getMergedCustomConnectivityHostUpdateGroups()) {
-        addMergedArrays(m);
+        if(addArrays) {
+            addMergedArrays(m);
+        }
         pushMergedGroup(m);
     }
+}
+//----------------------------------------------------------------------------
+void Runtime::updateRowCapacity(const SynapseGroupInternal &group)
+{
+    // Find longest row
+    const size_t numPre = group.getSrcNeuronGroup()->getNumNeurons();
+    const size_t numPost = group.getTrgNeuronGroup()->getNumNeurons();
+    auto *rowLengthArray = getArray(group, "rowLength");
+    rowLengthArray->pullFromDevice();
+    const uint32_t *rowLength = rowLengthArray->getHostPointer<uint32_t>();
+    const size_t maxRowLength = (numPre == 0) ? 0 : *std::max_element(rowLength, rowLength + numPre);
+
+    // Calculate row stride required to leave slack after longest row
+    // **NOTE** rows can never be longer than the number of target neurons
+    const size_t requiredRowStride = std::max<size_t>(1, std::min<size_t>(maxRowLength + group.getRowCapacitySlack(), numPost));
+
+    // If rows need to grow, grow them geometrically so the cost of reallocating is amortised
+    auto &rowStride = m_GrowableRowStrides.at(&group);
+    size_t newRowStride;
+    if(requiredRowStride > rowStride) {
+        newRowStride = std::min(std::max(requiredRowStride, rowStride + (rowStride / 2)), std::max<size_t>(1, numPost));
+    }
+    // Otherwise, if rows are more than twice as long as required, compact them
+    else if((2 * requiredRowStride) < rowStride) {
+        newRowStride = requiredRowStride;
+    }
+    // Otherwise, leave rows alone
+    else {
+        return;
+    }
+    LOGD_RUNTIME << "Reallocating rows of synapse group '" << group.getName() << "' (row stride " << rowStride << " -> " << newRowStride << ")";
+
+    // Build list of arrays with one padded row per presynaptic neuron (and batch)
+    std::vector<ArrayBase*> arrays{getArray(group, "ind")};
+    SynapseWUVarAdapter wuVarAdapter(group);
+    for(const auto &v : wuVarAdapter.getDefs()) {
+        if(wuVarAdapter.getVarDims(v) & VarAccessDim::ELEMENT) {
+            arrays.push_back(getArray(group, v.name));
+        }
+    }
+    if(!group.getWUInitialiser().getSnippet()->getLazyDecayVars().empty()) {
+        arrays.push_back(getArray(group, "lazyDecayTime"));
+    }
 
-    // Loop through merged custom connectivity remap update groups and add 
-    // Column length arrays associated with each synapse group to map
-    for (const auto &m : m_ModelMerged.get().getMergedCustomConnectivityRemapUpdateGroups()) {
-        auto &colLengthArrays = m_CustomUpdateColLengthArrays[m.getArchetype().getUpdateGroupName()];
-        std::transform(m.getGroups().cbegin(), m.getGroups().cend(), std::back_inserter(colLengthArrays),
-                       [this](auto r){ return getArray(*r.get().getSynapseGroup(), "colLength"); });
+    // Add per-synapse variables of custom updates and custom connectivity updates attached to synapse group
+    for(const auto &c : getModel().getCustomWUUpdates()) {
+        if(c.second.getSynapseGroup() == &group) {
+            CustomUpdateVarAdapter varAdapter(c.second);
+            for(const auto &v : varAdapter.getDefs()) {
+                if(varAdapter.getVarDims(v) & VarAccessDim::ELEMENT) {
+                    arrays.push_back(getArray(c.second, v.name));
+                }
+            }
+        }
+    }
+    for(const auto &c : getModel().getCustomConnectivityUpdates()) {
+        if(c.second.getSynapseGroup() == &group) {
+            CustomConnectivityUpdateVarAdapter varAdapter(c.second);
+            for(const auto &v : varAdapter.getDefs()) {
+                if(varAdapter.getVarDims(v) & VarAccessDim::ELEMENT) {
+                    arrays.push_back(getArray(c.second, v.name));
+                }
+            }
+        }
+    }
+
+    // Reallocate rows of all arrays
+    for(auto *a : arrays) {
+        reallocateRows(a, rowLength, numPre, rowStride, newRowStride);
+    }
+    rowStride = newRowStride;
+
+    // If postsynaptic remap is built lazily, invalidate it as it contains row-major indices
+    if(m_Backend.get().isPostsynapticRemapRequired() && m_Backend.get().isPostsynapticRemapLazy()
+       && (group.isPostSpikeRequired() || group.isPostSpikeEventRequired())) 
+    {
+        if(m_Backend.get().isArrayDeviceObjectRequired()) {
+            getArray(group, "remapValid")->memsetDeviceObject(0);
+        }
+        else {
+            getArray(group, "remapValid")->memsetHostPointer(0);
+        }
+    }
+
+    // Record new row stride and re-push all merged groups so they point to reallocated arrays
+    getMergedParamDestinations(group, "rowStride").setValue(Type::NumericValue((uint64_t)newRowStride));
+    pushMergedGroups(false);
+}
+//----------------------------------------------------------------------------
+size_t Runtime::getSynapticMatrixRowStride(const SynapseGroup &group) const
+{
+    const auto rowStride = m_GrowableRowStrides.find(&group);
+    if(rowStride == m_GrowableRowStrides.cend()) {
+        return m_Backend.get().getSynapticMatrixRowStride(static_cast<const SynapseGroupInternal&>(group));
+    }
+    else {
+        return rowStride->second;
+    }
+}
+//----------------------------------------------------------------------------
+uint32_t Runtime::getDendriticDelayWheelOverflow(const SynapseGroup &group) const
+{
+    const auto &groupInternal = static_cast<const SynapseGroupInternal&>(group);
+    if(!groupInternal.isDendriticDelayWheelEnabled()) {
+        throw std::runtime_error("Synapse group '" + group.getName() + "' does not use a dendritic delay timing wheel");
     }
+
+    // Pull overflow counter from device and return
+    auto *array = getArray(groupInternal.getFusedPSTarget(), "denDelayWheelOverflow");
+    array->pullFromDevice();
+    return *reinterpret_cast<const uint32_t*>(array->getHostPointer());
+}
+//----------------------------------------------------------------------------
+void Runtime::seedHostRNG(unsigned int seed)
+{
+    if(!m_Context) {
+        throw std::runtime_error("Host RNG can only be reseeded once model has been allocated with instance context");
+    }
+    m_SeedContext(m_Context, seed);
 }
 //----------------------------------------------------------------------------
 void Runtime::initialize()
 {
-    m_Initialize();
+    // Zero times at which lazily-decayed variables were last updated
+    for(const auto &s : getModel().getSynapseGroups()) {
+        if(!s.second.getWUInitialiser().getSnippet()->getLazyDecayVars().empty()) {
+            LOGD_RUNTIME << "Zeroing 'lazyDecayTime' of synapse group '" << s.first << "'";
+            if(m_Backend.get().isArrayDeviceObjectRequired()) {
+                getArray(s.second, "lazyDecayTime")->memsetDeviceObject(0);
+            }
+            else {
+                getArray(s.second, "lazyDecayTime")->memsetHostPointer(0);
+            }
+        }
+    }
+
+    callEntryPoint(m_Initialize);
 }
 //----------------------------------------------------------------------------
 void Runtime::initializeSparse()
@@ -682,12 +1080,19 @@ void Runtime::initializeSparse()
     LOGD_RUNTIME << "Pushing uninitialized custom connectivity update variables";
     pushUninitialized(m_CustomConnectivityUpdateArrays);
 
-    m_InitializeSparse();
+    callEntryPoint(m_InitializeSparse);
+
+    // Now connectivity is initialised, reallocate rows of synapse groups with growable row capacity
+    for(const auto &s : getModel().getSynapseGroups()) {
+        if(s.second.isRowCapacityGrowable()) {
+            updateRowCapacity(s.second);
+        }
+    }
 }
 //----------------------------------------------------------------------------
 void Runtime::stepTime()
 {
-   m_StepTime(m_Timestep, m_NumRecordingTimesteps.value_or(0));
+   callEntryPoint(m_StepTime, (unsigned long long)m_Timestep, (unsigned long long)m_NumRecordingTimesteps.value_or(0));
     
    // Loop through delay queue pointers and update
    for(auto &d : m_DelayQueuePointer) {
@@ -715,8 +1120,45 @@ void Runtime::customUpdate(const std::string &name)
         }
     }
 
+    // Find synapse groups with growable row capacity whose connectivity this custom update modifies
+    std::vector<const SynapseGroupInternal*> growableSynapseGroups;
+    for(const auto &c : getModel().getCustomConnectivityUpdates()) {
+        const auto *sg = c.second.getSynapseGroup();
+        if(c.second.getUpdateGroupName() == name && c.second.canModifyConnectivity() 
+           && sg->isRowCapacityGrowable()
+           && std::find(growableSynapseGroups.cbegin(), growableSynapseGroups.cend(), sg) == growableSynapseGroups.cend()) 
+        {
+            growableSynapseGroups.push_back(sg);
+        }
+    }
+
+    // Zero counters of synapses which couldn't be added to their full rows
+    for(const auto *sg : growableSynapseGroups) {
+        auto *rowOverflowArray = getArray(*sg, "rowOverflow");
+        rowOverflowArray->memsetHostPointer(0);
+        rowOverflowArray->pushToDevice();
+    }
+
     // Run custom update
-    m_CustomUpdateFunctions.at(name)(getTimestep());
+    callEntryPoint(m_CustomUpdateFunctions.at(name), (unsigned long long)getTimestep());
+
+    // Reallocate rows of synapse groups with growable row capacity
+    for(const auto *sg : growableSynapseGroups) {
+        updateRowCapacity(*sg);
+    }
+
+    // If any synapses were dropped because their rows were full, give error
+    // **NOTE** this is checked after reallocation so connectivity remains usable
+    for(const auto *sg : growableSynapseGroups) {
+        auto *rowOverflowArray = getArray(*sg, "rowOverflow");
+        rowOverflowArray->pullFromDevice();
+        const uint32_t numDropped = *rowOverflowArray->getHostPointer<uint32_t>();
+        if(numDropped > 0) {
+            throw std::runtime_error("Custom update '" + name + "' tried to add " + std::to_string(numDropped) 
+                                     + " synapses to full rows of synapse group '" + sg->getName() 
+                                     + "' - increase its row capacity slack");
+        }
+    }
 }
 //----------------------------------------------------------------------------
 double Runtime::getTime() const
@@ -724,6 +1166,74 @@ double Runtime::getTime() const
     return m_Timestep * getModel().getDT();
 }
 //----------------------------------------------------------------------------
+std::vector<Runtime::ProfileEntry> Runtime::getProfile() const
+{
+    if(!getModel().isProfilingEnabled()) {
+        throw std::runtime_error("Profiling is not enabled - cannot get profile");
+    }
+
+    // Add entries for all types of merged group counters are generated for
+    std::vector<ProfileEntry> entries;
+    const auto &modelMerged = m_ModelMerged.get();
+    addProfileEntries(modelMerged.getMergedNeuronUpdateGroups(), entries);
+    addProfileEntries(modelMerged.getMergedPresynapticUpdateGroups(), entries);
+    addProfileEntries(modelMerged.getMergedPostsynapticUpdateGroups(), entries);
+    addProfileEntries(modelMerged.getMergedSynapseDynamicsGroups(), entries);
+    addProfileEntries(modelMerged.getMergedCustomUpdateGroups(), entries);
+    addProfileEntries(modelMerged.getMergedCustomUpdateWUGroups(), entries);
+    addProfileEntries(modelMerged.getMergedCustomUpdateTransposeWUGroups(), entries);
+    addProfileEntries(modelMerged.getMergedCustomConnectivityUpdateGroups(), entries);
+    return entries;
+}
+//----------------------------------------------------------------------------
+void Runtime::resetProfile()
+{
+    if(!getModel().isProfilingEnabled()) {
+        throw std::runtime_error("Profiling is not enabled - cannot reset profile");
+    }
+
+    const auto &modelMerged = m_ModelMerged.get();
+    resetProfileCounters(modelMerged.getMergedNeuronUpdateGroups());
+    resetProfileCounters(modelMerged.getMergedPresynapticUpdateGroups());
+    resetProfileCounters(modelMerged.getMergedPostsynapticUpdateGroups());
+    resetProfileCounters(modelMerged.getMergedSynapseDynamicsGroups());
+    resetProfileCounters(modelMerged.getMergedCustomUpdateGroups());
+    resetProfileCounters(modelMerged.getMergedCustomUpdateWUGroups());
+    resetProfileCounters(modelMerged.getMergedCustomUpdateTransposeWUGroups());
+    resetProfileCounters(modelMerged.getMergedCustomConnectivityUpdateGroups());
+}
+//----------------------------------------------------------------------------
+void Runtime::writeProfileTrace(const std::string &path) const
+{
+    const auto entries = getProfile();
+
+    // Open file and write header
+    std::ofstream file(path);
+    file << "{\"traceEvents\": [" << std::endl;
+
+    // Loop through entries
+    // **NOTE** each kernel gets its own track and populations are laid end-to-end along it
+    std::map<std::string, std::pair<size_t, double>> tracks;
+    for(const auto &e : entries) {
+        auto track = tracks.try_emplace(e.kernel, tracks.size(), 0.0).first;
+        const double timeMicroseconds = e.time * 1.0E6;
+        file << "\t{\"name\": \"" << e.population << "\", \"cat\": \"" << e.kernel << "\", \"ph\": \"X\", ";
+        file << "\"ts\": " << track->second.second << ", \"dur\": " << timeMicroseconds << ", ";
+        file << "\"pid\": 0, \"tid\": " << track->second.first << ", ";
+        file << "\"args\": {\"merged_group\": " << e.mergedGroupIndex << ", \"calls\": " << e.calls;
+        file << ", \"neurons\": " << e.neurons << ", \"spikes\": " << e.spikes << ", \"synapses\": " << e.synapses << "}}," << std::endl;
+        track->second.second += timeMicroseconds;
+    }
+
+    // Write metadata events to name tracks after kernels
+    file << "\t{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": {\"name\": \"" << getModel().getName() << "\"}}";
+    for(const auto &t : tracks) {
+        file << "," << std::endl;
+        file << "\t{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << t.second.first << ", \"args\": {\"name\": \"" << t.first << "\"}}";
+    }
+    file << std::endl << "]}" << std::endl;
+}
+//----------------------------------------------------------------------------
 void Runtime::pullRecordingBuffersFromDevice() const
 {
     if(!m_NumRecordingTimesteps) {
@@ -737,6 +1247,26 @@ void Runtime::pullRecordingBuffersFromDevice() const
             getArray(n.second, "recordSpk")->pullFromDevice();
         }
 
+        // If spike count recording is enabled, pull array from device
+        if(n.second.isSpikeCountRecordingEnabled()) {
+            getArray(n.second, "recordSpkCnt")->pullFromDevice();
+        }
+
+        // Pull recording buffers of any traced neuron, current source and postsynaptic model variables from device
+        for(const auto &t : n.second.getVarTraces()) {
+            getArray(n.second, "recordTrace" + t.first)->pullFromDevice();
+        }
+        for(const auto *cs : n.second.getCurrentSources()) {
+            for(const auto &t : cs->getVarTraces()) {
+                getArray(*cs, "recordTrace" + t.first)->pullFromDevice();
+            }
+        }
+        for(const auto *sg : n.second.getFusedPSMInSyn()) {
+            for(const auto &t : sg->getPSVarTraces()) {
+                getArray(*sg, "recordTrace" + t.first)->pullFromDevice();
+            }
+        }
+
         // If spike event recording is enabled, pull array from device
         if(n.second.isSpikeEventRecordingEnabled()) {
             for(const auto *sg : n.second.getFusedSpikeEvent()) {
@@ -825,6 +1355,22 @@ void *Runtime::getSymbol(const std::string &symbolName, bool allowMissing) const
     }
 }
 //----------------------------------------------------------------------------
+void *Runtime::getContextSymbol(const std::string &symbolName) const
+{
+    // If there's no context, symbol will be exported from library
+    if(!m_Context) {
+        return getSymbol(symbolName);
+    }
+    // Otherwise, look up symbol within context
+    else {
+        void *symbol = m_GetContextSymbol(m_Context, symbolName.c_str());
+        if(!symbol) {
+            throw std::runtime_error("Cannot find context symbol '" + symbolName + "'");
+        }
+        return symbol;
+    }
+}
+//----------------------------------------------------------------------------
 const ModelSpecInternal &Runtime::getModel() const
 {
     return m_ModelMerged.get().getModel();
@@ -843,6 +1389,19 @@ void Runtime::createArray(ArrayMap &groupArrays, const std::string &varName, con
     }
 }
 //----------------------------------------------------------------------------
+void Runtime::shareArray(const Runtime &source, const SynapseGroup &group, const std::string &varName)
+{
+    const auto &sourceArray = source.m_SynapseGroupArrays.at(&group).at(varName);
+    const auto r = m_SynapseGroupArrays[&group].try_emplace(varName, sourceArray);
+    if(r.second) {
+        LOGD_RUNTIME << "\tArray '" << varName << "' shared with another instance (" << sourceArray.get() << ")";
+    }
+    else {
+        throw std::runtime_error("Unable to share array with " 
+                                 "duplicate name '" + varName + "'");
+    }
+}
+//----------------------------------------------------------------------------
 void Runtime::createDynamicParamDestinations(std::unordered_map<std::string, std::pair<Type::ResolvedType, MergedDynamicFieldDestinations>> &destinations, 
                                              const std::string &paramName, const Type::ResolvedType &type, unsigned int logIndent)
 {
@@ -914,6 +1473,97 @@ Runtime::BatchEventArray Runtime::getRecordedEvents(unsigned int numNeurons, Arr
     return events;
 }
 //----------------------------------------------------------------------------
+void Runtime::setSparseConnections(const SynapseGroup &group, const unsigned int *preInds, const unsigned int *postInds,
+                                   size_t numSynapses, size_t *synapseOrder)
+{
+    const auto &groupInternal = static_cast<const SynapseGroupInternal&>(group);
+    if(!(group.getMatrixType() & SynapseMatrixConnectivity::SPARSE)) {
+        throw std::runtime_error("Synapse group '" + group.getName() + "' does not have sparse connectivity");
+    }
+    if(group.getSharedConnectivityTarget() != nullptr) {
+        throw std::runtime_error("Synapse group '" + group.getName() + "' shares connectivity with synapse group '" 
+                                 + group.getSharedConnectivityTarget()->getName() + "' so connections must be set on it instead");
+    }
+
+    // Get row length and index arrays and check they are accessible on host
+    auto *rowLengthArray = getArray(group, "rowLength");
+    auto *indArray = getArray(group, "ind");
+    if(rowLengthArray->getHostPointer() == nullptr || indArray->getHostPointer() == nullptr) {
+        throw std::runtime_error("Sparse connectivity of synapse group '" + group.getName() + "' must be located on host to be set");
+    }
+
+    // Count synapses in each row, validating indices as we go
+    const unsigned int numPre = groupInternal.getSrcNeuronGroup()->getNumNeurons();
+    const unsigned int numPost = groupInternal.getTrgNeuronGroup()->getNumNeurons();
+    std::vector<uint32_t> rowCounts(numPre, 0);
+    for(size_t s = 0; s < numSynapses; s++) {
+        if(preInds[s] >= numPre || postInds[s] >= numPost) {
+            throw std::runtime_error("Synapse " + std::to_string(s) + " of synapse group '" + group.getName() + "' has out of range indices");
+        }
+        rowCounts[preInds[s]]++;
+    }
+
+    // Check no rows exceed maximum
+    const auto maxRow = std::max_element(rowCounts.cbegin(), rowCounts.cend());
+    if(maxRow != rowCounts.cend() && *maxRow > group.getMaxConnections()) {
+        throw std::runtime_error("Synapse group '" + group.getName() + "' has rows with " + std::to_string(*maxRow) 
+                                 + " synapses but max connections is " + std::to_string(group.getMaxConnections()));
+    }
+
+    // Build ragged structure directly in index array using appropriate type
+    const size_t rowStride = getSynapticMatrixRowStride(group);
+    const auto &indType = groupInternal.getSparseIndType();
+    if(indType == Type::Uint8) {
+        buildSparseConnectivity(preInds, postInds, numSynapses, rowCounts, rowStride, 
+                                reinterpret_cast<uint8_t*>(indArray->getHostPointer()), synapseOrder);
+    }
+    else if(indType == Type::Uint16) {
+        buildSparseConnectivity(preInds, postInds, numSynapses, rowCounts, rowStride, 
+                                reinterpret_cast<uint16_t*>(indArray->getHostPointer()), synapseOrder);
+    }
+    else {
+        assert(indType == Type::Uint32);
+        buildSparseConnectivity(preInds, postInds, numSynapses, rowCounts, rowStride, 
+                                reinterpret_cast<uint32_t*>(indArray->getHostPointer()), synapseOrder);
+    }
+
+    // Copy row lengths
+    std::copy(rowCounts.cbegin(), rowCounts.cend(), reinterpret_cast<uint32_t*>(rowLengthArray->getHostPointer()));
+}
+//----------------------------------------------------------------------------
+std::vector<std::vector<uint32_t>> Runtime::getRecordedSpikeCounts(const NeuronGroup &group) const
+{
+    if(!m_NumRecordingTimesteps) {
+        throw std::runtime_error("Recording buffer not allocated - cannot get recorded spike counts");
+    }
+
+    if(m_Timestep < *m_NumRecordingTimesteps) {
+        throw std::runtime_error("Spike count recording data can only be accessed once buffer is full");
+    }
+
+    // Loop through timesteps and de-interleave batches
+    const size_t batchSize = getModel().getBatchSize();
+    const uint32_t *spkCntRecord = reinterpret_cast<const uint32_t*>(getArray(group, "recordSpkCnt")->getHostPointer());
+    std::vector<std::vector<uint32_t>> counts(batchSize);
+    for(size_t t = 0; t < m_NumRecordingTimesteps.value(); t++) {
+        for(size_t b = 0; b < batchSize; b++) {
+            counts[b].push_back(*spkCntRecord++);
+        }
+    }
+    return counts;
+}
+//----------------------------------------------------------------------------
+void Runtime::checkRecordedVarTrace(const std::map<std::string, VarTrace> &traces, const std::string &varName) const
+{
+    if(!m_NumRecordingTimesteps) {
+        throw std::runtime_error("Recording buffer not allocated - cannot get recorded trace");
+    }
+
+    if(traces.find(varName) == traces.cend()) {
+        throw std::runtime_error("Variable '" + varName + "' is not being traced");
+    }
+}
+//----------------------------------------------------------------------------
 void Runtime::writeRecordedEvents(unsigned int numNeurons, ArrayBase *array, const std::string &path) const
 {
     // Get events
@@ -944,21 +1594,29 @@ void Runtime::writeRecordedEvents(unsigned int numNeurons, ArrayBase *array, con
     }
 }
 //----------------------------------------------------------------------------
-void Runtime::setDynamicParamValue(const std::pair<Type::ResolvedType, MergedDynamicFieldDestinations> &mergedDestinations, 
+void Runtime::setDynamicParamValue(std::pair<Type::ResolvedType, MergedDynamicFieldDestinations> &mergedDestinations, 
                                    const Type::NumericValue &value)
 {
+    // Record value so it is used if merged groups are re-pushed
+    mergedDestinations.second.setValue(value);
+
     // Serailise new value
     std::vector<std::byte> valueStorage;
     Type::serialiseNumeric(value, mergedDestinations.first, valueStorage);
 
-    // Build FFI arguments
-    ffi_type *argumentTypes[2]{&ffi_type_uint, mergedDestinations.first.getFFIType()};
+    // Build FFI arguments, starting with context if there is one
+    std::vector<ffi_type*> argumentTypes;
+    if(m_Context) {
+        argumentTypes.push_back(&ffi_type_pointer);
+    }
+    argumentTypes.push_back(&ffi_type_uint);
+    argumentTypes.push_back(mergedDestinations.first.getFFIType());
 
     // Prepare an FFI Call InterFace for calls to push merged
     // **TODO** cache - these are the same for all calls with same datatype
     ffi_cif cif;
-    ffi_status status = ffi_prep_cif(&cif, FFI_DEFAULT_ABI, 2,
-                                     &ffi_type_void, argumentTypes);
+    ffi_status status = ffi_prep_cif(&cif, FFI_DEFAULT_ABI, argumentTypes.size(),
+                                     &ffi_type_void, argumentTypes.data());
     if (status != FFI_OK) {
         throw std::runtime_error("ffi_prep_cif failed: " + std::to_string(status));
     }
@@ -972,8 +1630,13 @@ void Runtime::setDynamicParamValue(const std::pair<Type::ResolvedType, MergedDyn
 
         // Call function
         unsigned int groupIndex = d.second.groupIndex;
-        void *argumentPointers[2]{&groupIndex, valueStorage.data()};
-        ffi_call(&cif, FFI_FN(pushFunction), nullptr, argumentPointers);
+        std::vector<void*> argumentPointers;
+        if(m_Context) {
+            argumentPointers.push_back(&m_Context);
+        }
+        argumentPointers.push_back(&groupIndex);
+        argumentPointers.push_back(valueStorage.data());
+        ffi_call(&cif, FFI_FN(pushFunction), nullptr, argumentPointers.data());
     }
 }
 //----------------------------------------------------------------------------
@@ -1002,15 +1665,20 @@ void Runtime::allocateExtraGlobalParam(ArrayMap &groupArrays, const std::string
         array->serialiseHostObject(serialisedHostObject, false);
     }
 
-    // Build FFI arguments
+    // Build FFI arguments, starting with context if there is one
     // **TODO** allow backend to override type
-    ffi_type *argumentTypes[2]{&ffi_type_uint, &ffi_type_pointer};
+    std::vector<ffi_type*> argumentTypes;
+    if(m_Context) {
+        argumentTypes.push_back(&ffi_type_pointer);
+    }
+    argumentTypes.push_back(&ffi_type_uint);
+    argumentTypes.push_back(&ffi_type_pointer);
 
     // Prepare an FFI Call InterFace for calls to push merged
     // **TODO** cache - these are the same for all EGP calls
     ffi_cif cif;
-    ffi_status status = ffi_prep_cif(&cif, FFI_DEFAULT_ABI, 2,
-                                     &ffi_type_void, argumentTypes);
+    ffi_status status = ffi_prep_cif(&cif, FFI_DEFAULT_ABI, argumentTypes.size(),
+                                     &ffi_type_void, argumentTypes.data());
     if (status != FFI_OK) {
         throw std::runtime_error("ffi_prep_cif failed: " + std::to_string(status));
     }
@@ -1025,28 +1693,32 @@ void Runtime::allocateExtraGlobalParam(ArrayMap &groupArrays, const std::string
 
         // Call function
         unsigned int groupIndex = d.second.groupIndex;
-        void *argumentPointers[2]{&groupIndex, nullptr};
+        std::vector<void*> argumentPointers;
+        if(m_Context) {
+            argumentPointers.push_back(&m_Context);
+        }
+        argumentPointers.push_back(&groupIndex);
         if(d.second.fieldType & GroupMergedFieldType::HOST) {
             assert(!serialisedHostPointer.empty());
-            argumentPointers[1] = serialisedHostPointer.data();
+            argumentPointers.push_back(serialisedHostPointer.data());
         }
         else if(d.second.fieldType & GroupMergedFieldType::HOST_OBJECT) {
             assert(!serialisedHostObject.empty());
-            argumentPointers[1] = serialisedHostObject.data();
+            argumentPointers.push_back(serialisedHostObject.data());
         }
         // Serialise device object if backend requires it
         else {
             if(m_Backend.get().isArrayDeviceObjectRequired()) {
                 assert(!serialisedDeviceObject.empty());
-                argumentPointers[1] = serialisedDeviceObject.data();
+                argumentPointers.push_back(serialisedDeviceObject.data());
             }
             // Otherwise, host pointer
             else {
                 assert(!serialisedHostPointer.empty());
-                argumentPointers[1] = serialisedHostPointer.data();
+                argumentPointers.push_back(serialisedHostPointer.data());
             }
         }
-        ffi_call(&cif, FFI_FN(pushFunction), nullptr, argumentPointers);
+        ffi_call(&cif, FFI_FN(pushFunction), nullptr, argumentPointers.data());
     }
 }
 }   // namespace GeNN::Runtime
@@ -13,6 +13,43 @@
 #include "synapseGroupInternal.h"
 #include "type.h"
 
+//----------------------------------------------------------------------------
+// Anonymous namespace
+//----------------------------------------------------------------------------
+namespace
+{
+//! Estimated cost of processing a synapse, relative to reading a single 64-bit word
+//! **NOTE** these are rough single-threaded CPU figures used to rank alternative matrix types
+constexpr double synapseCost = 1.0;
+constexpr double bitmaskBitCost = 0.125;
+constexpr double proceduralRNGSynapseCost = 4.0;
+constexpr double proceduralInitVarCost = 1.0;
+
+//! Estimated memory and per-spike cost of a matrix type
+struct MatrixTypeCost
+{
+    GeNN::SynapseMatrixType type;
+    size_t memoryBytes;
+    double spikeCost;
+};
+
+const char *getMatrixTypeName(GeNN::SynapseMatrixType type)
+{
+    using namespace GeNN;
+    switch(type) {
+    case SynapseMatrixType::DENSE:                  return "DENSE";
+    case SynapseMatrixType::DENSE_PROCEDURALG:      return "DENSE_PROCEDURALG";
+    case SynapseMatrixType::BITMASK:                return "BITMASK";
+    case SynapseMatrixType::SPARSE:                 return "SPARSE";
+    case SynapseMatrixType::PROCEDURAL:             return "PROCEDURAL";
+    case SynapseMatrixType::PROCEDURAL_KERNELG:     return "PROCEDURAL_KERNELG";
+    case SynapseMatrixType::TOEPLITZ:               return "TOEPLITZ";
+    case SynapseMatrixType::AUTO:                   return "AUTO";
+    }
+    return "UNKNOWN";
+}
+}   // Anonymous namespace
+
 // ------------------------------------------------------------------------
 // GeNN::SynapseGroup
 // ------------------------------------------------------------------------
@@ -66,6 +103,18 @@ void SynapseGroup::setPSExtraGlobalParamLocation(const std::string &paramName, V
     m_PSExtraGlobalParamLocation.set(paramName, loc); 
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setPSVarTraceRecording(const std::string &varName, const std::vector<unsigned int> &neuronIDs, unsigned int interval)
+{
+    const auto var = getPSInitialiser().getSnippet()->getVar(varName);
+    if(!var) {
+        throw std::runtime_error("Unknown postsynaptic model variable '" + varName + "'");
+    }
+    if(!(getVarAccessDim(var->access) & VarAccessDim::ELEMENT)) {
+        throw std::runtime_error("Cannot record trace of shared postsynaptic model variable '" + varName + "'");
+    }
+    m_PSVarTraces.set(varName, neuronIDs, interval, getTrgNeuronGroup()->getNumNeurons());
+}
+//----------------------------------------------------------------------------
 void SynapseGroup::setPSParamDynamic(const std::string &paramName, bool dynamic) 
 { 
     if(!getPSInitialiser().getSnippet()->getParam(paramName)) {
@@ -163,6 +212,13 @@ void SynapseGroup::setMaxDendriticDelayTimesteps(unsigned int maxDendriticDelayT
         throw std::runtime_error("setMaxDendriticDelayTimesteps: A minimum of one dendritic delay timestep is required.");
     }
     m_MaxDendriticDelayTimesteps = maxDendriticDelayTimesteps;
+    updateDendriticDelayWheel();
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::setMaxDendriticDelayEvents(unsigned int maxDendriticDelayEvents)
+{
+    m_MaxDendriticDelayEvents = maxDendriticDelayEvents;
+    updateDendriticDelayWheel();
 }
 //----------------------------------------------------------------------------
 void SynapseGroup::setAxonalDelaySteps(unsigned int timesteps)
@@ -189,6 +245,36 @@ void SynapseGroup::setNarrowSparseIndEnabled(bool enabled)
     }
 }
 //----------------------------------------------------------------------------
+void SynapseGroup::setSharedConnectivityTarget(const SynapseGroup *target)
+{
+    if(target == this) {
+        throw std::runtime_error("setSharedConnectivityTarget: Synapse group '" + getName() + "' cannot share its own connectivity.");
+    }
+    
+    // If a target is specified
+    if(target != nullptr) {
+        if(target->getSharedConnectivityTarget() != nullptr) {
+            throw std::runtime_error("setSharedConnectivityTarget: Synapse group '" + target->getName() + "' itself shares connectivity with another synapse group.");
+        }
+        if(getMatrixType() != SynapseMatrixType::SPARSE || target->getMatrixType() != SynapseMatrixType::SPARSE) {
+            throw std::runtime_error("setSharedConnectivityTarget: Connectivity can only be shared between synapse groups with SPARSE matrix type.");
+        }
+        if(getSrcNeuronGroup() != target->getSrcNeuronGroup() || getTrgNeuronGroup() != target->getTrgNeuronGroup()) {
+            throw std::runtime_error("setSharedConnectivityTarget: Connectivity can only be shared between synapse groups connecting the same neuron groups.");
+        }
+
+        // **NOTE** the connectivity of synapse groups using the same deterministic 
+        // initialisation snippet and parameters would be identical anyway, whereas
+        // sharing stochastically-initialised connectivity is the point of this feature
+        const auto &connectInit = getSparseConnectivityInitialiser();
+        const auto &targetConnectInit = target->getSparseConnectivityInitialiser();
+        if(connectInit.getSnippet() != targetConnectInit.getSnippet() || connectInit.getParams() != targetConnectInit.getParams()) {
+            throw std::runtime_error("setSharedConnectivityTarget: Connectivity can only be shared between synapse groups with the same sparse connectivity initialiser.");
+        }
+    }
+    m_SharedConnectivityTarget = target;
+}
+//----------------------------------------------------------------------------
 size_t SynapseGroup::getKernelSizeFlattened() const
 {
     return std::accumulate(getKernelSize().cbegin(), getKernelSize().cend(), 1, std::multiplies<unsigned int>());
@@ -282,6 +368,7 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                            VarLocation defaultVarLocation, VarLocation defaultExtraGlobalParamLocation,
                            VarLocation defaultSparseConnectivityLocation, bool defaultNarrowSparseIndEnabled)
     :   m_Name(name), m_ParallelismHint(ParallelismHint::POSTSYNAPTIC), m_NumThreadsPerSpike(1), m_AxonalDelaySteps(0), m_BackPropDelaySteps(0),
+        m_MaxDendriticDelayEvents(0), m_DendriticDelayWheelEnabled(false), m_RowCapacitySlack(0),
         m_MatrixType(matrixType),  m_SrcNeuronGroup(srcNeuronGroup), m_TrgNeuronGroup(trgNeuronGroup), 
         m_NarrowSparseIndEnabled(defaultNarrowSparseIndEnabled),
         m_OutputLocation(defaultVarLocation),  m_DendriticDelayLocation(defaultVarLocation),
@@ -289,7 +376,8 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
         m_WUVarLocation(defaultVarLocation), m_WUPreVarLocation(defaultVarLocation), m_WUPostVarLocation(defaultVarLocation), m_WUExtraGlobalParamLocation(defaultExtraGlobalParamLocation), 
         m_PSVarLocation(defaultVarLocation),  m_PSExtraGlobalParamLocation(defaultExtraGlobalParamLocation), m_SparseConnectivityLocation(defaultSparseConnectivityLocation),
         m_FusedPSTarget(nullptr), m_FusedPreSpikeTarget(nullptr), m_FusedPostSpikeTarget(nullptr), m_FusedPreSpikeEventTarget(nullptr), m_FusedPostSpikeEventTarget(nullptr),
-        m_FusedWUPreTarget(nullptr), m_FusedWUPostTarget(nullptr), m_FusedPreOutputTarget(nullptr), m_PostTargetVar("Isyn"), m_PreTargetVar("Isyn")
+        m_FusedWUPreTarget(nullptr), m_FusedWUPostTarget(nullptr), m_FusedPreOutputTarget(nullptr), m_PostTargetVar("Isyn"), m_PreTargetVar("Isyn"),
+        m_SharedConnectivityTarget(nullptr)
 {
     // 'Resolve' local variable references
     Models::resolveVarReferences(getWUInitialiser().getPreNeuronVarReferences(),
@@ -328,6 +416,12 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
                                     getTrgNeuronGroup(), "Postsynaptic model variable references can only point to postsynaptic neuron group.",
                                     &Models::VarReference::isTargetNeuronGroup);
 
+    // Validate matrix type and calculate connectivity dimensions it implies
+    initMatrixType();
+ }
+//----------------------------------------------------------------------------
+void SynapseGroup::initMatrixType()
+{
     // If connectivity is procedural
     if(m_MatrixType & SynapseMatrixConnectivity::PROCEDURAL) {
         // If there's a toeplitz initialiser, give an error
@@ -399,7 +493,7 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
         // If toeplitz initialisation snippet provides a function to calculate max row length, call it
         auto calcMaxRowLengthFunc = m_ToeplitzConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
         if(calcMaxRowLengthFunc) {
-            m_MaxConnections = calcMaxRowLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
+            m_MaxConnections = calcMaxRowLengthFunc(getSrcNeuronGroup()->getNumNeurons(), getTrgNeuronGroup()->getNumNeurons(),
                                                     m_ToeplitzConnectivityInitialiser.getParams());
         }
         else {
@@ -421,34 +515,44 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
         // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
         auto calcMaxRowLengthFunc = m_SparseConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
         if(calcMaxRowLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
-            m_MaxConnections = calcMaxRowLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
+            m_MaxConnections = calcMaxRowLengthFunc(getSrcNeuronGroup()->getNumNeurons(), getTrgNeuronGroup()->getNumNeurons(),
                                                     m_SparseConnectivityInitialiser.getParams());
         }
         // Otherwise, default to the size of the target population
         else {
-            m_MaxConnections = trgNeuronGroup->getNumNeurons();
+            m_MaxConnections = getTrgNeuronGroup()->getNumNeurons();
         }
 
         // If connectivitity initialisation snippet provides a function to calculate row length, call it
         // **NOTE** only do this for sparse connectivity as this should not be set for bitmasks
         auto calcMaxColLengthFunc = m_SparseConnectivityInitialiser.getSnippet()->getCalcMaxColLengthFunc();
         if(calcMaxColLengthFunc && (m_MatrixType & SynapseMatrixConnectivity::SPARSE)) {
-            m_MaxSourceConnections = calcMaxColLengthFunc(srcNeuronGroup->getNumNeurons(), trgNeuronGroup->getNumNeurons(),
+            m_MaxSourceConnections = calcMaxColLengthFunc(getSrcNeuronGroup()->getNumNeurons(), getTrgNeuronGroup()->getNumNeurons(),
                                                           m_SparseConnectivityInitialiser.getParams());
         }
         // Otherwise, default to the size of the source population
         else {
-            m_MaxSourceConnections = srcNeuronGroup->getNumNeurons();
+            m_MaxSourceConnections = getSrcNeuronGroup()->getNumNeurons();
         }
     }
 
     // If connectivity initialisation snippet defines a kernel and matrix type doesn't support it, give error
+    // **NOTE** AUTO matrix types will be resolved to one which supports it
     if(!m_KernelSize.empty() && (m_MatrixType != SynapseMatrixType::PROCEDURAL) && (m_MatrixType != SynapseMatrixType::TOEPLITZ)
-       && (m_MatrixType != SynapseMatrixType::SPARSE) && (m_MatrixType != SynapseMatrixType::PROCEDURAL_KERNELG)) 
+       && (m_MatrixType != SynapseMatrixType::SPARSE) && (m_MatrixType != SynapseMatrixType::PROCEDURAL_KERNELG)
+       && (m_MatrixType != SynapseMatrixType::AUTO)) 
     {
         throw std::runtime_error("BITMASK connectivity can only be used with weight update models without variables like StaticPulseConstantWeight.");
     }
 
+    // If weight update model has lazily-decayed variables and they aren't stored per-synapse, give error
+    // **NOTE** AUTO matrix types will be resolved to one which supports it
+    if(!getWUInitialiser().getSnippet()->getLazyDecayVars().empty() && (m_MatrixType != SynapseMatrixType::DENSE)
+       && (m_MatrixType != SynapseMatrixType::SPARSE) && (m_MatrixType != SynapseMatrixType::AUTO))
+    {
+        throw std::runtime_error("Weight update models with lazily-decayed variables can only be used with DENSE or SPARSE connectivity.");
+    }
+
     // If connectivity is dense and there is connectivity initialiser code, give error
     if((m_MatrixType & SynapseMatrixConnectivity::DENSE) 
        && (!Utils::areTokensEmpty(m_SparseConnectivityInitialiser.getRowBuildCodeTokens()) 
@@ -465,7 +569,7 @@ SynapseGroup::SynapseGroup(const std::string &name, SynapseMatrixType matrixType
     {
         throw std::runtime_error("Variable initialisation snippets which use $(id_kernel) must be used with a connectivity initialisation snippet which specifies how kernel size is calculated.");
     }
- }
+}
 //----------------------------------------------------------------------------
 void SynapseGroup::setFusedPSTarget(const NeuronGroup *ng, const SynapseGroup &target)
 {
@@ -512,7 +616,178 @@ void SynapseGroup::setFusedPreOutputTarget(const NeuronGroup *ng, const SynapseG
     m_FusedPreOutputTarget = &target; 
 }
 //----------------------------------------------------------------------------
-void SynapseGroup::finalise(double dt)
+void SynapseGroup::updateDendriticDelayWheel()
+{
+    // If maximum number of events per timestep hasn't been specified, wheel can't be sized
+    if(m_MaxDendriticDelayEvents == 0) {
+        m_DendriticDelayWheelEnabled = false;
+    }
+    // Otherwise, compare the memory required by a bucket of the wheel with a slot of the ring buffer
+    // **NOTE** precision isn't known here so assume single-precision, which favours the ring buffer
+    else {
+        const size_t bucketBytes = ((size_t)m_MaxDendriticDelayEvents * (sizeof(uint32_t) + sizeof(float))) + sizeof(uint32_t);
+        const size_t slotBytes = (size_t)getTrgNeuronGroup()->getNumNeurons() * sizeof(float);
+        m_DendriticDelayWheelEnabled = (bucketBytes < slotBytes);
+    }
+
+    LOGD_GENN << "Synapse group '" << getName() << "' dendritic delays implemented using "
+              << (m_DendriticDelayWheelEnabled ? "sparse timing wheel" : "dense ring buffer");
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::demoteConstantReadOnlyPSVars()
+{
+    // **NOTE** variables which are referenced, delayed or traced need arrays
+    std::set<std::string> excludedVars(m_ReferencedPSVars);
+    excludedVars.insert(m_PSMVarQueueRequired.cbegin(), m_PSMVarQueueRequired.cend());
+    for(const auto &t : getPSVarTraces()) {
+        excludedVars.insert(t.first);
+    }
+    m_DemotedPSVars = Models::getConstantReadOnlyVars(getPSInitialiser().getSnippet()->getVars(), 
+                                                      getPSInitialiser().getVarInitialisers(), excludedVars);
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::resolveAutoMatrixType(const Type::TypeContext &typeContext, const std::function<bool(SynapseMatrixType)> &isMatrixTypeSupported,
+                                         size_t &memoryBudget)
+{
+    assert(m_MatrixType == SynapseMatrixType::AUTO);
+
+    const size_t numSrc = getSrcNeuronGroup()->getNumNeurons();
+    const size_t numTrg = getTrgNeuronGroup()->getNumNeurons();
+    const auto &wuVars = getWUInitialiser().getSnippet()->getVars();
+    const auto &wuVarInitialisers = getWUInitialiser().getVarInitialisers();
+
+    // Calculate size of all weight update model variables associated with one synapse
+    const size_t varBytes = std::accumulate(wuVars.cbegin(), wuVars.cend(), size_t{0},
+                                            [&typeContext](size_t acc, const auto &v)
+                                            { 
+                                                return acc + v.type.resolve(typeContext).getSize(sizeof(void*)); 
+                                            });
+
+    // Weights can only be regenerated, rather than stored, if nothing can ever update them
+    const bool plastic = (isPostSpikeRequired() || isPostSpikeEventRequired()
+                          || !Utils::areTokensEmpty(getWUInitialiser().getSynapseDynamicsCodeTokens())
+                          || std::any_of(wuVars.cbegin(), wuVars.cend(), 
+                                         [](const auto &v){ return !(v.access & VarAccessModeAttribute::READ_ONLY); }));
+
+    // Regenerating weights is cheaper if they are all constant
+    const bool constantWeights = std::all_of(wuVarInitialisers.cbegin(), wuVarInitialisers.cend(),
+                                             [](const auto &v)
+                                             { 
+                                                 return (v.second.getSnippet() == InitVarSnippet::Constant::getInstance()); 
+                                             });
+    const double initVarCost = constantWeights ? 0.0 : proceduralInitVarCost;
+
+    // Build list of compatible matrix types
+    std::vector<MatrixTypeCost> candidates;
+    const auto &sparseInit = m_SparseConnectivityInitialiser;
+    const bool rowBuild = !Utils::areTokensEmpty(sparseInit.getRowBuildCodeTokens());
+    const bool colBuild = !Utils::areTokensEmpty(sparseInit.getColBuildCodeTokens());
+    
+    // If there's a toeplitz connectivity initialiser, only TOEPLITZ connectivity is compatible
+    if(!Utils::areTokensEmpty(m_ToeplitzConnectivityInitialiser.getDiagonalBuildCodeTokens())) {
+        const auto calcKernelSizeFunc = m_ToeplitzConnectivityInitialiser.getSnippet()->getCalcKernelSizeFunc();
+        const auto calcMaxRowLengthFunc = m_ToeplitzConnectivityInitialiser.getSnippet()->getCalcMaxRowLengthFunc();
+        const auto &params = m_ToeplitzConnectivityInitialiser.getParams();
+        const auto kernelSize = calcKernelSizeFunc ? calcKernelSizeFunc(params) : std::vector<unsigned int>{};
+        const size_t maxRowLength = calcMaxRowLengthFunc ? calcMaxRowLengthFunc(numSrc, numTrg, params) : numTrg;
+        candidates.push_back({SynapseMatrixType::TOEPLITZ, 
+                              std::accumulate(kernelSize.cbegin(), kernelSize.cend(), size_t{1}, std::multiplies<size_t>()) * varBytes,
+                              maxRowLength * synapseCost});
+    }
+    // Otherwise, if there's no sparse connectivity initialiser, connectivity is dense
+    else if(!rowBuild && !colBuild) {
+        candidates.push_back({SynapseMatrixType::DENSE, numSrc * numTrg * varBytes,
+                              numTrg * (synapseCost + (varBytes / 8.0))});
+
+        // If weights are never updated and can be initialised without RNG, they can be generated on the fly
+        if(!plastic && !Utils::isRNGRequired(wuVarInitialisers)) {
+            candidates.push_back({SynapseMatrixType::DENSE_PROCEDURALG, 0,
+                                  numTrg * (synapseCost + initVarCost)});
+        }
+    }
+    // Otherwise, connectivity is sparse
+    else {
+        const auto calcMaxRowLengthFunc = sparseInit.getSnippet()->getCalcMaxRowLengthFunc();
+        const auto calcMaxColLengthFunc = sparseInit.getSnippet()->getCalcMaxColLengthFunc();
+        const size_t maxRowLength = calcMaxRowLengthFunc ? calcMaxRowLengthFunc(numSrc, numTrg, sparseInit.getParams()) : numTrg;
+        const size_t maxColLength = calcMaxColLengthFunc ? calcMaxColLengthFunc(numSrc, numTrg, sparseInit.getParams()) : numSrc;
+        const size_t kernelBytes = m_KernelSize.empty() ? 0 : (getKernelSizeFlattened() * varBytes);
+
+        // SPARSE connectivity is always compatible - use narrowest index type that can represent all target neurons
+        // **NOTE** variables initialised from kernels are still stored per-synapse and
+        // postsynaptic learning requires an additional column-major remapping structure
+        const size_t indBytes = (numTrg <= std::numeric_limits<uint8_t>::max()) ? 1 : ((numTrg <= std::numeric_limits<uint16_t>::max()) ? 2 : 4);
+        const size_t remapBytes = (isPostSpikeRequired() || isPostSpikeEventRequired()) ? (numTrg * sizeof(uint32_t) * (maxColLength + 1)) : 0;
+        candidates.push_back({SynapseMatrixType::SPARSE, 
+                              (numSrc * sizeof(uint32_t)) + (numSrc * maxRowLength * (indBytes + varBytes)) + remapBytes,
+                              maxRowLength * (synapseCost + ((indBytes + varBytes) / 8.0))});
+
+        // BITMASK connectivity is compatible with weight update models without any per-synapse state
+        if(wuVars.empty() && m_KernelSize.empty() && !plastic) {
+            candidates.push_back({SynapseMatrixType::BITMASK, ((numSrc * numTrg) + 31) / 32 * sizeof(uint32_t),
+                                  (numTrg * bitmaskBitCost) + (maxRowLength * synapseCost)});
+        }
+
+        // Connectivity can be generated on the fly if it is built row-wise and weights are never updated
+        if(rowBuild && !colBuild && !plastic) {
+            const double rowCost = Utils::isRNGRequired(sparseInit.getRowBuildCodeTokens()) ? proceduralRNGSynapseCost : synapseCost;
+            if(m_KernelSize.empty()) {
+                candidates.push_back({SynapseMatrixType::PROCEDURAL, 0, maxRowLength * (rowCost + initVarCost)});
+            }
+            else {
+                candidates.push_back({SynapseMatrixType::PROCEDURAL_KERNELG, kernelBytes, maxRowLength * (rowCost + (varBytes / 8.0))});
+            }
+        }
+    }
+
+    // Remove any candidates the backend can't generate code for
+    if(isMatrixTypeSupported) {
+        candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                        [&isMatrixTypeSupported](const auto &c){ return !isMatrixTypeSupported(c.type); }),
+                         candidates.end());
+    }
+
+    // Give error if there are no candidates left
+    if(candidates.empty()) {
+        throw std::runtime_error("Synapse group '" + getName() + "' has AUTO matrix type but backend does not support any compatible matrix types.");
+    }
+
+    // Select fastest candidate which fits within memory budget
+    auto chosen = candidates.cend();
+    for(auto c = candidates.cbegin(); c != candidates.cend(); c++) {
+        if(c->memoryBytes <= memoryBudget && (chosen == candidates.cend() || c->spikeCost < chosen->spikeCost)) {
+            chosen = c;
+        }
+    }
+
+    // If nothing fits, select candidate which uses least memory
+    if(chosen == candidates.cend()) {
+        chosen = std::min_element(candidates.cbegin(), candidates.cend(),
+                                  [](const auto &a, const auto &b){ return a.memoryBytes < b.memoryBytes; });
+        LOGW_GENN << "Synapse group '" << getName() << "' has no matrix type which fits within remaining memory budget of " << memoryBudget << " bytes";
+    }
+
+    // Log all candidates
+    for(const auto &c : candidates) {
+        LOGD_GENN << "\t" << getMatrixTypeName(c.type) << ": " << c.memoryBytes << " bytes, cost " << c.spikeCost << " per presynaptic spike";
+    }
+    LOGI_GENN << "Synapse group '" << getName() << "' AUTO matrix type resolved to " << getMatrixTypeName(chosen->type)
+              << " (estimated " << chosen->memoryBytes << " bytes, cost " << chosen->spikeCost << " per presynaptic spike)";
+
+    // Deduct memory from budget
+    memoryBudget -= std::min(memoryBudget, chosen->memoryBytes);
+
+    // Update matrix type, always using narrow indices with SPARSE connectivity 
+    m_MatrixType = chosen->type;
+    if(m_MatrixType == SynapseMatrixType::SPARSE) {
+        m_NarrowSparseIndEnabled = true;
+    }
+
+    // Re-validate matrix type and recalculate connectivity dimensions
+    initMatrixType();
+}
+//----------------------------------------------------------------------------
+void SynapseGroup::finalise(double dt, unsigned int batchSize)
 {
     // Finalise derived parameters in Init objects
     m_PSInitialiser.finalise(dt);
@@ -520,6 +795,40 @@ void SynapseGroup::finalise(double dt)
     m_SparseConnectivityInitialiser.finalise(dt);
     m_ToeplitzConnectivityInitialiser.finalise(dt);
 
+    // If connectivity is shared with another synapse group, 
+    // copy the properties which determine the layout of it's data structure
+    if(m_SharedConnectivityTarget) {
+        m_MaxConnections = m_SharedConnectivityTarget->getMaxConnections();
+        m_MaxSourceConnections = m_SharedConnectivityTarget->getMaxSourceConnections();
+        m_NarrowSparseIndEnabled = m_SharedConnectivityTarget->m_NarrowSparseIndEnabled;
+    }
+
+    // If row capacity is reallocated at runtime, check connectivity is sparse and not shared
+    // **NOTE** synapse groups sharing connectivity would need to be reallocated together
+    if(isRowCapacityGrowable()) {
+        if(getMatrixType() != SynapseMatrixType::SPARSE) {
+            throw std::runtime_error("Synapse group '" + getName() + "' has row capacity slack but row capacity can only be reallocated for SPARSE connectivity");
+        }
+        if(m_SharedConnectivityTarget) {
+            throw std::runtime_error("Synapse group '" + getName() + "' has row capacity slack but shares connectivity with another synapse group");
+        }
+
+        // **NOTE** columns of the postsynaptic remap aren't reallocated so must be able to hold every presynaptic neuron
+        if((isPostSpikeRequired() || isPostSpikeEventRequired()) && getMaxSourceConnections() < getSrcNeuronGroup()->getNumNeurons()) {
+            throw std::runtime_error("Synapse group '" + getName() + "' has row capacity slack and postsynaptic learning so "
+                                     "its maximum source connections must be set to the number of presynaptic neurons");
+        }
+    }
+    if(m_SharedConnectivityTarget && m_SharedConnectivityTarget->isRowCapacityGrowable()) {
+        throw std::runtime_error("Synapse group '" + getName() + "' cannot share connectivity with synapse group '"
+                                 + m_SharedConnectivityTarget->getName() + "' which has row capacity slack");
+    }
+
+    // **NOTE** batching would require a separate timing wheel per batch
+    if(isDendriticDelayWheelEnabled() && batchSize > 1) {
+        throw std::runtime_error("Synapse group '" + getName() + "' uses a dendritic delay timing wheel which is not supported with a batch size greater than 1");
+    }
+
     // Determine whether any postsynaptic neuron variable references 
     // are accessed with heterogeneous delays in synapse code
     bool heterogeneousVarDelay = std::any_of(getWUMPostNeuronVarReferences().cbegin(), getWUMPostNeuronVarReferences().cend(),
@@ -637,6 +946,11 @@ bool SynapseGroup::canPSBeFused(const NeuronGroup *ng) const
 {
     assert(ng == getTrgNeuronGroup());
 
+    // If any postsynaptic model variables are being traced, they need their own arrays so can't be fused
+    if(!m_PSVarTraces.empty()) {
+        return false;
+    }
+
     // If any postsynaptic model variables aren't initialised to constant values, this synapse group's postsynaptic model can't be merged
     // **NOTE** hash check will compare these constant values
     if(std::any_of(getPSInitialiser().getVarInitialisers().cbegin(), getPSInitialiser().getVarInitialisers().cend(), 
@@ -750,6 +1064,18 @@ bool SynapseGroup::canWUMPrePostUpdateBeFused(const NeuronGroup *ng) const
     return true;
 }
 //----------------------------------------------------------------------------
+bool SynapseGroup::isSharedConnectivityPreSpikeFused() const
+{
+    // Presynaptic spikes can only be processed within the traversal of the target synapse group's rows if
+    // both groups process them, nothing else is processed presynaptically and their spikes are identically delayed
+    // **NOTE** dendritic delay and presynaptic output buffers are only accessible by the target synapse group
+    return (m_SharedConnectivityTarget != nullptr && isPreSpikeRequired() && !isPreSpikeEventRequired()
+            && m_SharedConnectivityTarget->isPreSpikeRequired()
+            && getAxonalDelaySteps() == m_SharedConnectivityTarget->getAxonalDelaySteps()
+            && getBackPropDelaySteps() == m_SharedConnectivityTarget->getBackPropDelaySteps()
+            && !isDendriticOutputDelayRequired() && !isPresynapticOutputRequired());
+}
+//----------------------------------------------------------------------------
 bool SynapseGroup::isDendriticOutputDelayRequired() const
 {
     return (Utils::isIdentifierReferenced("addToPostDelay", getWUInitialiser().getPreSpikeSynCodeTokens())
@@ -864,9 +1190,10 @@ bool SynapseGroup::isWUPostVarInitRequired() const
 //----------------------------------------------------------------------------
 bool SynapseGroup::isSparseConnectivityInitRequired() const
 {
-    // Return true if the matrix type is sparse or bitmask 
-    // and there is code to initialise sparse connectivity 
-    return (((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
+    // Return true if the matrix type is sparse or bitmask, there is code to initialise 
+    // sparse connectivity and connectivity isn't shared with another synapse group
+    return (!m_SharedConnectivityTarget 
+            && ((m_MatrixType & SynapseMatrixConnectivity::SPARSE) || (m_MatrixType & SynapseMatrixConnectivity::BITMASK))
             && (!Utils::areTokensEmpty(getSparseConnectivityInitialiser().getRowBuildCodeTokens()) 
                 || !Utils::areTokensEmpty(getSparseConnectivityInitialiser().getColBuildCodeTokens())));
 }
@@ -930,7 +1257,10 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUHashDigest() const
     Utils::updateHash(getAxonalDelaySteps(), hash);
     Utils::updateHash(getBackPropDelaySteps(), hash);
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(isDendriticDelayWheelEnabled(), hash);
+    Utils::updateHash(getMaxDendriticDelayEvents(), hash);
     Type::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isRowCapacityGrowable(), hash);
     Utils::updateHash(getNumThreadsPerSpike(), hash);
     Utils::updateHash(getParallelismHint(), hash);
     Utils::updateHash(isPSModelFused(), hash);
@@ -984,6 +1314,22 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUHashDigest() const
         Utils::updateHash(v.second.getVarDims(), hash);
     }
 
+    // If presynaptic spikes are processed within the traversal of another synapse group, update hash with flag
+    if(isSharedConnectivityPreSpikeFused()) {
+        Utils::updateHash(true, hash);
+    }
+
+    // If presynaptic spikes of other synapse groups are processed within
+    // this synapse group's traversal, update hash with their sorted digests
+    // **NOTE** sorting matches the order their merged groups are built in
+    if(!m_FusedSharedConnectivitySyn.empty()) {
+        std::vector<boost::uuids::detail::sha1::digest_type> fusedDigests;
+        std::transform(m_FusedSharedConnectivitySyn.cbegin(), m_FusedSharedConnectivitySyn.cend(), std::back_inserter(fusedDigests),
+                       [](const SynapseGroupInternal *sg){ return sg->getWUHashDigest(); });
+        std::sort(fusedDigests.begin(), fusedDigests.end());
+        Utils::updateHash(fusedDigests, hash);
+    }
+
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -1023,10 +1369,16 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getPSHashDigest(const Neur
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getPSInitialiser().getSnippet()->getHashDigest(), hash);
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(isDendriticDelayWheelEnabled(), hash);
+    Utils::updateHash(getMaxDendriticDelayEvents(), hash);
     Utils::updateHash(getPostTargetVar(), hash);
     Utils::updateHash(m_PSMVarQueueRequired, hash);
     Utils::updateHash(m_HeterogeneouslyDelayedPSMVars, hash);
+    if(!m_DemotedPSVars.empty()) {
+        Utils::updateHash(m_DemotedPSVars, hash);
+    }
     m_PSDynamicParams.updateHash(hash);
+    m_PSVarTraces.updateHash(hash);
 
     // Loop through neuron variable references and update hash with 
     // name of target variable. These must be the same across merged group
@@ -1080,9 +1432,14 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getPSFuseHashDigest(const
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getPSInitialiser().getSnippet()->getHashDigest(), hash);
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(isDendriticDelayWheelEnabled(), hash);
+    Utils::updateHash(getMaxDendriticDelayEvents(), hash);
     Utils::updateHash(getPostTargetVar(), hash);
     Utils::updateHash(m_PSMVarQueueRequired, hash);
     Utils::updateHash(m_HeterogeneouslyDelayedPSMVars, hash);
+    if(!m_DemotedPSVars.empty()) {
+        Utils::updateHash(m_DemotedPSVars, hash);
+    }
     Utils::updateHash(getPSInitialiser().getParams(), hash);
     Utils::updateHash(getPSInitialiser().getDerivedParams(), hash);
     
@@ -1218,6 +1575,8 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getDendriticDelayUpdateHas
 {
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(isDendriticDelayWheelEnabled(), hash);
+    Utils::updateHash(getMaxDendriticDelayEvents(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -1226,6 +1585,7 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getWUInitHashDigest() cons
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getMatrixType(), hash);
     Type::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isRowCapacityGrowable(), hash);
     Utils::updateHash(getWUInitialiser().getSnippet()->getVars(), hash);
 
     Utils::updateHash(Utils::areTokensEmpty(getWUInitialiser().getSynapseDynamicsCodeTokens()), hash);
@@ -1268,8 +1628,13 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getPSInitHashDigest(const
 
     boost::uuids::detail::sha1 hash;
     Utils::updateHash(getMaxDendriticDelayTimesteps(), hash);
+    Utils::updateHash(isDendriticDelayWheelEnabled(), hash);
+    Utils::updateHash(getMaxDendriticDelayEvents(), hash);
     Utils::updateHash(m_PSMVarQueueRequired, hash);
     Utils::updateHash(m_HeterogeneouslyDelayedPSMVars, hash);
+    if(!m_DemotedPSVars.empty()) {
+        Utils::updateHash(m_DemotedPSVars, hash);
+    }
     Utils::updateHash(getPSInitialiser().getSnippet()->getVars(), hash);
 
     // Include postsynaptic model variable initialiser hashes
@@ -1303,6 +1668,7 @@ boost::uuids::detail::sha1::digest_type SynapseGroup::getConnectivityInitHashDig
     Utils::updateHash(getSparseConnectivityInitialiser().getHashDigest(), hash);
     Utils::updateHash(getMatrixType(), hash);
     Type::updateHash(getSparseIndType(), hash);
+    Utils::updateHash(isRowCapacityGrowable(), hash);
     return hash.get_digest();
 }
 //----------------------------------------------------------------------------
@@ -1,5 +1,9 @@
 #include "weightUpdateModels.h"
 
+// Standard C++ includes
+#include <algorithm>
+#include <set>
+
 // GeNN includes
 #include "gennUtils.h"
 
@@ -39,6 +43,16 @@ boost::uuids::detail::sha1::digest_type Base::getHashDigest() const
     Utils::updateHash(getPostNeuronVarRefs(), hash);
     Utils::updateHash(getPSMVarRefs(), hash);
 
+    // **NOTE** lazy decay variables are only hashed if present so hashes of other models are unchanged
+    const auto lazyDecayVars = getLazyDecayVars();
+    if(!lazyDecayVars.empty()) {
+        Utils::updateHash(lazyDecayVars.size(), hash);
+        for(const auto &l : lazyDecayVars) {
+            Utils::updateHash(l.first, hash);
+            Utils::updateHash(l.second, hash);
+        }
+    }
+
     // Return digest
     return hash.get_digest();
 }
@@ -142,6 +156,28 @@ void Base::validate(const std::map<std::string, Type::NumericValue> &paramValues
     if(getPostEventSynCode().empty() != getPostEventThresholdConditionCode().empty()) {
         throw std::runtime_error("Weight update model: to handle postsynaptic spike-like events, both postsynaptic event threshold condition code and postsynaptic event code must be specified.");
     }
+
+    // Check lazily-decayed variables are writable per-synapse variables which decay with a parameter or derived parameter time constant
+    const auto params = getParams();
+    const auto derivedParams = getDerivedParams();
+    std::set<std::string> lazyDecayVarNames;
+    for(const auto &l : getLazyDecayVars()) {
+        const auto var = getVar(l.first);
+        if(!var) {
+            throw std::runtime_error("Weight update model: lazily-decayed variable '" + l.first + "' is not a weight update model variable.");
+        }
+        if(!(getVarAccessMode(var->access) & VarAccessModeAttribute::READ_WRITE)) {
+            throw std::runtime_error("Weight update model: lazily-decayed variable '" + l.first + "' must be read-write.");
+        }
+        if(!lazyDecayVarNames.insert(l.first).second) {
+            throw std::runtime_error("Weight update model: variable '" + l.first + "' is lazily-decayed more than once.");
+        }
+        if(std::none_of(params.cbegin(), params.cend(), [&l](const auto &p){ return p.name == l.second; })
+           && std::none_of(derivedParams.cbegin(), derivedParams.cend(), [&l](const auto &d){ return d.name == l.second; }))
+        {
+            throw std::runtime_error("Weight update model: time constant '" + l.second + "' of lazily-decayed variable '" + l.first + "' is not a parameter or derived parameter.");
+        }
+    }
 }
 
 
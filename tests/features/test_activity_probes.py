@@ -0,0 +1,54 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import create_neuron_model
+
+# Neuron model where neuron i spikes every i + 1 timesteps
+periodic_neuron_model = create_neuron_model(
+    "periodic",
+    threshold_condition_code=
+    """
+    ((unsigned int)round(t) % (id + 1)) == 0
+    """)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_activity_probes(make_model, precision):
+    model = make_model(precision, "test_activity_probes", backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    pop = model.add_neuron_population("Pop", 10, periodic_neuron_model)
+    pop.spike_count_recording_enabled = True
+    pop.spike_rate_tau = 20.0
+    pop.set_isi_histogram(5, 1.0)
+
+    # Build model and load
+    model.build()
+    model.load(num_recording_timesteps=100)
+
+    while model.timestep < 100:
+        model.step_time()
+
+    # Calculate expected spike raster
+    times = np.arange(100)
+    periods = np.arange(1, 11)
+    spikes = (times[:,None] % periods[None,:]) == 0
+
+    # Check per-timestep spike counts
+    model.pull_recording_buffers_from_device()
+    assert np.array_equal(pop.spike_count_recording_data[0], np.sum(spikes, axis=1))
+
+    # Check rate estimates against reference exponential filter
+    decay = np.exp(-model.dt / 20.0)
+    rates = np.zeros(10)
+    for s in spikes:
+        rates = (rates * decay) + (s * (1000.0 / 20.0))
+    pop.spike_rates.pull_from_device()
+    assert np.allclose(pop.spike_rates.view, rates, rtol=1e-4)
+
+    # Check ISI histogram - intervals of neuron i are i + 1 timesteps
+    # with those longer than 4 timesteps accumulating in final bin
+    hist = np.zeros(5, dtype=np.uint32)
+    np.add.at(hist, np.minimum(periods, 4), np.sum(spikes, axis=0) - 1)
+    pop.isi_histogram.pull_from_device()
+    assert np.array_equal(pop.isi_histogram.view, hist)
@@ -0,0 +1,48 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import create_neuron_model, VarAccess
+
+# Neuron model which evaluates every function with an approximate version
+maths_neuron_model = create_neuron_model(
+    "maths_neuron",
+    sim_code=
+    """
+    Exp = exp(X);
+    Expm1 = expm1(X);
+    Log = log(Exp);
+    Tanh = tanh(X);
+    Sigmoid = sigmoid(X);
+    """,
+    vars=[("X", "scalar", VarAccess.READ_ONLY), ("Exp", "scalar"), ("Expm1", "scalar"),
+          ("Log", "scalar"), ("Tanh", "scalar"), ("Sigmoid", "scalar")])
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+@pytest.mark.parametrize("per_population", [True, False])
+def test_approximate_maths(make_model, precision, per_population):
+    model = make_model(precision, "test_approximate_maths", backend="single_threaded_cpu")
+    model.dt = 1.0
+    if not per_population:
+        model.approximate_maths_enabled = True
+
+    x = np.linspace(-20.0, 20.0, 1000)
+    pop = model.add_neuron_population("Pop", len(x), maths_neuron_model, {},
+                                      {"X": x, "Exp": 0.0, "Expm1": 0.0, "Log": 0.0,
+                                       "Tanh": 0.0, "Sigmoid": 0.0})
+    if per_population:
+        pop.approximate_maths_enabled = True
+
+    model.build()
+    model.load()
+    model.step_time()
+
+    # Check results are within documented error bounds
+    rtol = 5E-7 if precision == types.Float else 5E-14
+    pop.vars["Exp"].pull_from_device()
+    x = pop.vars["X"].view.astype(np.float64)
+    exp_x = pop.vars["Exp"].view.astype(np.float64)
+    for name, expected in [("Exp", np.exp(x)), ("Expm1", np.expm1(x)), ("Log", np.log(exp_x)),
+                           ("Tanh", np.tanh(x)), ("Sigmoid", 1.0 / (1.0 + np.exp(-x)))]:
+        pop.vars[name].pull_from_device()
+        assert np.allclose(pop.vars[name].view, expected, rtol=rtol, atol=rtol)
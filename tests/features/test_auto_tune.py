@@ -0,0 +1,71 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (init_postsynaptic, init_sparse_connectivity,
+                    init_toeplitz_connectivity, init_weight_update, GeNNModel)
+from pygenn.single_threaded_cpu_backend import PresynapticUpdateStrategy
+
+def _simulate(precision, name, path, **preferences):
+    model = GeNNModel(precision, name, backend="single_threaded_cpu", **preferences)
+    model.dt = 1.0
+    model.seed = 1234
+
+    lif_params = {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                  "Vthresh": -51.0, "Ioffset": 0.0, "TauRefrac": 5.0}
+    lif_init = {"V": -60.0, "RefracTime": 0.0}
+    pre_pop = model.add_neuron_population("Pre", 32 * 32, "Poisson", {"rate": 50.0}, {"timeStepToSpike": 0.0})
+    bitmask_pop = model.add_neuron_population("BitmaskPost", 100, "LIF", lif_params, lif_init)
+    conv_pop = model.add_neuron_population("ConvPost", 32 * 32 * 4, "LIF", lif_params, lif_init)
+
+    # Add BITMASK and TOEPLITZ synapse groups which both have alternative presynaptic update strategies
+    model.add_synapse_population("Bitmask", "BITMASK", pre_pop, bitmask_pop,
+                                 init_weight_update("StaticPulseConstantWeight", {"g": 0.1}),
+                                 init_postsynaptic("DeltaCurr"),
+                                 init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+    model.add_synapse_population("Conv", "TOEPLITZ", pre_pop, conv_pop,
+                                 init_weight_update("StaticPulse", {}, {"g": 0.25}),
+                                 init_postsynaptic("DeltaCurr"),
+                                 init_toeplitz_connectivity("Conv2D", {"conv_kh": 3, "conv_kw": 3,
+                                                                       "conv_ih": 32, "conv_iw": 32, "conv_ic": 1,
+                                                                       "conv_oh": 32, "conv_ow": 32, "conv_oc": 4}))
+    model.build(str(path))
+    model.load()
+
+    while model.timestep < 100:
+        model.step_time()
+
+    bitmask_pop.vars["V"].pull_from_device()
+    conv_pop.vars["V"].pull_from_device()
+    return np.copy(bitmask_pop.vars["V"].view), np.copy(conv_pop.vars["V"].view)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_auto_tune(precision, tmp_path):
+    default_bitmask_v, default_conv_v = _simulate(precision, "test_auto_tune_default", tmp_path)
+    tuned_bitmask_v, tuned_conv_v = _simulate(precision, "test_auto_tune", tmp_path,
+                                              auto_tune=True, auto_tune_timesteps=20)
+
+    # Whichever strategies are selected, results should match
+    assert np.allclose(default_bitmask_v, tuned_bitmask_v)
+    assert np.allclose(default_conv_v, tuned_conv_v)
+
+    # Check tuned strategies were cached and calibration code removed
+    assert (tmp_path / "test_auto_tune_CODE" / "autoTune.sha").exists()
+    assert not (tmp_path / "test_auto_tune_CODE" / "autotune").exists()
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+@pytest.mark.parametrize("bitmask_strategy", [PresynapticUpdateStrategy.ROW_WISE,
+                                              PresynapticUpdateStrategy.WORD_PACKED_BITMASK])
+@pytest.mark.parametrize("conv_strategy", [PresynapticUpdateStrategy.TOEPLITZ_DIAGONAL_MAJOR,
+                                           PresynapticUpdateStrategy.TOEPLITZ_SPIKE_MAJOR,
+                                           PresynapticUpdateStrategy.TOEPLITZ_CONV2D])
+def test_forced_strategy(precision, bitmask_strategy, conv_strategy, tmp_path):
+    default_bitmask_v, default_conv_v = _simulate(precision, "test_forced_strategy_default", tmp_path)
+    forced_bitmask_v, forced_conv_v = _simulate(
+        precision, "test_forced_strategy", tmp_path,
+        manual_presynaptic_update_strategies={"Bitmask": bitmask_strategy,
+                                              "Conv": conv_strategy})
+
+    # Each strategy should match default
+    assert np.allclose(default_bitmask_v, forced_bitmask_v)
+    assert np.allclose(default_conv_v, forced_conv_v)
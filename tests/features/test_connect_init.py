@@ -3,12 +3,26 @@ import pytest
 from pygenn import types
 from scipy import stats
 
-from pygenn import (create_neuron_model, init_postsynaptic, 
+from pygenn import (create_custom_connectivity_update_model,
+                    create_neuron_model, init_postsynaptic, 
                     init_sparse_connectivity, init_weight_update)
 
 # Neuron model which does nothing
 empty_neuron_model = create_neuron_model("empty")
 
+# Custom connectivity update which removes synapses on diagonal
+remove_diagonal_model = create_custom_connectivity_update_model(
+    "remove_diagonal",
+    row_update_code=
+    """
+    for_each_synapse {
+        if(id_post == id_pre) {
+            remove_synapse();
+            break;
+        }
+    }
+    """)
+
 @pytest.mark.flaky
 @pytest.mark.parametrize("precision", [types.Double, types.Float])
 def test_connect_init(make_model, backend, precision):
@@ -69,3 +83,78 @@ def test_connect_init(make_model, backend, precision):
     confidence_interval = 0.0020
     assert stats.chisquare(np.bincount(fixed_number_post_s_pop.get_sparse_post_inds(), minlength=100)).pvalue > confidence_interval
     assert stats.chisquare(np.bincount(fixed_number_pre_s_pop.get_sparse_pre_inds(), minlength=100)).pvalue > confidence_interval
+
+@pytest.mark.parametrize("narrow_sparse_ind", [True, False])
+def test_set_sparse_connections(make_model, backend, narrow_sparse_ind):
+    model = make_model(types.Float, "test_set_sparse_connections", backend=backend)
+    model.narrow_sparse_ind_enabled = narrow_sparse_ind
+
+    # Create pre and postsynaptic neuron populations
+    pre_pop = model.add_neuron_population("Pre", 100, empty_neuron_model)
+    post_pop = model.add_neuron_population("Post", 200, empty_neuron_model)
+
+    # Generate shuffled edge list with some duplicate synapses
+    rng = np.random.default_rng(1234)
+    pre_inds = rng.integers(100, size=5000, dtype=np.uint32)
+    post_inds = rng.integers(200, size=5000, dtype=np.uint32)
+    weights = np.arange(5000, dtype=np.float32)
+
+    s_pop = model.add_synapse_population(
+        "Synapses", "SPARSE", pre_pop, post_pop,
+        init_weight_update("StaticPulse", {}, {"g": weights}),
+        init_postsynaptic("DeltaCurr"))
+    s_pop.set_sparse_connections(pre_inds, post_inds)
+
+    # Build model and load
+    model.build()
+    model.load()
+
+    # Check connectivity and weights match lexically-sorted edge list
+    order = np.lexsort((post_inds, pre_inds))
+    s_pop.pull_connectivity_from_device()
+    s_pop.vars["g"].pull_from_device()
+    assert np.array_equal(s_pop.get_sparse_pre_inds(), pre_inds[order])
+    assert np.array_equal(s_pop.get_sparse_post_inds(), post_inds[order])
+    assert np.array_equal(s_pop.vars["g"].values, weights[order])
+
+def test_set_sparse_connections_reload(make_model, backend):
+    model = make_model(types.Float, "test_set_sparse_connections_reload", backend=backend)
+
+    # Create pre and postsynaptic neuron populations
+    pre_pop = model.add_neuron_population("Pre", 100, empty_neuron_model)
+    post_pop = model.add_neuron_population("Post", 100, empty_neuron_model)
+
+    # Generate shuffled edge list including diagonal synapses
+    rng = np.random.default_rng(1234)
+    pre_inds = np.concatenate((rng.integers(100, size=2000, dtype=np.uint32),
+                               np.arange(100, dtype=np.uint32)))
+    post_inds = np.concatenate((rng.integers(100, size=2000, dtype=np.uint32),
+                                np.arange(100, dtype=np.uint32)))
+    weights = np.arange(2100, dtype=np.float32)
+
+    s_pop = model.add_synapse_population(
+        "Synapses", "SPARSE", pre_pop, post_pop,
+        init_weight_update("StaticPulse", {}, {"g": weights}),
+        init_postsynaptic("DeltaCurr"))
+    s_pop.set_sparse_connections(pre_inds, post_inds)
+    model.add_custom_connectivity_update(
+        "RemoveDiagonal", "RemoveSynapse", s_pop, remove_diagonal_model)
+
+    # Build model, load and remove diagonal synapses
+    model.build()
+    model.load()
+    model.custom_update("RemoveSynapse")
+    s_pop.pull_connectivity_from_device()
+    assert len(s_pop.get_sparse_pre_inds()) < len(pre_inds)
+
+    # Reload model
+    model.unload()
+    model.load()
+
+    # Check original connectivity and weights are restored
+    order = np.lexsort((post_inds, pre_inds))
+    s_pop.pull_connectivity_from_device()
+    s_pop.vars["g"].pull_from_device()
+    assert np.array_equal(s_pop.get_sparse_pre_inds(), pre_inds[order])
+    assert np.array_equal(s_pop.get_sparse_post_inds(), post_inds[order])
+    assert np.array_equal(s_pop.vars["g"].values, weights[order])
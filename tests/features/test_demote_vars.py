@@ -0,0 +1,99 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import VarAccess
+from pygenn import (create_current_source_model,
+                    create_neuron_model,
+                    create_postsynaptic_model,
+                    init_postsynaptic,
+                    init_weight_update)
+
+pre_neuron_model = create_neuron_model(
+    "pre_neuron",
+    threshold_condition_code="true")
+
+post_neuron_model = create_neuron_model(
+    "post_neuron",
+    sim_code=
+    """
+    x += a + Isyn;
+    """,
+    vars=[("x", "scalar"), ("a", "scalar", VarAccess.READ_ONLY)])
+
+current_source_model = create_current_source_model(
+    "current_source",
+    injection_code=
+    """
+    injectCurrent(amp);
+    """,
+    vars=[("amp", "scalar", VarAccess.READ_ONLY)])
+
+postsynaptic_model = create_postsynaptic_model(
+    "postsynaptic",
+    sim_code=
+    """
+    injectCurrent(scale * inSyn);
+    inSyn = 0;
+    """,
+    vars=[("scale", "scalar", VarAccess.READ_ONLY)])
+
+def _simulate(make_model, backend, precision, name, demote):
+    model = make_model(precision, name, backend=backend)
+    model.dt = 1.0
+    model.demote_constant_read_only_vars = demote
+
+    # Add identical populations, which will be merged, with different constant variable values
+    pre_pop = model.add_neuron_population("Pre", 10, pre_neuron_model)
+    post_pops = []
+    cs_pops = []
+    s_pops = []
+    for i in range(3):
+        post_pop = model.add_neuron_population(f"Post{i}", 10, post_neuron_model,
+                                               {}, {"x": 0.0, "a": 1.0 + i})
+        cs_pops.append(model.add_current_source(f"CurrentSource{i}", current_source_model,
+                                                post_pop, {}, {"amp": 0.5 / (i + 1)}))
+        s_pops.append(model.add_synapse_population(
+            f"Synapse{i}", "DENSE", pre_pop, post_pop,
+            init_weight_update("StaticPulseConstantWeight", {"g": 1.0}),
+            init_postsynaptic(postsynaptic_model, {}, {"scale": 3.0 + i})))
+        post_pops.append(post_pop)
+
+    model.build()
+    model.load()
+
+    while model.timestep < 20:
+        model.step_time()
+
+    # Check variables are only demoted when requested
+    for p, c, s in zip(post_pops, cs_pops, s_pops):
+        assert p.is_var_demoted("a") == demote
+        assert c.is_var_demoted("amp") == demote
+        assert s.is_ps_var_demoted("scale") == demote
+
+    output = []
+    for p in post_pops:
+        p.vars["x"].pull_from_device()
+        output.append(np.copy(p.vars["x"].view))
+    return output, post_pops, cs_pops, s_pops
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_demote_vars(make_model, backend, precision):
+    array_output, _, _, _ = _simulate(make_model, backend, precision,
+                                      "test_demote_vars_array", False)
+    demote_output, post_pops, cs_pops, s_pops = _simulate(make_model, backend, precision,
+                                                          "test_demote_vars", True)
+
+    # Check simulations are identical
+    for a, d in zip(array_output, demote_output):
+        assert np.allclose(a, d)
+
+    # Check demoted variables can't be accessed
+    with pytest.raises(Exception):
+        post_pops[0].vars["a"].values
+    with pytest.raises(Exception):
+        post_pops[1].vars["a"].pull_from_device()
+    with pytest.raises(Exception):
+        cs_pops[0].vars["amp"].view
+    with pytest.raises(Exception):
+        s_pops[0].psm_vars["scale"].values = 1.0
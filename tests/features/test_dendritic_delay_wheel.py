@@ -0,0 +1,77 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (create_neuron_model,
+                    init_postsynaptic,
+                    init_weight_update,
+                    GeNNModel)
+
+post_neuron_model = create_neuron_model(
+    "post_neuron",
+    sim_code=
+    """
+    x = Isyn;
+    """,
+    vars=[("x", "scalar")])
+
+def _simulate(precision, name, path, max_dendritic_delay_events):
+    # **NOTE** dendritic delay timing wheels are only supported on single-threaded CPU backend
+    model = GeNNModel(precision, name, backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    # Create spike source array where neuron i spikes at time i
+    ss_pop = model.add_neuron_population("SpikeSource", 10, "SpikeSourceArray",
+                                         {}, {"startSpike": np.arange(10), "endSpike": np.arange(1, 11)})
+    ss_pop.extra_global_params["spikeTimes"].set_init_values(np.arange(10.0))
+
+    # Connect each spike source to first and last of a large population of
+    # neurons with delays chosen so all spikes arrive in the same timestep
+    n_pop = model.add_neuron_population("Post", 1000, post_neuron_model, {}, {"x": 0.0})
+    delay = np.tile(np.arange(9, -1, -1), 2)
+    s_pop = model.add_synapse_population(
+        "Synapse", "SPARSE", ss_pop, n_pop,
+        init_weight_update("StaticPulseDendriticDelay", {}, {"g": 1.0, "d": delay}),
+        init_postsynaptic("DeltaCurr"))
+    s_pop.set_sparse_connections(np.tile(np.arange(10), 2),
+                                 np.repeat([0, 999], 10))
+    s_pop.max_dendritic_delay_timesteps = 10
+    s_pop.max_dendritic_delay_events = max_dendritic_delay_events
+
+    model.build(str(path))
+    model.load()
+
+    x = []
+    while model.timestep < 12:
+        model.step_time()
+        n_pop.vars["x"].pull_from_device()
+        x.append(np.copy(n_pop.vars["x"].view))
+    return s_pop.dendritic_delay_wheel_enabled, np.array(x), s_pop.dendritic_delay_wheel_overflow
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_dendritic_delay_wheel(precision, tmp_path):
+    ring_enabled, ring_x, _ = _simulate(precision, "test_dendritic_delay_ring", tmp_path, 0)
+    wheel_enabled, wheel_x, wheel_overflow = _simulate(precision, "test_dendritic_delay_wheel", tmp_path, 20)
+    assert not ring_enabled
+    assert wheel_enabled
+    assert wheel_overflow == 0
+
+    # All spikes should arrive at first and last neuron in timestep 10
+    correct = np.zeros((12, 1000))
+    correct[10, [0, 999]] = 10.0
+    assert np.allclose(ring_x, correct)
+    assert np.allclose(wheel_x, correct)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_dendritic_delay_wheel_overflow(precision, tmp_path):
+    # Simulate with buckets which can only hold 15 of the 18 delayed events arriving in timestep 10
+    wheel_enabled, wheel_x, wheel_overflow = _simulate(precision, "test_dendritic_delay_wheel_overflow", tmp_path, 15)
+    assert wheel_enabled
+
+    # Spike source 9's events have no delay so bypass the wheel. Of the 18 events pushed into
+    # the bucket in row order, the last 3 (spike source 7 to neuron 999 and spike source 8) are dropped
+    assert wheel_overflow == 3
+    correct = np.zeros((12, 1000))
+    correct[10, 0] = 9.0
+    correct[10, 999] = 8.0
+    assert np.allclose(wheel_x, correct)
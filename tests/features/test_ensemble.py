@@ -0,0 +1,44 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (init_postsynaptic, init_sparse_connectivity,
+                    init_weight_update, GeNNModel)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_ensemble(precision, tmp_path):
+    model = GeNNModel(precision, "test_ensemble", backend="single_threaded_cpu",
+                      instance_context=True)
+    model.dt = 1.0
+
+    # Poisson input connected to LIF population with random sparse connectivity
+    pre_pop = model.add_neuron_population("Pre", 100, "Poisson", {"rate": 50.0}, {"timeStepToSpike": 0.0})
+    post_pop = model.add_neuron_population("Post", 10, "LIF",
+                                           {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                            "Vthresh": -51.0, "Ioffset": 0.0, "TauRefrac": 5.0},
+                                           {"V": -70.0, "RefracTime": 0.0})
+    post_pop.set_param_dynamic("Ioffset")
+    model.add_synapse_population("Syn", "SPARSE", pre_pop, post_pop,
+                                 init_weight_update("StaticPulse", {}, {"g": 0.5}),
+                                 init_postsynaptic("ExpCurr", {"tau": 5.0}),
+                                 init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+
+    # Build model and load ensemble where first and third replicas share seed
+    model.build(str(tmp_path))
+    model.load(num_replicas=4, seeds=[1, 2, 1, 3])
+    model.set_ensemble_dynamic_param_values(post_pop, "Ioffset", [0.0, 0.0, 0.0, 0.5])
+
+    while model.timestep < 100:
+        model.step_time()
+
+    v = model.get_ensemble_var_values(post_pop, "V")
+    assert v.shape == (4, 10)
+
+    # Replicas with same seed and parameters should be identical and others should differ
+    assert np.array_equal(v[0], v[2])
+    assert not np.array_equal(v[0], v[1])
+    assert not np.array_equal(v[0], v[3])
+
+    # Populations should access first replica
+    post_pop.vars["V"].pull_from_device()
+    assert np.array_equal(post_pop.vars["V"].view, v[0])
@@ -5,7 +5,7 @@ from pygenn import types
 from pygenn import ParallelismHint, VarAccess
 from pygenn import (create_neuron_model,
                     create_sparse_connect_init_snippet,
-                    create_var_init_snippet,
+                    create_var_init_snippet, create_var_ref,
                     create_weight_update_model,
                     init_postsynaptic,
                     init_sparse_connectivity, 
@@ -792,3 +792,98 @@ def test_reverse_post(make_model, backend, precision):
             output_value = np.sum(output_place_values[output_binary])
             if output_value != (model.timestep - 1):
                 assert False, f"{pop.name} decoding incorrect ({output_value} rather than {model.timestep - 1})"
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_reverse_post_row_stride(make_model, backend, precision):
+    pre_neuron_model = create_neuron_model("pre_neuron")
+
+    post_spike_neuron_model = create_neuron_model(
+        "post_spike_neuron",
+        threshold_condition_code="true")
+
+    pre_ind_post_model = create_weight_update_model(
+        "pre_ind_post",
+        post_spike_syn_code=
+        """
+        x = id_pre;
+        """,
+        vars=[("x", "unsigned int")])
+
+    model = make_model(precision, "test_reverse_post_row_stride", backend=backend)
+    model.dt = 1.0
+
+    pre_n_pop = model.add_neuron_population("Pre", 16, pre_neuron_model)
+    post_n_pop = model.add_neuron_population("Post", 8, post_spike_neuron_model)
+
+    # Add identical synapse populations, which will be merged, whose
+    # connectivity results in different row strides so presynaptic
+    # indices need to be calculated from row-major indices per-group
+    s_pops = []
+    for i, max_row_length in enumerate([3, 8]):
+        pre_inds = []
+        post_inds = []
+        for p in range(16):
+            row_length = 1 + (p % max_row_length)
+            pre_inds.extend([p] * row_length)
+            post_inds.extend(range(row_length))
+
+        s_pop = model.add_synapse_population(
+            f"Synapse{i}", "SPARSE", pre_n_pop, post_n_pop,
+            init_weight_update(pre_ind_post_model, {}, {"x": 0}),
+            init_postsynaptic("DeltaCurr"))
+        s_pop.set_sparse_connections(pre_inds, post_inds)
+        s_pops.append(s_pop)
+
+    # Build model and load
+    model.build()
+    model.load()
+
+    # Simulate 2 timesteps so postsynaptic spikes are processed
+    while model.timestep < 2:
+        model.step_time()
+
+    # Check that every synapse has received correct presynaptic index
+    for s_pop in s_pops:
+        s_pop.vars["x"].pull_from_device()
+        assert np.array_equal(s_pop.vars["x"].values, s_pop.get_sparse_pre_inds())
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_forward_graded(make_model, backend, precision):
+    graded_pre_neuron_model = create_neuron_model(
+        "graded_pre_neuron",
+        vars=[("V", "scalar", VarAccess.READ_ONLY)])
+
+    model = make_model(precision, "test_forward_graded", backend=backend)
+    model.dt = 1.0
+
+    # Create presynaptic population with membrane voltages either side of graded release threshold
+    pre_v = np.linspace(-80.0, -40.0, 16)
+    pre_n_pop = model.add_neuron_population("Pre", 16, graded_pre_neuron_model,
+                                            {}, {"V": pre_v})
+    post_n_pop = model.add_neuron_population("Post", 4, post_neuron_model,
+                                             {}, {"x": 0.0})
+
+    # Connect with dense graded synapses
+    weights = np.linspace(0.0, 1.0, 16 * 4).reshape((16, 4))
+    model.add_synapse_population(
+        "DenseSynapse", "DENSE",
+        pre_n_pop, post_n_pop,
+        init_weight_update("StaticGraded", {"Epre": -60.0, "Vslope": 10.0},
+                           {"g": weights.flatten()},
+                           pre_var_refs={"V": create_var_ref(pre_n_pop, "V")}),
+        init_postsynaptic("DeltaCurr"))
+
+    # Build model and load
+    model.build()
+    model.load()
+
+    # Events emitted in first timestep are propagated in second
+    model.step_time()
+    model.step_time()
+
+    # Check graded input matches
+    release = np.where(pre_v > -60.0,
+                       np.tanh((pre_v - -60.0) / 10.0), 0.0)
+    expected = np.sum(np.maximum(0.0, weights * release[:,np.newaxis]), axis=0)
+    post_n_pop.vars["x"].pull_from_device()
+    assert np.allclose(post_n_pop.vars["x"].view, expected)
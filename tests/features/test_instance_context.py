@@ -0,0 +1,80 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (init_postsynaptic, init_sparse_connectivity,
+                    init_weight_update, GeNNModel)
+
+def _create_model(precision, name, path, instance_context):
+    model = GeNNModel(precision, name, backend="single_threaded_cpu",
+                      instance_context=instance_context)
+    model.dt = 1.0
+    model.seed = 1234
+    model.timing_enabled = True
+
+    # Poisson input connected to LIF population with random sparse connectivity
+    # **NOTE** this uses the host RNG for both simulation and initialisation
+    pre_pop = model.add_neuron_population("Pre", 100, "Poisson", {"rate": 50.0}, {"timeStepToSpike": 0.0})
+    post_pop = model.add_neuron_population("Post", 10, "LIF",
+                                           {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                            "Vthresh": -51.0, "Ioffset": 0.0, "TauRefrac": 5.0},
+                                           {"V": -70.0, "RefracTime": 0.0})
+    model.add_synapse_population("Syn", "SPARSE", pre_pop, post_pop,
+                                 init_weight_update("StaticPulse", {}, {"g": 0.5}),
+                                 init_postsynaptic("ExpCurr", {"tau": 5.0}),
+                                 init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+
+    model.build(path)
+    return model, post_pop
+
+def _run_model(precision, name, path, instance_context):
+    # Build model and load
+    model, post_pop = _create_model(precision, name, path, instance_context)
+    model.load()
+
+    while model.timestep < 100:
+        model.step_time()
+
+    post_pop.vars["V"].pull_from_device()
+    assert model.neuron_update_time >= 0.0
+    return np.copy(post_pop.vars["V"].view)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_instance_context(precision, tmp_path):
+    # Simulate model with globals and with instance context
+    v_global = _run_model(precision, "test_instance_context_global", str(tmp_path), False)
+    v_context = _run_model(precision, "test_instance_context", str(tmp_path), True)
+
+    # Check simulations are identical
+    assert np.array_equal(v_global, v_context)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_instance_context_concurrent(precision, tmp_path):
+    # Simulate reference model with globals
+    v_global = _run_model(precision, "test_instance_context_concurrent_global",
+                          str(tmp_path), False)
+
+    # Build two instances of the same model with instance context
+    # **NOTE** both are built before either is loaded so
+    # the shared library isn't rebuilt while it's in use
+    instances = [_create_model(precision, "test_instance_context_concurrent",
+                               str(tmp_path), True)
+                 for i in range(2)]
+
+    # Load both instances together so they share the shared library
+    for model, _ in instances:
+        model.load()
+
+    # Step both instances concurrently on their background threads
+    futures = [model.step_time_async(100, [(post_pop, "V")])
+               for model, post_pop in instances]
+
+    # Check each instance matches the single-instance reference
+    for f in futures:
+        snapshot = f.result()
+        assert np.array_equal(snapshot[("Post", "V")], v_global)
+
+    for model, _ in instances:
+        assert model.timestep == 100
+        assert model.neuron_update_time >= 0.0
+        model.unload()
@@ -0,0 +1,57 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import VarAccess
+from pygenn import (create_weight_update_model,
+                    init_postsynaptic,
+                    init_sparse_connectivity,
+                    init_weight_update)
+
+# Weight update model with eligibility trace decayed lazily when synapses are updated
+lazy_eligibility_model = create_weight_update_model(
+    "lazy_eligibility",
+    params=["tauE", "A"],
+    vars=[("g", "scalar", VarAccess.READ_ONLY), ("e", "scalar")],
+    pre_spike_syn_code=
+    """
+    addToPost(g);
+    e += A;
+    """,
+    lazy_decay_vars=[("e", "tauE")])
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+@pytest.mark.parametrize("matrix_type", ["DENSE", "SPARSE"])
+def test_lazy_decay(make_model, backend, precision, matrix_type):
+    model = make_model(precision, "test_lazy_decay", backend=backend)
+    model.dt = 1.0
+
+    # Create spike source array where neuron i spikes at i * 10, (i * 10) + 20 and (i * 10) + 50
+    ss_pop = model.add_neuron_population("SpikeSource", 4, "SpikeSourceArray",
+                                         {}, {"startSpike": np.arange(0, 12, 3), "endSpike": np.arange(3, 15, 3)})
+    spike_times = (np.arange(4) * 10.0)[:,None] + [0.0, 20.0, 50.0]
+    ss_pop.extra_global_params["spikeTimes"].set_init_values(spike_times.flatten())
+
+    post_pop = model.add_neuron_population("Post", 4, "SpikeSource", {}, {})
+
+    # One-to-one connectivity if sparse, all-to-all otherwise
+    connect = (init_sparse_connectivity("OneToOne") if matrix_type == "SPARSE"
+               else None)
+    tau_e = 20.0
+    s_pop = model.add_synapse_population(
+        "Synapse", matrix_type, ss_pop, post_pop,
+        init_weight_update(lazy_eligibility_model, {"tauE": tau_e, "A": 1.0}, {"g": 0.0, "e": 0.0}),
+        init_postsynaptic("DeltaCurr"),
+        connect)
+
+    model.build()
+    model.load()
+
+    while model.timestep < 100:
+        model.step_time()
+
+    # All neurons spike at the same relative times so, as of their last update, 
+    # the eligibility traces of all synapses should have the same closed-form value
+    s_pop.vars["e"].pull_from_device()
+    expected = 1.0 + np.exp(-30.0 / tau_e) + np.exp(-50.0 / tau_e)
+    assert np.allclose(s_pop.vars["e"].values, expected)
@@ -0,0 +1,53 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import create_neuron_model
+
+# Leaky integrator driven by exponentially-decaying current, integrated exactly
+linear_neuron_model = create_neuron_model(
+    "linear_neuron",
+    params=["tauM", "tauS", "Ioffset"],
+    vars=[("V", "scalar"), ("I", "scalar")],
+    linear_dynamics=(["V", "I"],
+                     lambda pars, dt: [[-1.0 / pars["tauM"], 1.0 / pars["tauM"]],
+                                       [0.0, -1.0 / pars["tauS"]]],
+                     ["Ioffset / tauM", ""]))
+
+# Nonlinear decay, integrated using Runge-Kutta
+nonlinear_neuron_model = create_neuron_model(
+    "nonlinear_neuron",
+    vars=[("x", "scalar")],
+    nonlinear_dynamics=[("x", "-x * x")],
+    nonlinear_dynamics_substeps=2)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_neuron_dynamics(make_model, backend, precision):
+    model = make_model(precision, "test_neuron_dynamics", backend=backend)
+    model.dt = 1.0
+
+    linear_pop = model.add_neuron_population(
+        "Linear", 1, linear_neuron_model,
+        {"tauM": 10.0, "tauS": 5.0, "Ioffset": 2.0}, {"V": 0.0, "I": 1.0})
+    nonlinear_pop = model.add_neuron_population(
+        "Nonlinear", 1, nonlinear_neuron_model, {}, {"x": 1.0})
+
+    model.build()
+    model.load()
+
+    while model.timestep < 20:
+        model.step_time()
+
+    # Compare against analytical solutions
+    t = 20.0
+    correct_i = np.exp(-t / 5.0)
+    correct_v = (2.0 * (1.0 - np.exp(-t / 10.0))
+                 + (5.0 / (5.0 - 10.0)) * (np.exp(-t / 5.0) - np.exp(-t / 10.0)))
+    correct_x = 1.0 / (1.0 + t)
+
+    linear_pop.vars["V"].pull_from_device()
+    linear_pop.vars["I"].pull_from_device()
+    nonlinear_pop.vars["x"].pull_from_device()
+    assert np.isclose(linear_pop.vars["V"].values[0], correct_v, rtol=1E-5)
+    assert np.isclose(linear_pop.vars["I"].values[0], correct_i, rtol=1E-5)
+    assert np.isclose(nonlinear_pop.vars["x"].values[0], correct_x, rtol=1E-4)
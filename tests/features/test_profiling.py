@@ -0,0 +1,67 @@
+import json
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import init_postsynaptic, init_sparse_connectivity, init_weight_update
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_profiling(make_model, precision, tmp_path):
+    model = make_model(precision, "test_profiling", backend="single_threaded_cpu")
+    model.dt = 1.0
+    model.profiling_enabled = True
+
+    # Create spike source array where each neuron spikes once
+    ss_pop = model.add_neuron_population("SpikeSource", 10, "SpikeSourceArray",
+                                         {}, {"startSpike": np.arange(10), "endSpike": np.arange(1, 11)})
+    ss_pop.extra_global_params["spikeTimes"].set_init_values(np.arange(10.0))
+
+    # Create two identical postsynaptic populations so they are merged
+    post_pops = [model.add_neuron_population(f"Post{i}", 4, "LIF",
+                                             {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                              "Vthresh": -51.0, "Ioffset": 0.0, "TauRefrac": 5.0},
+                                             {"V": -70.0, "RefracTime": 0.0})
+                 for i in range(2)]
+
+    # Connect spike source to first with dense and second with one-to-one-like sparse connectivity
+    model.add_synapse_population("Dense", "DENSE", ss_pop, post_pops[0],
+                                 init_weight_update("StaticPulse", {}, {"g": 0.0}),
+                                 init_postsynaptic("DeltaCurr"))
+    model.add_synapse_population("Sparse", "SPARSE", ss_pop, post_pops[1],
+                                 init_weight_update("StaticPulse", {}, {"g": 0.0}),
+                                 init_postsynaptic("DeltaCurr"),
+                                 init_sparse_connectivity("FixedNumberPostWithReplacement", {"num": 2}))
+
+    # Build model and load
+    model.build()
+    model.load()
+
+    while model.timestep < 20:
+        model.step_time()
+
+    profile = {(p["kernel"], p["population"]): p for p in model.get_profile()}
+
+    # Check neuron update counters
+    ss_profile = profile[("NeuronUpdate", "SpikeSource")]
+    assert ss_profile["calls"] == 20
+    assert ss_profile["neurons"] == 200
+    assert ss_profile["spikes"] == 10
+    for p in post_pops:
+        assert profile[("NeuronUpdate", p.name)]["neurons"] == 80
+
+    # Check presynaptic update counters
+    assert profile[("PresynapticUpdate", "Dense")]["spikes"] == 10
+    assert profile[("PresynapticUpdate", "Dense")]["synapses"] == 40
+    assert profile[("PresynapticUpdate", "Sparse")]["spikes"] == 10
+    assert profile[("PresynapticUpdate", "Sparse")]["synapses"] == 20
+
+    # Check trace can be written and contains an event for each entry
+    trace_path = str(tmp_path / "trace.json")
+    model.write_profile_trace(trace_path)
+    with open(trace_path, "r") as trace_file:
+        trace = json.load(trace_file)
+    assert sum(e["ph"] == "X" for e in trace["traceEvents"]) == len(profile)
+
+    # Check reset zeros counters
+    model.reset_profile()
+    assert all(p["calls"] == 0 for p in model.get_profile())
@@ -234,3 +234,43 @@ def test_init(make_model, backend, precision):
             # Check p-value exceed our confidence internal
             if p < confidence_interval:
                 assert False, f"'{pop.name}' '{var_name}' initialisation fails KS test (p={p})"
+
+@pytest.mark.flaky
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_aggregated_poisson(make_model, backend, precision):
+    neuron_model = create_neuron_model(
+        "neuron",
+        sim_code=
+        """
+        x = Isyn;
+        """,
+        vars=[("x", "scalar")])
+
+    model = make_model(precision, "test_aggregated_poisson", backend=backend)
+    model.dt = 1.0
+
+    n_pop = model.add_neuron_population("Neurons", 1000, neuron_model, 
+                                        {}, {"x": 0.0})
+
+    # Add current source with three classes of Poisson input, 
+    # weighted so number of spikes in each class can be recovered
+    # **NOTE** the last class's mean is large enough to use the rejection sampler
+    tau_syn = 5.0
+    init = (1.0 - np.exp(-1.0 / tau_syn)) * tau_syn
+    cs_pop = model.add_current_source("CurrentSource", "AggregatedPoissonExp", n_pop,
+                                      {"tauSyn": tau_syn, "numClasses": 3}, {"current": 0.0})
+    cs_pop.extra_global_params["weight"].set_init_values(np.asarray([1.0, 100.0, 10000.0]) / init)
+    cs_pop.extra_global_params["rate"].set_init_values([2000.0, 5000.0, 20000.0])
+
+    model.build()
+    model.load()
+    model.step_time()
+
+    # Recover number of spikes in each class from input received in first timestep
+    n_pop.vars["x"].pull_from_device()
+    x = np.round(n_pop.vars["x"].values).astype(int)
+    for spikes, lam, mean_tol, var_tol in ((x % 100, 2.0, 0.2, 1.0), 
+                                           ((x // 100) % 100, 5.0, 0.2, 1.0),
+                                           (x // 10000, 20.0, 0.5, 3.5)):
+        assert abs(np.mean(spikes) - lam) < mean_tol
+        assert abs(np.var(spikes) - lam) < var_tol
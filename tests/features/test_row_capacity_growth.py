@@ -0,0 +1,186 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (create_custom_connectivity_update_model,
+                    create_neuron_model,
+                    create_weight_update_model,
+                    create_wu_var_ref,
+                    init_postsynaptic,
+                    init_sparse_connectivity,
+                    init_weight_update,
+                    GeNNModel)
+
+pre_neuron_model = create_neuron_model(
+    "pre_neuron",
+    threshold_condition_code="true")
+
+post_neuron_model = create_neuron_model(
+    "post_neuron",
+    sim_code=
+    """
+    x += Isyn;
+    """,
+    threshold_condition_code=
+    """
+    ((int)t % 5) == (id % 5)
+    """,
+    vars=[("x", "scalar")])
+
+# Weight update model with postsynaptic learning so remap is required
+learn_post_weight_update_model = create_weight_update_model(
+    "learn_post_weight_update",
+    vars=[("g", "scalar")],
+    pre_spike_syn_code=
+    """
+    addToPost(g);
+    """,
+    post_spike_syn_code=
+    """
+    g += 0.25;
+    """)
+
+# Custom connectivity update which removes strong synapses
+# and adds one new synapse to each row each time it's run
+rewire_model = create_custom_connectivity_update_model(
+    "rewire",
+    pre_vars=[("n", "unsigned int")],
+    var_refs=[("g", "scalar")],
+    row_update_code=
+    """
+    for_each_synapse {
+        if(g > 3.0) {
+            remove_synapse();
+        }
+    }
+    if(n < 12) {
+        add_synapse((id_pre + 1 + n) % num_post, 0.1 * n);
+        n++;
+    }
+    """)
+
+def _simulate(precision, name, path, row_capacity_slack):
+    # **NOTE** growable row capacity is only supported on single-threaded CPU backend
+    model = GeNNModel(precision, name, backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    pre_pop = model.add_neuron_population("Pre", 20, pre_neuron_model)
+    post_pop = model.add_neuron_population("Post", 20, post_neuron_model,
+                                           {}, {"x": 0.0})
+
+    s_pop = model.add_synapse_population(
+        "Synapse", "SPARSE", pre_pop, post_pop,
+        init_weight_update(learn_post_weight_update_model, {}, {"g": 1.0}),
+        init_postsynaptic("DeltaCurr"),
+        init_sparse_connectivity("OneToOne"))
+    s_pop.max_source_connections = 20
+
+    # Either make row capacity growable or allocate worst-case capacity
+    if row_capacity_slack > 0:
+        s_pop.row_capacity_slack = row_capacity_slack
+    else:
+        s_pop.max_connections = 20
+
+    model.add_custom_connectivity_update(
+        "Rewire", "Rewire", s_pop, rewire_model,
+        {}, {}, {"n": 0}, {},
+        {"g": create_wu_var_ref(s_pop, "g")})
+
+    model.build(str(path))
+    model.load()
+
+    # **NOTE** synapses strengthen by 0.05 per timestep so, once the last
+    # synapses are added, they are all removed within about 40 timesteps
+    row_strides = []
+    num_synapses = []
+    while model.timestep < 120:
+        model.step_time()
+        if (model.timestep % 3) == 0:
+            model.custom_update("Rewire")
+            row_strides.append(s_pop._row_stride)
+
+            s_pop.pull_connectivity_from_device()
+            num_synapses.append(len(s_pop.get_sparse_pre_inds()))
+
+    # Pull connectivity and weights and sort into canonical order
+    s_pop.pull_connectivity_from_device()
+    s_pop.vars["g"].pull_from_device()
+    pre_inds = s_pop.get_sparse_pre_inds()
+    post_inds = s_pop.get_sparse_post_inds()
+    g = s_pop.vars["g"].values
+    order = np.lexsort((g, post_inds, pre_inds))
+
+    post_pop.vars["x"].pull_from_device()
+    return (np.array(row_strides), np.array(num_synapses),
+            pre_inds[order], post_inds[order], g[order],
+            np.copy(post_pop.vars["x"].view))
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_row_capacity_growth(precision, tmp_path):
+    (fixed_strides, fixed_num_synapses, fixed_pre,
+     fixed_post, fixed_g, fixed_x) = _simulate(precision, "test_row_capacity_fixed",
+                                               tmp_path, 0)
+    (grow_strides, grow_num_synapses, grow_pre,
+     grow_post, grow_g, grow_x) = _simulate(precision, "test_row_capacity_growth",
+                                            tmp_path, 2)
+
+    # Check synapses were both added and removed
+    assert np.array_equal(fixed_num_synapses, grow_num_synapses)
+    assert np.amax(grow_num_synapses) > grow_num_synapses[0]
+    assert grow_num_synapses[-1] < np.amax(grow_num_synapses)
+
+    # Fixed capacity should never change but growable capacity should start
+    # small, grow as synapses are added and shrink once they are removed
+    assert np.all(fixed_strides == 20)
+    assert grow_strides[0] < 20
+    assert np.any(np.diff(grow_strides) > 0)
+    assert np.any(np.diff(grow_strides) < 0)
+    assert grow_strides[-1] < np.amax(grow_strides)
+
+    # Connectivity, weights and resultant input should be identical
+    assert np.array_equal(fixed_pre, grow_pre)
+    assert np.array_equal(fixed_post, grow_post)
+    assert np.allclose(fixed_g, grow_g)
+    assert np.allclose(fixed_x, grow_x)
+
+# Custom connectivity update which adds three synapses to each row
+add_three_model = create_custom_connectivity_update_model(
+    "add_three",
+    row_update_code=
+    """
+    for(unsigned int i = 1; i <= 3; i++) {
+        add_synapse((id_pre + i) % num_post);
+    }
+    """)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_row_capacity_overflow(precision, tmp_path):
+    model = GeNNModel(precision, "test_row_capacity_overflow", backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    pre_pop = model.add_neuron_population("Pre", 20, pre_neuron_model)
+    post_pop = model.add_neuron_population("Post", 20, post_neuron_model,
+                                           {}, {"x": 0.0})
+
+    # Make row capacity growable with less slack than the custom update adds to each row
+    s_pop = model.add_synapse_population(
+        "Synapse", "SPARSE", pre_pop, post_pop,
+        init_weight_update("StaticPulseConstantWeight", {"g": 1.0}),
+        init_postsynaptic("DeltaCurr"),
+        init_sparse_connectivity("OneToOne"))
+    s_pop.row_capacity_slack = 2
+
+    model.add_custom_connectivity_update(
+        "AddThree", "AddThree", s_pop, add_three_model)
+
+    model.build(str(tmp_path))
+    model.load()
+
+    # Check that adding synapses to full rows is reported
+    with pytest.raises(RuntimeError, match="row capacity slack"):
+        model.custom_update("AddThree")
+
+    # Check only the synapses which fitted were added 
+    # and that connectivity remains consistent
+    s_pop.pull_connectivity_from_device()
+    assert np.all(np.bincount(s_pop.get_sparse_pre_inds(), minlength=20) == 3)
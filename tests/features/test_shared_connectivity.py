@@ -0,0 +1,63 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (create_neuron_model,
+                    init_postsynaptic,
+                    init_sparse_connectivity,
+                    init_weight_update)
+
+# Neuron model which accumulates input from two synapse groups separately
+accumulate_neuron_model = create_neuron_model(
+    "accumulate_neuron",
+    vars=[("x", "scalar"), ("y", "scalar")],
+    sim_code=
+    """
+    x += Isyn;
+    y += Isyn2;
+    """,
+    additional_input_vars=[("Isyn2", "scalar", 0.0)])
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_shared_connectivity(make_model, backend, precision):
+    model = make_model(precision, "test_shared_connectivity", backend=backend)
+    model.dt = 1.0
+
+    pre_pop = model.add_neuron_population("Pre", 100, "Poisson",
+                                          {"rate": 50.0}, {"timeStepToSpike": 0.0})
+    post_pop = model.add_neuron_population("Post", 100, accumulate_neuron_model,
+                                           {}, {"x": 0.0, "y": 0.0})
+
+    # Two synapse groups with different weights but the same connectivity
+    target_pop = model.add_synapse_population(
+        "Target", "SPARSE", pre_pop, post_pop,
+        init_weight_update("StaticPulse", {}, {"g": 1.0}),
+        init_postsynaptic("DeltaCurr"),
+        init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+    sharer_pop = model.add_synapse_population(
+        "Sharer", "SPARSE", pre_pop, post_pop,
+        init_weight_update("StaticPulse", {}, {"g": 2.0}),
+        init_postsynaptic("DeltaCurr"),
+        init_sparse_connectivity("FixedProbability", {"prob": 0.1}))
+    sharer_pop.shared_connectivity_target = target_pop
+    sharer_pop.post_target_var = "Isyn2"
+
+    model.build()
+    model.load()
+
+    # Check sharer sees the target's connectivity
+    target_pop.pull_connectivity_from_device()
+    sharer_pop.pull_connectivity_from_device()
+    assert np.array_equal(target_pop.get_sparse_pre_inds(),
+                          sharer_pop.get_sparse_pre_inds())
+    assert np.array_equal(target_pop.get_sparse_post_inds(),
+                          sharer_pop.get_sparse_post_inds())
+
+    while model.timestep < 100:
+        model.step_time()
+
+    # As weights of sharer are doubled, its accumulated input should be too
+    post_pop.vars["x"].pull_from_device()
+    post_pop.vars["y"].pull_from_device()
+    assert np.any(post_pop.vars["x"].values > 0.0)
+    assert np.allclose(post_pop.vars["y"].values, 2.0 * post_pop.vars["x"].values)
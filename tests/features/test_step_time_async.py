@@ -0,0 +1,86 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+def _create_model(make_model, precision, name):
+    model = make_model(precision, name, backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    # LIF population driven by constant current so it fires regularly
+    pop = model.add_neuron_population("Pop", 10, "LIF",
+                                      {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                       "Vthresh": -51.0, "Ioffset": 1.5, "TauRefrac": 5.0},
+                                      {"V": np.linspace(-70.0, -52.0, 10), "RefracTime": 0.0})
+    model.build()
+    model.load()
+    return model, pop
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_step_time_async(make_model, precision):
+    # Simulate reference model synchronously, recording V every 10 timesteps
+    sync_model, sync_pop = _create_model(make_model, precision, "test_step_time_async_sync")
+    expected = []
+    for i in range(5):
+        for t in range(10):
+            sync_model.step_time()
+        sync_pop.vars["V"].pull_from_device()
+        expected.append(np.copy(sync_pop.vars["V"].view))
+
+    # Simulate model asynchronously, processing each
+    # snapshot while the following steps are simulated
+    async_model, async_pop = _create_model(make_model, precision, "test_step_time_async")
+    future = async_model.step_time_async(10, [(async_pop, "V")])
+    for i in range(5):
+        next_future = (async_model.step_time_async(10, [(async_pop, "V")])
+                       if i < 4 else None)
+        snapshot = future.result()
+        assert np.array_equal(snapshot[("Pop", "V")], expected[i])
+        future = next_future
+
+    # Check synchronous calls wait for asynchronous steps
+    async_model.step_time()
+    assert async_model.timestep == 51
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_step_time_async_snapshot_lifetime(make_model, precision):
+    # Simulate reference model synchronously, recording V every 10 timesteps
+    sync_model, sync_pop = _create_model(make_model, precision, "test_step_time_async_lifetime_sync")
+    expected = []
+    for i in range(4):
+        for t in range(10):
+            sync_model.step_time()
+        sync_pop.vars["V"].pull_from_device()
+        expected.append(np.copy(sync_pop.vars["V"].view))
+
+    # Queue several calls before reading any snapshots and check
+    # later calls don't overwrite the results of earlier ones
+    async_model, async_pop = _create_model(make_model, precision, "test_step_time_async_lifetime")
+    futures = [async_model.step_time_async(10, [(async_pop, "V")])
+               for i in range(4)]
+    snapshots = [f.result() for f in futures]
+    for s, e in zip(snapshots, expected):
+        assert np.array_equal(s[("Pop", "V")], e)
+
+    # Queue a call which fails followed by one which succeeds and check
+    # the failure is re-raised by the next synchronous operation
+    async_model.step_time_async(10, [(async_pop, "Missing")])
+    async_model.step_time_async(10)
+    with pytest.raises(KeyError):
+        async_model.step_time()
+    assert async_model.timestep == 60
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_step_time_async_unload(make_model, precision):
+    model, pop = _create_model(make_model, precision, "test_step_time_async_unload")
+
+    # Check timestep waits for queued steps
+    model.step_time_async(10)
+    assert model.timestep == 10
+
+    # Queue a call which fails and check unloading re-raises
+    # the failure but still leaves the model unloaded
+    model.step_time_async(10, [(pop, "Missing")])
+    with pytest.raises(KeyError):
+        model.unload()
+    assert not model._loaded
+    assert model._runtime is None
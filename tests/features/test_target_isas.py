@@ -0,0 +1,32 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import GeNNModel
+
+def _simulate(precision, name, path, **preferences):
+    model = GeNNModel(precision, name, backend="single_threaded_cpu", **preferences)
+    model.dt = 1.0
+
+    # LIF population driven by constant current so it fires regularly
+    pop = model.add_neuron_population("Pop", 100, "LIF",
+                                      {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                       "Vthresh": -51.0, "Ioffset": 1.5, "TauRefrac": 5.0},
+                                      {"V": np.linspace(-70.0, -52.0, 100), "RefracTime": 0.0})
+    model.build(str(path))
+    model.load()
+
+    while model.timestep < 100:
+        model.step_time()
+
+    pop.vars["V"].pull_from_device()
+    return np.copy(pop.vars["V"].view)
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_target_isas(precision, tmp_path):
+    default_v = _simulate(precision, "test_target_isas_default", tmp_path)
+    multi_v = _simulate(precision, "test_target_isas", tmp_path,
+                        target_isas=["x86-64-v2", "x86-64-v3", "x86-64-v4"])
+
+    # Whichever version of the update code is selected, results should match
+    assert np.allclose(default_v, multi_v)
@@ -0,0 +1,92 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+from pygenn import (create_neuron_model, init_postsynaptic,
+                    init_toeplitz_connectivity, init_weight_update, GeNNModel)
+from pygenn.single_threaded_cpu_backend import PresynapticUpdateStrategy
+
+# Neuron model which spikes in a fixed, irregular pattern
+pre_neuron_model = create_neuron_model(
+    "pre_neuron",
+    threshold_condition_code=
+    """
+    (((id * 13) + (unsigned int)round(t)) % 7) == 0
+    """)
+
+# Neuron model which accumulates its input
+post_neuron_model = create_neuron_model(
+    "post_neuron",
+    sim_code=
+    """
+    x += Isyn;
+    """,
+    vars=[("x", "scalar")])
+
+def _simulate(precision, name, path, strategy):
+    synapse_groups = ["Same", "Valid", "AvgPool"]
+    model = GeNNModel(precision, name, backend="single_threaded_cpu",
+                      manual_presynaptic_update_strategies={s: strategy
+                                                            for s in synapse_groups})
+    model.dt = 1.0
+
+    rng = np.random.default_rng(1234)
+    pre_pop = model.add_neuron_population("Pre", 10 * 10 * 2, pre_neuron_model)
+
+    # 'Same' padded convolution with square kernel
+    same_pop = model.add_neuron_population("SamePost", 10 * 10 * 4, post_neuron_model,
+                                           {}, {"x": 0.0})
+    model.add_synapse_population(
+        "Same", "TOEPLITZ", pre_pop, same_pop,
+        init_weight_update("StaticPulse", {}, {"g": rng.uniform(-1.0, 1.0, 3 * 3 * 2 * 4)}),
+        init_postsynaptic("DeltaCurr"),
+        init_toeplitz_connectivity("Conv2D", {"conv_kh": 3, "conv_kw": 3,
+                                              "conv_ih": 10, "conv_iw": 10, "conv_ic": 2,
+                                              "conv_oh": 10, "conv_ow": 10, "conv_oc": 4}))
+
+    # Unpadded convolution with rectangular kernel
+    valid_pop = model.add_neuron_population("ValidPost", 8 * 6 * 3, post_neuron_model,
+                                            {}, {"x": 0.0})
+    model.add_synapse_population(
+        "Valid", "TOEPLITZ", pre_pop, valid_pop,
+        init_weight_update("StaticPulse", {}, {"g": rng.uniform(-1.0, 1.0, 3 * 5 * 2 * 3)}),
+        init_postsynaptic("DeltaCurr"),
+        init_toeplitz_connectivity("Conv2D", {"conv_kh": 3, "conv_kw": 5,
+                                              "conv_ih": 10, "conv_iw": 10, "conv_ic": 2,
+                                              "conv_oh": 8, "conv_ow": 6, "conv_oc": 3}))
+
+    # Convolution preceded by pooling whose stride is larger than its kernel
+    avg_pool_pop = model.add_neuron_population("AvgPoolPost", 3 * 3 * 2, post_neuron_model,
+                                               {}, {"x": 0.0})
+    model.add_synapse_population(
+        "AvgPool", "TOEPLITZ", pre_pop, avg_pool_pop,
+        init_weight_update("StaticPulse", {}, {"g": rng.uniform(-1.0, 1.0, 3 * 3 * 2 * 2)}),
+        init_postsynaptic("DeltaCurr"),
+        init_toeplitz_connectivity("AvgPoolConv2D", {"conv_kh": 3, "conv_kw": 3,
+                                                     "pool_kh": 2, "pool_kw": 2,
+                                                     "pool_sh": 3, "pool_sw": 3,
+                                                     "pool_ih": 10, "pool_iw": 10, "pool_ic": 2,
+                                                     "conv_oh": 3, "conv_ow": 3, "conv_oc": 2}))
+    model.build(str(path))
+    model.load()
+
+    while model.timestep < 20:
+        model.step_time()
+
+    output = []
+    for p in [same_pop, valid_pop, avg_pool_pop]:
+        p.vars["x"].pull_from_device()
+        output.append(np.copy(p.vars["x"].view))
+    return output
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_toeplitz_conv2d(precision, tmp_path):
+    diagonal_output = _simulate(precision, "test_toeplitz_conv2d_diagonal", tmp_path,
+                                PresynapticUpdateStrategy.TOEPLITZ_DIAGONAL_MAJOR)
+    conv_output = _simulate(precision, "test_toeplitz_conv2d", tmp_path,
+                            PresynapticUpdateStrategy.TOEPLITZ_CONV2D)
+
+    # Check convolution engine matches the general Toeplitz update
+    for d, c in zip(diagonal_output, conv_output):
+        assert np.any(d != 0.0)
+        assert np.allclose(d, c)
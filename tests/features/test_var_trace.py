@@ -0,0 +1,35 @@
+import numpy as np
+import pytest
+from pygenn import types
+
+@pytest.mark.parametrize("precision", [types.Double, types.Float])
+def test_var_trace(make_model, precision):
+    model = make_model(precision, "test_var_trace", backend="single_threaded_cpu")
+    model.dt = 1.0
+
+    # LIF population driven by constant current so it fires regularly
+    pop = model.add_neuron_population("Pop", 10, "LIF",
+                                      {"C": 1.0, "TauM": 20.0, "Vrest": -70.0, "Vreset": -70.0,
+                                       "Vthresh": -51.0, "Ioffset": 1.5, "TauRefrac": 5.0},
+                                      {"V": np.linspace(-70.0, -52.0, 10), "RefracTime": 0.0})
+
+    # Trace membrane voltage of every third neuron every second timestep
+    trace_ids = [0, 3, 6, 9]
+    pop.set_var_trace_recording("V", trace_ids, 2)
+    model.build()
+    model.load(num_recording_timesteps=100)
+
+    # Simulate, manually sampling membrane voltage
+    expected = []
+    while model.timestep < 100:
+        model.step_time()
+        if (model.timestep % 2) == 1:
+            pop.vars["V"].pull_from_device()
+            expected.append(np.copy(pop.vars["V"].view[trace_ids]))
+
+    # Check traced voltages match
+    model.pull_recording_buffers_from_device()
+    trace = pop.get_var_trace("V")
+    assert len(trace) == 1
+    assert trace[0].shape == (50, len(trace_ids))
+    assert np.array_equal(trace[0], np.asarray(expected))
@@ -0,0 +1,66 @@
+// Standard C++ includes
+#include <limits>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN code generator includes
+#include "code_generator/codeGenUtils.h"
+
+using namespace GeNN::CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+void testFastDivide(uint32_t divisor)
+{
+    const auto [mul, shift1, shift2] = getFastDivide(divisor);
+
+    // Test numerators around zero, the divisor and its multiples and the extremes of the range
+    constexpr uint32_t max = std::numeric_limits<uint32_t>::max();
+    const uint64_t numerators[] = {0, 1, 2, 3, 1000, 123456789, (1u << 31) - 1, 1u << 31, (1u << 31) + 1, max - 1, max,
+                                   divisor - 1ull, divisor, divisor + 1ull, 2ull * divisor - 1, 2ull * divisor, 2ull * divisor + 1,
+                                   (max / divisor) * divisor - 1, (max / divisor) * divisor};
+    for(uint64_t n64 : numerators) {
+        // Skip numerators which don't fit in 32-bits
+        if(n64 > max) {
+            continue;
+        }
+
+        const uint32_t n = static_cast<uint32_t>(n64);
+        const uint32_t t = static_cast<uint32_t>((static_cast<uint64_t>(mul) * n) >> 32);
+        const uint32_t q = (t + ((n - t) >> shift1)) >> shift2;
+        ASSERT_EQ(q, n / divisor) << "n=" << n << ", divisor=" << divisor;
+    }
+}
+}
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(CodeGenUtils, FastDivide)
+{
+    // Divisor of one
+    testFastDivide(1);
+
+    // Powers of two
+    for(unsigned int i = 1; i < 32; i++) {
+        testFastDivide(1u << i);
+    }
+
+    // Non powers of two including divisors > 2^31
+    testFastDivide(3);
+    testFastDivide(7);
+    testFastDivide(37);
+    testFastDivide(1000);
+    testFastDivide((1u << 31) - 1);
+    testFastDivide((1u << 31) + 1);
+    testFastDivide(3000000000u);
+    testFastDivide(std::numeric_limits<uint32_t>::max() - 1);
+    testFastDivide(std::numeric_limits<uint32_t>::max());
+
+    // Divisor of zero, e.g. the row stride of an empty synapse group, shouldn't be divided by
+    ASSERT_EQ(getFastDivide(0), std::make_tuple(0u, 0u, 0u));
+}
@@ -11,6 +11,7 @@
 
 // (Single-threaded CPU) backend includes
 #include "backend.h"
+#include "optimiser.h"
 
 using namespace GeNN;
 
@@ -307,6 +308,7 @@ TEST(ModelSpecMerged, CompareModelChanges)
         {[](ModelSpecInternal &model) { model.setName("interesting_name"); }, false},
         {[](ModelSpecInternal &model) { model.setDT(1.0); }, false},
         {[](ModelSpecInternal &model) { model.setTimingEnabled(true); }, false},
+        {[](ModelSpecInternal &model) { model.setProfilingEnabled(true); }, false},
         {[](ModelSpecInternal &model) { model.setPrecision(Type::Double); }, false},
         {[](ModelSpecInternal &model) { model.setTimePrecision(Type::Double); }, false},
         {[](ModelSpecInternal &model) { model.setSeed(1234); }, false}};
@@ -1375,4 +1377,132 @@ TEST(ModelSpecMerged, CompareCustomConnectivityUpdatePreVarLocationChanges)
 TEST(ModelSpecMerged, CompareCustomConnectivityUpdatePostVarLocationChanges)
 {
     testCustomConnectivityUpdateVarLocation([](CustomConnectivityUpdate *ccu, VarLocation varLocation) {ccu->setPostVarLocation("postThresh", varLocation); });
-}
\ No newline at end of file
+}
+//--------------------------------------------------------------------------
+TEST(ModelSpecMerged, ComparePresynapticUpdateStrategyChanges)
+{
+    ModelSpecInternal model;
+    model.setName("test");
+    model.setDT(0.1);
+    model.setPrecision(Type::Float);
+
+    // Add BITMASK synapse group with connectivity initialised on device
+    VarValues neuronVarVals{{"V", 0.0}, {"U", 0.0}};
+    ParamValues neuronParamVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 4.0}};
+    auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 100, neuronParamVals, neuronVarVals);
+    auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 100, neuronParamVals, neuronVarVals);
+    model.addSynapsePopulation(
+        "Synapse", SynapseMatrixType::BITMASK,
+        pre, post,
+        initWeightUpdate<WeightUpdateModels::StaticPulseConstantWeight>({{"g", 1.0}}),
+        initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    model.finalise();
+
+    // Merge model with default backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend defaultBackend(preferences);
+    CodeGenerator::ModelSpecMerged defaultModelMerged(defaultBackend, model);
+    const auto &sg = defaultModelMerged.getMergedPresynapticUpdateGroups().at(0);
+    ASSERT_EQ(defaultBackend.getPresynapticUpdateStrategy(sg), CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::ROW_WISE);
+
+    // Merge model with backend using word-packed strategy for this group
+    CodeGenerator::SingleThreadedCPU::Backend tunedBackend(
+        preferences, {{sg.getHashDigest(), CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::WORD_PACKED_BITMASK}});
+    CodeGenerator::ModelSpecMerged tunedModelMerged(tunedBackend, model);
+    const auto &tunedSG = tunedModelMerged.getMergedPresynapticUpdateGroups().at(0);
+    ASSERT_EQ(tunedBackend.getPresynapticUpdateStrategy(tunedSG), CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::WORD_PACKED_BITMASK);
+
+    // Check selected strategies force rebuild
+    ASSERT_NE(defaultModelMerged.getHashDigest(defaultBackend), tunedModelMerged.getHashDigest(tunedBackend));
+}
+//--------------------------------------------------------------------------
+TEST(ModelSpecMerged, ToeplitzConv2DPresynapticUpdateStrategy)
+{
+    ModelSpecInternal model;
+    model.setName("test");
+    model.setDT(0.1);
+    model.setPrecision(Type::Float);
+
+    // Add TOEPLITZ synapse group with built-in 2D convolution connectivity
+    VarValues neuronVarVals{{"V", 0.0}, {"U", 0.0}};
+    ParamValues neuronParamVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 4.0}};
+    ParamValues convParamVals{{"conv_kh", 3}, {"conv_kw", 3},
+                              {"conv_ih", 10}, {"conv_iw", 10}, {"conv_ic", 1},
+                              {"conv_oh", 10}, {"conv_ow", 10}, {"conv_oc", 4}};
+    auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10 * 10, neuronParamVals, neuronVarVals);
+    auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10 * 10 * 4, neuronParamVals, neuronVarVals);
+    model.addSynapsePopulation(
+        "Synapse", SynapseMatrixType::TOEPLITZ,
+        pre, post,
+        initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+        initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+        initToeplitzConnectivity<InitToeplitzConnectivitySnippet::Conv2D>(convParamVals));
+    model.finalise();
+
+    // Check convolution engine is used by default
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+    CodeGenerator::ModelSpecMerged modelMerged(backend, model);
+    const auto &sg = modelMerged.getMergedPresynapticUpdateGroups().at(0);
+    ASSERT_TRUE(backend.isToeplitzConv2DSupported(sg));
+    ASSERT_EQ(backend.getPresynapticUpdateStrategy(sg), CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TOEPLITZ_CONV2D);
+
+    // Check other Toeplitz strategies can be selected manually
+    preferences.manualPresynapticUpdateStrategies = {{"Synapse", CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR}};
+    const auto manualBackend = CodeGenerator::SingleThreadedCPU::Optimiser::createBackend(model, filesystem::path("."), plog::info, nullptr, preferences);
+    CodeGenerator::ModelSpecMerged manualModelMerged(manualBackend, model);
+    const auto &manualSG = manualModelMerged.getMergedPresynapticUpdateGroups().at(0);
+    ASSERT_EQ(manualBackend.getPresynapticUpdateStrategy(manualSG), CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR);
+
+    // Check strategies which aren't compatible with connectivity and unknown synapse groups are rejected
+    preferences.manualPresynapticUpdateStrategies = {{"Synapse", CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::WORD_PACKED_BITMASK}};
+    EXPECT_THROW(CodeGenerator::SingleThreadedCPU::Optimiser::createBackend(model, filesystem::path("."), plog::info, nullptr, preferences),
+                 std::runtime_error);
+    preferences.manualPresynapticUpdateStrategies = {{"Missing", CodeGenerator::SingleThreadedCPU::PresynapticUpdateStrategy::TOEPLITZ_DIAGONAL_MAJOR}};
+    EXPECT_THROW(CodeGenerator::SingleThreadedCPU::Optimiser::createBackend(model, filesystem::path("."), plog::info, nullptr, preferences),
+                 std::runtime_error);
+}
+//--------------------------------------------------------------------------
+TEST(ModelSpecMerged, SpecialiseSmallMergedGroups)
+{
+    const auto createModel =
+        [](ModelSpecInternal &model, size_t numPops)
+        {
+            model.setName("test");
+            model.setDT(0.1);
+            model.setPrecision(Type::Float);
+
+            // Add Izhikevich populations with different sizes and parameters which could all be merged
+            VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+            for(size_t p = 0; p < numPops; p++) {
+                ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 2.0 + p}};
+                model.addNeuronPopulation<NeuronModels::Izhikevich>("Neurons" + std::to_string(p), 100 + p, paramVals, varVals);
+            }
+            model.finalise();
+        };
+
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    preferences.maxSpecialisedGroups = 2;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+
+    // Two populations are specialised into seperate merged groups
+    {
+        ModelSpecInternal model;
+        createModel(model, 2);
+        CodeGenerator::ModelSpecMerged modelMerged(backend, model);
+        ASSERT_EQ(modelMerged.getMergedNeuronUpdateGroups().size(), 2);
+        for(const auto &n : modelMerged.getMergedNeuronUpdateGroups()) {
+            ASSERT_EQ(n.getGroups().size(), 1);
+        }
+    }
+
+    // Three populations exceed threshold and are merged
+    {
+        ModelSpecInternal model;
+        createModel(model, 3);
+        CodeGenerator::ModelSpecMerged modelMerged(backend, model);
+        ASSERT_EQ(modelMerged.getMergedNeuronUpdateGroups().size(), 1);
+        ASSERT_EQ(modelMerged.getMergedNeuronUpdateGroups()[0].getGroups().size(), 3);
+    }
+}
@@ -7,6 +7,7 @@
 // GeNN code generator includes
 #include "code_generator/generateModules.h"
 #include "code_generator/modelSpecMerged.h"
+#include "code_generator/standardLibrary.h"
 
 // (Single-threaded CPU) backend includes
 #include "backend.h"
@@ -107,6 +108,17 @@ public:
 };
 IMPLEMENT_SNIPPET(AlphaCurr);
 
+class Copy : public CustomUpdateModels::Base
+{
+    DECLARE_SNIPPET(Copy);
+
+    SET_UPDATE_CODE("x = a;\n");
+
+    SET_CUSTOM_UPDATE_VARS({{"x", "scalar"}});
+    SET_VAR_REFS({{"a", "scalar", VarAccessMode::READ_ONLY}});
+};
+IMPLEMENT_SNIPPET(Copy);
+
 class EmptyNeuron : public NeuronModels::Base
 {
 public:
@@ -898,6 +910,177 @@ TEST(NeuronGroup, CompareSimRNG)
     ASSERT_TRUE(ng1Internal->isSimRNGRequired());
 }
 
+TEST(NeuronGroup, CompareActivityProbes)
+{
+    ModelSpecInternal model;
+
+    // Add neuron groups with different activity probes to model
+    ParamValues paramVals{{"C", 0.25}, {"TauM", 10.0}, {"Vrest", 0.0}, {"Vreset", 0.0}, {"Vthresh", 20.0}, {"Ioffset", 0.0}, {"TauRefrac", 5.0}};
+    VarValues varVals{{"V", 0.0}, {"RefracTime", 0.0}};
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons1", 10, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons2", 10, paramVals, varVals);
+    auto *ng3 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons3", 10, paramVals, varVals);
+    auto *ng4 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons4", 10, paramVals, varVals);
+    ng1->setSpikeCountRecordingEnabled(true);
+    ng2->setSpikeRateTau(20.0);
+    ng3->setISIHistogram(10, 1.0);
+    ng4->setISIHistogram(10, 2.0);
+
+    model.finalise();
+
+    // Check that groups cannot be merged
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal*>(ng0);
+    NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal*>(ng1);
+    NeuronGroupInternal *ng2Internal = static_cast<NeuronGroupInternal*>(ng2);
+    NeuronGroupInternal *ng3Internal = static_cast<NeuronGroupInternal*>(ng3);
+    NeuronGroupInternal *ng4Internal = static_cast<NeuronGroupInternal*>(ng4);
+    ASSERT_NE(ng0Internal->getHashDigest(), ng1Internal->getHashDigest());
+    ASSERT_NE(ng0Internal->getHashDigest(), ng2Internal->getHashDigest());
+    ASSERT_NE(ng0Internal->getHashDigest(), ng3Internal->getHashDigest());
+    ASSERT_NE(ng3Internal->getHashDigest(), ng4Internal->getHashDigest());
+
+    // Check that only probes which require state initialisation affect init hash
+    ASSERT_EQ(ng0Internal->getInitHashDigest(), ng1Internal->getInitHashDigest());
+    ASSERT_NE(ng0Internal->getInitHashDigest(), ng2Internal->getInitHashDigest());
+    ASSERT_NE(ng0Internal->getInitHashDigest(), ng3Internal->getInitHashDigest());
+    ASSERT_EQ(ng3Internal->getInitHashDigest(), ng4Internal->getInitHashDigest());
+
+    // Check ISI histogram requires spike times
+    ASSERT_FALSE(ng0Internal->isSpikeTimeRequired());
+    ASSERT_TRUE(ng3Internal->isSpikeTimeRequired());
+}
+
+TEST(NeuronGroup, CompareVarTraces)
+{
+    ModelSpecInternal model;
+
+    // Add neuron groups with different variable traces to model
+    ParamValues paramVals{{"C", 0.25}, {"TauM", 10.0}, {"Vrest", 0.0}, {"Vreset", 0.0}, {"Vthresh", 20.0}, {"Ioffset", 0.0}, {"TauRefrac", 5.0}};
+    VarValues varVals{{"V", 0.0}, {"RefracTime", 0.0}};
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons1", 10, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons2", 10, paramVals, varVals);
+    auto *ng3 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons3", 10, paramVals, varVals);
+    auto *ng4 = model.addNeuronPopulation<NeuronModels::LIF>("Neurons4", 10, paramVals, varVals);
+    ng1->setVarTraceRecording("V", {0, 1, 2});
+    ng2->setVarTraceRecording("V", {3, 5, 7});
+    ng3->setVarTraceRecording("V", {0, 1, 2}, 2);
+    ng4->setVarTraceRecording("V", {0, 1});
+
+    // Check invalid traces are rejected
+    EXPECT_THROW(ng0->setVarTraceRecording("X", {0}), std::runtime_error);
+    EXPECT_THROW(ng0->setVarTraceRecording("V", {0}, 0), std::runtime_error);
+    EXPECT_THROW(ng0->setVarTraceRecording("V", {10}), std::runtime_error);
+
+    model.finalise();
+
+    // Check that groups with different traces cannot be merged but that traced neuron indices don't matter
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal*>(ng0);
+    NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal*>(ng1);
+    NeuronGroupInternal *ng2Internal = static_cast<NeuronGroupInternal*>(ng2);
+    NeuronGroupInternal *ng3Internal = static_cast<NeuronGroupInternal*>(ng3);
+    NeuronGroupInternal *ng4Internal = static_cast<NeuronGroupInternal*>(ng4);
+    ASSERT_TRUE(ng0Internal->getVarTraces().empty());
+    ASSERT_NE(ng0Internal->getHashDigest(), ng1Internal->getHashDigest());
+    ASSERT_EQ(ng1Internal->getHashDigest(), ng2Internal->getHashDigest());
+    ASSERT_NE(ng1Internal->getHashDigest(), ng3Internal->getHashDigest());
+    ASSERT_NE(ng1Internal->getHashDigest(), ng4Internal->getHashDigest());
+
+    // Check traces enable recording
+    ASSERT_FALSE(ng0Internal->isRecordingEnabled());
+    ASSERT_TRUE(ng1Internal->isRecordingEnabled());
+}
+
+TEST(NeuronGroup, CompareApproximateMaths)
+{
+    ModelSpecInternal model;
+
+    // Add neuron groups, one of which uses approximate maths functions
+    ParamValues paramVals{{"gNa", 7.15}, {"ENa", 50.0}, {"gK", 1.43}, {"EK", -95.0}, {"gl", 0.02672}, {"El", -63.563}, {"C", 0.143}};
+    VarValues varVals{{"V", -60.0}, {"m", 0.0529324}, {"h", 0.3176767}, {"n", 0.5961207}};
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::TraubMiles>("Neurons0", 10, paramVals, varVals);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::TraubMiles>("Neurons1", 10, paramVals, varVals);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::TraubMiles>("Neurons2", 10, paramVals, varVals);
+    ng1->setApproximateMathsEnabled(true);
+    ng2->setApproximateMathsEnabled(false);
+    model.finalise();
+
+    // Check that only groups which use the same maths functions can be merged
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal*>(ng0);
+    NeuronGroupInternal *ng1Internal = static_cast<NeuronGroupInternal*>(ng1);
+    NeuronGroupInternal *ng2Internal = static_cast<NeuronGroupInternal*>(ng2);
+    ASSERT_NE(ng0Internal->getHashDigest(), ng1Internal->getHashDigest());
+    ASSERT_EQ(ng0Internal->getHashDigest(), ng2Internal->getHashDigest());
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(backend, model);
+    ASSERT_EQ(modelSpecMerged.getMergedNeuronUpdateGroups().size(), 2);
+
+    // Check approximate functions are substituted only for group that enables them
+    auto memorySpaces = backend.getMergedGroupMemorySpaces(modelSpecMerged);
+    std::ostringstream neuronUpdate;
+    CodeGenerator::generateNeuronUpdate(neuronUpdate, modelSpecMerged, backend, memorySpaces);
+    ASSERT_NE(neuronUpdate.str().find("gennApproxExp("), std::string::npos);
+    ASSERT_NE(neuronUpdate.str().find("exp("), std::string::npos);
+
+    // Check sigmoid is only provided alongside approximate functions so it can't shadow model identifiers
+    ASSERT_EQ(CodeGenerator::StandardLibrary::getMathsFunctions().count("sigmoid"), 0);
+    ASSERT_EQ(CodeGenerator::StandardLibrary::getApproximateMathsFunctions().count("sigmoid"), 2);
+}
+
+TEST(NeuronGroup, DemoteConstantReadOnlyVars)
+{
+    ModelSpecInternal model;
+    model.setDemoteConstantReadOnlyVars(true);
+
+    // Add neuron groups with constant and non-constant read-only variables
+    VarValues varVals0{{"V", 0.0}, {"U", 0.0}, {"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals1{{"V", 0.0}, {"U", 0.0}, {"a", initVar<InitVarSnippet::Uniform>({{"min", 0.01}, {"max", 0.03}})}, 
+                       {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    auto *ng0 = model.addNeuronPopulation<NeuronModels::IzhikevichVariable>("Neurons0", 10, {}, varVals0);
+    auto *ng1 = model.addNeuronPopulation<NeuronModels::IzhikevichVariable>("Neurons1", 10, {}, varVals1);
+    auto *ng2 = model.addNeuronPopulation<NeuronModels::IzhikevichVariable>("Neurons2", 10, {}, varVals0);
+    auto *ng3 = model.addNeuronPopulation<NeuronModels::IzhikevichVariable>("Neurons3", 10, {}, varVals0);
+    ng3->setVarTraceRecording("c", {0});
+
+    // Reference one of third neuron group's variables from a custom update
+    model.addCustomUpdate<Copy>("Copy", "CustomUpdate", {}, {{"x", 0.0}}, {{"a", createVarRef(ng2, "b")}});
+    model.finalise();
+
+    // Check that only read-only variables initialised to constants which aren't referenced or traced are demoted
+    ASSERT_FALSE(ng0->isVarDemoted("V"));
+    ASSERT_FALSE(ng0->isVarDemoted("U"));
+    ASSERT_TRUE(ng0->isVarDemoted("a"));
+    ASSERT_TRUE(ng0->isVarDemoted("b"));
+    ASSERT_FALSE(ng1->isVarDemoted("a"));
+    ASSERT_TRUE(ng1->isVarDemoted("b"));
+    ASSERT_TRUE(ng2->isVarDemoted("a"));
+    ASSERT_FALSE(ng2->isVarDemoted("b"));
+    ASSERT_TRUE(ng3->isVarDemoted("b"));
+    ASSERT_FALSE(ng3->isVarDemoted("c"));
+
+    // Check demoted variables are excluded from adapter
+    NeuronGroupInternal *ng0Internal = static_cast<NeuronGroupInternal*>(ng0);
+    ASSERT_EQ(NeuronVarAdapter(*ng0Internal).getDefs().size(), 2);
+    ASSERT_EQ(NeuronVarAdapter(*ng0Internal).getDemotedDefs().size(), 4);
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+
+    // Merge model and check demoted variables are substituted with constants
+    CodeGenerator::ModelSpecMerged modelSpecMerged(backend, model);
+    auto memorySpaces = backend.getMergedGroupMemorySpaces(modelSpecMerged);
+    std::ostringstream neuronUpdate;
+    CodeGenerator::generateNeuronUpdate(neuronUpdate, modelSpecMerged, backend, memorySpaces);
+    ASSERT_NE(neuronUpdate.str().find("6.500000000e+01f"), std::string::npos);
+}
+
 TEST(NeuronGroup, CompareCurrentSources)
 {
     ModelSpecInternal model;
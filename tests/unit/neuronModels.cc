@@ -47,6 +47,31 @@ public:
     SET_NEEDS_AUTO_REFRACTORY(false);
 };
 
+//--------------------------------------------------------------------------
+// LinearLeaky
+//--------------------------------------------------------------------------
+class LinearLeaky : public NeuronModels::Base
+{
+public:
+    SET_PARAMS({"TauM"});
+    SET_VARS({{"V", "scalar"}});
+
+    SET_LINEAR_DYNAMICS({{"V"}, 
+                         [](const ParamValues &pars, double){ return std::vector<double>{-1.0 / pars.at("TauM").cast<double>()}; },
+                         {"Isyn / TauM"}});
+};
+
+//--------------------------------------------------------------------------
+// NonlinearBadVar
+//--------------------------------------------------------------------------
+class NonlinearBadVar : public NeuronModels::Base
+{
+public:
+    SET_VARS({{"V", "scalar"}, {"U", "scalar", VarAccess::READ_ONLY}});
+
+    SET_NONLINEAR_DYNAMICS({{"U", "-U"}});
+};
+
 //--------------------------------------------------------------------------
 // Tests
 //--------------------------------------------------------------------------
@@ -131,3 +156,31 @@ TEST(NeuronModels, ValidateVarValues)
     catch(const std::runtime_error &) {
     } 
 }
+//--------------------------------------------------------------------------
+TEST(NeuronModels, LinearDynamicsPropagators) 
+{
+    LinearLeaky linearLeaky;
+    const auto derivedParams = linearLeaky.getLinearDynamicsDerivedParams();
+    ASSERT_EQ(derivedParams.size(), 2);
+    ASSERT_EQ(derivedParams[0].name, "linP0_0");
+    ASSERT_EQ(derivedParams[1].name, "linQ0_0");
+
+    // Check propagators match exact solution of tau dV/dt = -V + Isyn
+    const ParamValues paramVals{{"TauM", 20.0}};
+    ASSERT_NEAR(derivedParams[0].func(paramVals, 0.5).cast<double>(), std::exp(-0.5 / 20.0), 1E-12);
+    ASSERT_NEAR(derivedParams[1].func(paramVals, 0.5).cast<double>(), 20.0 * (1.0 - std::exp(-0.5 / 20.0)), 1E-12);
+
+    // Check integration code is generated
+    ASSERT_NE(linearLeaky.getDynamicsCode().find("V = linX0;"), std::string::npos);
+}
+//--------------------------------------------------------------------------
+TEST(NeuronModels, ValidateDynamics) 
+{
+    NonlinearBadVar nonlinearBadVar;
+    try {
+        nonlinearBadVar.validate({}, {{"V", 0.0}, {"U", 0.0}}, "Neuron group");
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+}
@@ -0,0 +1,66 @@
+// Standard C++ includes
+#include <map>
+#include <string>
+
+// Google test includes
+#include "gtest/gtest.h"
+
+// GeNN code generator includes
+#include "code_generator/substitutionTemplate.h"
+
+using namespace GeNN;
+using namespace GeNN::CodeGenerator;
+
+//--------------------------------------------------------------------------
+// Anonymous namespace
+//--------------------------------------------------------------------------
+namespace
+{
+std::string render(const std::string &format)
+{
+    const std::map<std::string, std::string> values{{"x", "X"}, {"id", "ID"}, {"_rng", "RNG"}, {"a1", "A1"}};
+    return SubstitutionTemplate(format).render(
+        [&values](const std::string &name){ return values.at(name); });
+}
+}   // Anonymous namespace
+
+//--------------------------------------------------------------------------
+// Tests
+//--------------------------------------------------------------------------
+TEST(SubstitutionTemplate, NoSubstitutions)
+{
+    const SubstitutionTemplate empty("");
+    ASSERT_FALSE(empty.hasSubstitutions());
+    ASSERT_EQ(empty.getLiterals().size(), 1);
+
+    ASSERT_EQ(render(""), "");
+    ASSERT_EQ(render("x + y;"), "x + y;");
+}
+//--------------------------------------------------------------------------
+TEST(SubstitutionTemplate, Slots)
+{
+    const SubstitutionTemplate format("$(_rng)[$(id)] = $(x)");
+    ASSERT_TRUE(format.hasSubstitutions());
+    ASSERT_EQ(format.getNames(), (std::vector<std::string>{"_rng", "id", "x"}));
+    ASSERT_EQ(format.getLiterals(), (std::vector<std::string>{"", "[", "] = ", ""}));
+
+    // Check slots are resolved in order
+    std::vector<std::string> names;
+    format.render([&names](const std::string &name){ names.push_back(name); return ""; });
+    ASSERT_EQ(names, (std::vector<std::string>{"_rng", "id", "x"}));
+
+    ASSERT_EQ(render("$(_rng)[$(id)] = $(x)"), "RNG[ID] = X");
+    ASSERT_EQ(render("$(x)$(x)"), "XX");
+    ASSERT_EQ(render("$(a1) * 2"), "A1 * 2");
+}
+//--------------------------------------------------------------------------
+TEST(SubstitutionTemplate, InvalidReferences)
+{
+    // Function arguments, unterminated references and invalid identifiers are left as literals
+    ASSERT_EQ(render("$(0) + $(1)"), "$(0) + $(1)");
+    ASSERT_EQ(render("$(x"), "$(x");
+    ASSERT_EQ(render("$x) $("), "$x) $(");
+    ASSERT_EQ(render("$(x y) $(1x)"), "$(x y) $(1x)");
+    ASSERT_EQ(render("$$(x)"), "$X");
+    ASSERT_EQ(render("$(0, $(x))"), "$(0, X)");
+}
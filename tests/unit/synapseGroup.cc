@@ -10,6 +10,7 @@
 
 // (Single-threaded CPU) backend includes
 #include "backend.h"
+#include "optimiser.h"
 
 // Test includes
 #include "helpers.h"
@@ -184,6 +185,19 @@ public:
 };
 IMPLEMENT_SNIPPET(StaticPulsePostLearn);
 
+class StaticPulseLazyDecay : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_SNIPPET(StaticPulseLazyDecay);
+
+    SET_PARAMS({"tau"});
+    SET_VARS({ {"g", "scalar"} });
+
+    SET_PRE_SPIKE_SYN_CODE("addToPost(g);\n");
+    SET_LAZY_DECAY_VARS({{"g", "tau"}});
+};
+IMPLEMENT_SNIPPET(StaticPulseLazyDecay);
+
 class PostRepeatVal : public InitVarSnippet::Base
 {
 public:
@@ -969,6 +983,91 @@ TEST(SynapseGroup, InvalidMatrixTypes)
     }
     catch(const std::runtime_error &) {
     }
+
+    // Check that making a synapse group with lazily-decayed variables and dense procedural weights fails
+    try {
+        model.addSynapsePopulation(
+            "NeuronsA_NeuronsB_5", SynapseMatrixType::DENSE_PROCEDURALG,
+            ngA, ngB,
+            initWeightUpdate<StaticPulseLazyDecay>({{"tau", 10.0}}, {{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>());
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+}
+
+TEST(SynapseGroup, AutoMatrixType)
+{
+    ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+    ParamValues stdpParams{{"tauPlus", 10.0}, {"tauMinus", 10.0}, {"Aplus", 0.01}, {"Aminus", 0.01}, {"Wmin", 0.0}, {"Wmax", 1.0}};
+    ParamValues fixedProbParams{{"prob", 0.1}};
+
+    // Add synapse groups with AUTO matrix type and different connectivity and learning rules to model with unlimited memory budget
+    {
+        ModelSpecInternal model;
+        auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+        auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 20, paramVals, varVals);
+        auto *dense = model.addSynapsePopulation(
+            "Dense", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>());
+        auto *denseSTDP = model.addSynapsePopulation(
+            "DenseSTDP", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<STDPAdditive>(stdpParams, {{"g", 0.0}}, {{"preTrace", 0.0}}, {{"postTrace", 0.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>());
+        auto *sparse = model.addSynapsePopulation(
+            "Sparse", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+        auto *sparseSTDP = model.addSynapsePopulation(
+            "SparseSTDP", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<STDPAdditive>(stdpParams, {{"g", 0.0}}, {{"preTrace", 0.0}}, {{"postTrace", 0.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+
+        // Check weight update variables of groups with AUTO matrix type can't be referenced
+        EXPECT_THROW(createWUVarRef(dense, "g"), std::runtime_error);
+
+        model.finalise();
+
+        // Check constant weights are generated on the fly and plastic ones are stored
+        ASSERT_EQ(dense->getMatrixType(), SynapseMatrixType::DENSE_PROCEDURALG);
+        ASSERT_EQ(denseSTDP->getMatrixType(), SynapseMatrixType::DENSE);
+
+        // Check random sparse connectivity is stored with narrow indices
+        auto *sparseInternal = static_cast<SynapseGroupInternal*>(sparse);
+        ASSERT_EQ(sparse->getMatrixType(), SynapseMatrixType::SPARSE);
+        ASSERT_EQ(sparseInternal->getSparseIndType(), Type::Uint8);
+        ASSERT_LT(sparse->getMaxConnections(), 20);
+        ASSERT_EQ(sparseSTDP->getMatrixType(), SynapseMatrixType::SPARSE);
+    }
+
+    // Add the same sparse synapse groups to model with no memory budget and resolve for the single-threaded CPU backend
+    {
+        ModelSpecInternal model;
+        model.setAutoMatrixMemoryBudget(0);
+        auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+        auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 20, paramVals, varVals);
+        auto *sparse = model.addSynapsePopulation(
+            "Sparse", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+        auto *sparseSTDP = model.addSynapsePopulation(
+            "SparseSTDP", SynapseMatrixType::AUTO, pre, post,
+            initWeightUpdate<STDPAdditive>(stdpParams, {{"g", 0.0}}, {{"preTrace", 0.0}}, {{"postTrace", 0.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>(fixedProbParams));
+        model.finalise(CodeGenerator::SingleThreadedCPU::Optimiser::isMatrixTypeSupported);
+
+        // Check that, as the CPU backend can't generate connectivity on the fly,
+        // static connectivity falls back to the smallest supported type
+        ASSERT_EQ(sparse->getMatrixType(), SynapseMatrixType::SPARSE);
+        ASSERT_EQ(sparseSTDP->getMatrixType(), SynapseMatrixType::SPARSE);
+    }
 }
 
 TEST(SynapseGroup, IsDendriticDelayRequired)
@@ -1195,3 +1294,272 @@ TEST(SynapseGroup, InvalidPSOutputVar)
     catch (const std::runtime_error &) {
     }
 }
+
+TEST(SynapseGroup, InvalidSharedConnectivity)
+{
+    ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+
+    ModelSpecInternal model;
+    auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10, paramVals, varVals);
+    auto *post2 = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post2", 10, paramVals, varVals);
+
+    auto addSyn = [&](const std::string &name, SynapseMatrixType matrixType, NeuronGroup *trg, double prob)
+    {
+        return model.addSynapsePopulation(
+            name, matrixType, pre, trg,
+            initWeightUpdate<WeightUpdateModels::StaticPulseConstantWeight>({{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", prob}}));
+    };
+    auto *target = addSyn("Target", SynapseMatrixType::SPARSE, post, 0.1);
+    auto *bitmask = addSyn("Bitmask", SynapseMatrixType::BITMASK, post, 0.1);
+    auto *otherPost = addSyn("OtherPost", SynapseMatrixType::SPARSE, post2, 0.1);
+    auto *otherProb = addSyn("OtherProb", SynapseMatrixType::SPARSE, post, 0.2);
+    auto *sharer = addSyn("Sharer", SynapseMatrixType::SPARSE, post, 0.1);
+
+    // Sharing with self, non-sparse groups, groups connecting different 
+    // populations or groups with different connectivity should all fail
+    const std::vector<std::pair<SynapseGroup*, SynapseGroup*>> invalid{
+        {target, target}, {bitmask, target}, {target, bitmask},
+        {otherPost, target}, {otherProb, target}};
+    for(const auto &i : invalid) {
+        try {
+            i.first->setSharedConnectivityTarget(i.second);
+            FAIL();
+        }
+        catch(const std::runtime_error &) {
+        }
+    }
+
+    // Sharing with a group which itself shares connectivity should fail
+    sharer->setSharedConnectivityTarget(target);
+    try {
+        otherProb->setSharedConnectivityTarget(sharer);
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+    ASSERT_EQ(sharer->getSharedConnectivityTarget(), target);
+}
+
+TEST(SynapseGroup, SharedConnectivityFusion)
+{
+    ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+
+    ModelSpecInternal model;
+    auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10, paramVals, varVals);
+
+    ParamValues stdpParams{{"tauPlus", 20.0}, {"tauMinus", 20.0}, {"Aplus", 0.001}, {"Aminus", -0.001}, {"Wmin", 0.0}, {"Wmax", 1.0}};
+    auto addSyn = [&](const std::string &name, double g)
+    {
+        return model.addSynapsePopulation(
+            name, SynapseMatrixType::SPARSE, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulseConstantWeight>({{"g", g}}),
+            initPostsynaptic<PostsynapticModels::ExpCurr>({{"tau", 5.0}}),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    };
+
+    // Two pairs of synapse groups with the same structure, 
+    // one of which shares connectivity within each pair
+    auto *target1 = addSyn("Target1", 1.0);
+    auto *sharer1 = addSyn("Sharer1", 2.0);
+    auto *target2 = addSyn("Target2", 3.0);
+    auto *sharer2 = addSyn("Sharer2", 4.0);
+    sharer1->setSharedConnectivityTarget(target1);
+    sharer2->setSharedConnectivityTarget(target2);
+
+    // A sharer whose presynaptic update is delayed can't be fused
+    auto *delayedSharer = model.addSynapsePopulation(
+        "DelayedSharer", SynapseMatrixType::SPARSE, pre, post,
+        initWeightUpdate<WeightUpdateModels::StaticPulseConstantWeight>({{"g", 1.0}}),
+        initPostsynaptic<PostsynapticModels::ExpCurr>({{"tau", 5.0}}),
+        initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    delayedSharer->setSharedConnectivityTarget(target1);
+    delayedSharer->setAxonalDelaySteps(5);
+    model.finalise();
+
+    auto *target1Internal = static_cast<SynapseGroupInternal*>(target1);
+    auto *sharer1Internal = static_cast<SynapseGroupInternal*>(sharer1);
+    auto *target2Internal = static_cast<SynapseGroupInternal*>(target2);
+    auto *delayedSharerInternal = static_cast<SynapseGroupInternal*>(delayedSharer);
+    ASSERT_TRUE(sharer1Internal->isSharedConnectivityPreSpikeFused());
+    ASSERT_FALSE(delayedSharerInternal->isSharedConnectivityPreSpikeFused());
+    ASSERT_FALSE(target1Internal->isSharedConnectivityPreSpikeFused());
+    ASSERT_FALSE(sharer1Internal->isSparseConnectivityInitRequired());
+    ASSERT_TRUE(target1Internal->isSparseConnectivityInitRequired());
+    ASSERT_EQ(target1Internal->getFusedSharedConnectivitySyn().size(), 1);
+    ASSERT_EQ(&sharer1Internal->getFusedConnectivityTarget(), target1Internal);
+
+    // Targets with structurally-identical sharers should be mergeable
+    ASSERT_EQ(target1Internal->getWUHashDigest(), target2Internal->getWUHashDigest());
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(backend, model);
+
+    // Fused sharers should be handled within the targets' presynaptic update 
+    // so there should be one merged group containing the two targets, with one 
+    // fused sharer child, and one containing the unfused delayed sharer, with none
+    const auto &presynapticUpdateGroups = modelSpecMerged.getMergedPresynapticUpdateGroups();
+    ASSERT_EQ(presynapticUpdateGroups.size(), 2);
+    const auto targetMerged = std::find_if(presynapticUpdateGroups.cbegin(), presynapticUpdateGroups.cend(),
+                                           [](const auto &m){ return m.getGroups().size() == 2; });
+    const auto delayedSharerMerged = std::find_if(presynapticUpdateGroups.cbegin(), presynapticUpdateGroups.cend(),
+                                                  [](const auto &m){ return m.getGroups().size() == 1; });
+    ASSERT_NE(targetMerged, presynapticUpdateGroups.cend());
+    ASSERT_NE(delayedSharerMerged, presynapticUpdateGroups.cend());
+    ASSERT_EQ(targetMerged->getMergedSharedConnectivityGroups().size(), 1);
+    ASSERT_EQ(delayedSharerMerged->getMergedSharedConnectivityGroups().size(), 0);
+    ASSERT_EQ(&delayedSharerMerged->getArchetype(), delayedSharerInternal);
+}
+
+TEST(SynapseGroup, DendriticDelayWheel)
+{
+    ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+
+    ModelSpecInternal model;
+    auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 1000, paramVals, varVals);
+
+    auto addSyn = [&](const std::string &name)
+    {
+        return model.addSynapsePopulation(
+            name, SynapseMatrixType::SPARSE, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulseDendriticDelay>({}, {{"g", 1.0}, {"d", 1}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    };
+
+    // Without a maximum number of events, a ring buffer is used
+    auto *ringBuffer = addSyn("RingBuffer");
+    ringBuffer->setMaxDendriticDelayTimesteps(100);
+    ASSERT_FALSE(ringBuffer->isDendriticDelayWheelEnabled());
+
+    // If buckets are much smaller than target population, wheel is used
+    auto *wheel = addSyn("Wheel");
+    wheel->setMaxDendriticDelayEvents(20);
+    wheel->setMaxDendriticDelayTimesteps(100);
+    ASSERT_TRUE(wheel->isDendriticDelayWheelEnabled());
+
+    // If buckets are larger than target population, ring buffer is used
+    auto *largeBucket = addSyn("LargeBucket");
+    largeBucket->setMaxDendriticDelayTimesteps(100);
+    largeBucket->setMaxDendriticDelayEvents(1000);
+    ASSERT_FALSE(largeBucket->isDendriticDelayWheelEnabled());
+
+    // Timing wheels can't be referenced by custom updates
+    try {
+        createDenDelayVarRef(wheel);
+        FAIL();
+    }
+    catch(const std::runtime_error &) {
+    }
+    model.finalise();
+
+    // Groups using different dendritic delay implementations shouldn't be merged
+    auto *ringBufferInternal = static_cast<SynapseGroupInternal*>(ringBuffer);
+    auto *wheelInternal = static_cast<SynapseGroupInternal*>(wheel);
+    ASSERT_NE(ringBufferInternal->getWUHashDigest(), wheelInternal->getWUHashDigest());
+    ASSERT_NE(ringBufferInternal->getDendriticDelayUpdateHashDigest(), wheelInternal->getDendriticDelayUpdateHashDigest());
+    ASSERT_NE(ringBufferInternal->getPSFuseHashDigest(post), wheelInternal->getPSFuseHashDigest(post));
+
+    // Timing wheels aren't supported with batching
+    {
+        ModelSpecInternal batchModel;
+        batchModel.setBatchSize(2);
+        auto *batchPre = batchModel.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+        auto *batchPost = batchModel.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 1000, paramVals, varVals);
+        auto *batchWheel = batchModel.addSynapsePopulation(
+            "Wheel", SynapseMatrixType::SPARSE, batchPre, batchPost,
+            initWeightUpdate<WeightUpdateModels::StaticPulseDendriticDelay>({}, {{"g", 1.0}, {"d", 1}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+        batchWheel->setMaxDendriticDelayEvents(20);
+        batchWheel->setMaxDendriticDelayTimesteps(100);
+        ASSERT_TRUE(batchWheel->isDendriticDelayWheelEnabled());
+        EXPECT_THROW(batchModel.finalise(), std::runtime_error);
+    }
+}
+
+TEST(SynapseGroup, RowCapacityGrowth)
+{
+    ParamValues paramVals{{"a", 0.02}, {"b", 0.2}, {"c", -65.0}, {"d", 8.0}};
+    VarValues varVals{{"V", 0.0}, {"U", 0.0}};
+
+    auto addSyn = [&](ModelSpecInternal &model, const std::string &name, SynapseMatrixType matrixType)
+    {
+        auto *pre = model.findNeuronGroup("Pre");
+        auto *post = model.findNeuronGroup("Post");
+        return model.addSynapsePopulation(
+            name, matrixType, pre, post,
+            initWeightUpdate<WeightUpdateModels::StaticPulse>({}, {{"g", 1.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+    };
+
+    // Growable row capacity is only valid for sparse connectivity
+    {
+        ModelSpecInternal model;
+        model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+        model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 100, paramVals, varVals);
+        auto *bitmask = addSyn(model, "Bitmask", SynapseMatrixType::BITMASK);
+        bitmask->setRowCapacitySlack(4);
+        try {
+            model.finalise();
+            FAIL();
+        }
+        catch(const std::runtime_error &) {
+        }
+    }
+
+    // Growable row capacity with postsynaptic learning requires worst-case column capacity
+    {
+        ParamValues stdpParams{{"tauPlus", 10.0}, {"tauMinus", 10.0}, {"Aplus", 0.01}, {"Aminus", 0.01}, {"Wmin", 0.0}, {"Wmax", 1.0}};
+        ModelSpecInternal model;
+        auto *pre = model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 100, paramVals, varVals);
+        auto *post = model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 10, paramVals, varVals);
+        auto *stdp = model.addSynapsePopulation(
+            "STDP", SynapseMatrixType::SPARSE, pre, post,
+            initWeightUpdate<STDPAdditive>(stdpParams, {{"g", 0.0}}, {{"preTrace", 0.0}}, {{"postTrace", 0.0}}),
+            initPostsynaptic<PostsynapticModels::DeltaCurr>(),
+            initConnectivity<InitSparseConnectivitySnippet::FixedProbability>({{"prob", 0.1}}));
+        stdp->setRowCapacitySlack(4);
+        ASSERT_LT(stdp->getMaxSourceConnections(), 100);
+        EXPECT_THROW(model.finalise(), std::runtime_error);
+
+        stdp->setMaxSourceConnections(100);
+        model.finalise();
+    }
+
+    ModelSpecInternal model;
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Pre", 10, paramVals, varVals);
+    model.addNeuronPopulation<NeuronModels::Izhikevich>("Post", 100, paramVals, varVals);
+    auto *fixed = addSyn(model, "Fixed", SynapseMatrixType::SPARSE);
+    auto *growable = addSyn(model, "Growable", SynapseMatrixType::SPARSE);
+    growable->setRowCapacitySlack(4);
+    ASSERT_FALSE(fixed->isRowCapacityGrowable());
+    ASSERT_TRUE(growable->isRowCapacityGrowable());
+    model.finalise();
+
+    // Groups with fixed and growable row capacity shouldn't be merged
+    auto *fixedInternal = static_cast<SynapseGroupInternal*>(fixed);
+    auto *growableInternal = static_cast<SynapseGroupInternal*>(growable);
+    ASSERT_NE(fixedInternal->getWUHashDigest(), growableInternal->getWUHashDigest());
+    ASSERT_NE(fixedInternal->getConnectivityInitHashDigest(), growableInternal->getConnectivityInitHashDigest());
+
+    // Create a backend
+    CodeGenerator::SingleThreadedCPU::Preferences preferences;
+    CodeGenerator::SingleThreadedCPU::Backend backend(preferences);
+
+    // Merge model
+    CodeGenerator::ModelSpecMerged modelSpecMerged(backend, model);
+    ASSERT_EQ(modelSpecMerged.getMergedPresynapticUpdateGroups().size(), 2);
+}
@@ -88,6 +88,24 @@ public:
     SET_POST_DYNAMICS_CODE("postTrace *= tauMinusDecay;\n");
 };
 IMPLEMENT_SNIPPET(STDPAdditive);
+
+//--------------------------------------------------------------------------
+// LazyEligibility
+//--------------------------------------------------------------------------
+class LazyEligibility : public WeightUpdateModels::Base
+{
+public:
+    DECLARE_SNIPPET(LazyEligibility);
+    SET_PARAMS({"tauE", "A"});
+    SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+    
+    SET_PRE_SPIKE_SYN_CODE(
+        "addToPost(g);\n"
+        "e += A;\n");
+
+    SET_LAZY_DECAY_VARS({{"e", "tauE"}});
+};
+IMPLEMENT_SNIPPET(LazyEligibility);
 }
 
 //--------------------------------------------------------------------------
@@ -109,6 +127,23 @@ TEST(WeightUpdateModels, CompareCopyPasted)
     STDP stdpCopy;
     ASSERT_EQ(STDP::getInstance()->getHashDigest(), stdpCopy.getHashDigest());
 }
+
+TEST(WeightUpdateModels, CompareLazyDecay)
+{
+    // Same model without lazily-decayed variable
+    class Eligibility : public WeightUpdateModels::Base
+    {
+    public:
+        SET_PARAMS({"tauE", "A"});
+        SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+        SET_PRE_SPIKE_SYN_CODE(
+            "addToPost(g);\n"
+            "e += A;\n");
+    };
+
+    Eligibility eligibility;
+    ASSERT_NE(LazyEligibility::getInstance()->getHashDigest(), eligibility.getHashDigest());
+}
 //--------------------------------------------------------------------------
 TEST(WeightUpdateModels, ValidateParamValues) 
 {
@@ -277,3 +312,65 @@ TEST(WeightUpdateModels, ValidatePostVarValues)
     catch(const std::runtime_error &) {
     } 
 }
+//--------------------------------------------------------------------------
+TEST(WeightUpdateModels, ValidateLazyDecayVars) 
+{
+    const ParamValues paramVals{{"tauE", 20.0}, {"A", 0.1}};
+    const VarValues varVals{{"g", 1.0}, {"e", 0.0}};
+    
+    // Valid model
+    LazyEligibility::getInstance()->validate(paramVals, varVals, {}, {}, {}, {}, {});
+
+    // Lazily-decayed variable doesn't exist
+    class LazyMisSpelled : public WeightUpdateModels::Base
+    {
+    public:
+        SET_PARAMS({"tauE", "A"});
+        SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+        SET_PRE_SPIKE_SYN_CODE("addToPost(g);\n");
+        SET_LAZY_DECAY_VARS({{"E", "tauE"}});
+    };
+
+    // Lazily-decayed variable is read-only
+    class LazyReadOnly : public WeightUpdateModels::Base
+    {
+    public:
+        SET_PARAMS({"tauE", "A"});
+        SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+        SET_PRE_SPIKE_SYN_CODE("addToPost(g);\n");
+        SET_LAZY_DECAY_VARS({{"g", "tauE"}});
+    };
+
+    // Time constant isn't a parameter
+    class LazyMissingTau : public WeightUpdateModels::Base
+    {
+    public:
+        SET_PARAMS({"tauE", "A"});
+        SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+        SET_PRE_SPIKE_SYN_CODE("addToPost(g);\n");
+        SET_LAZY_DECAY_VARS({{"e", "tau"}});
+    };
+
+    // Variable decayed twice
+    class LazyDuplicate : public WeightUpdateModels::Base
+    {
+    public:
+        SET_PARAMS({"tauE", "A"});
+        SET_VARS({{"g", "scalar", VarAccess::READ_ONLY}, {"e", "scalar"}});
+        SET_PRE_SPIKE_SYN_CODE("addToPost(g);\n");
+        SET_LAZY_DECAY_VARS({{"e", "tauE"}, {"e", "A"}});
+    };
+
+    const LazyMisSpelled lazyMisSpelled;
+    const LazyReadOnly lazyReadOnly;
+    const LazyMissingTau lazyMissingTau;
+    const LazyDuplicate lazyDuplicate;
+    for(const WeightUpdateModels::Base *m : std::initializer_list<const WeightUpdateModels::Base*>{&lazyMisSpelled, &lazyReadOnly, &lazyMissingTau, &lazyDuplicate}) {
+        try {
+            m->validate(paramVals, varVals, {}, {}, {}, {}, {});
+            FAIL();
+        }
+        catch(const std::runtime_error &) {
+        }
+    }
+}